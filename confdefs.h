@@ -0,0 +1,7 @@
+/* confdefs.h */
+#define PACKAGE_NAME "Xen Hypervisor"
+#define PACKAGE_TARNAME "xen"
+#define PACKAGE_VERSION "4.13"
+#define PACKAGE_STRING "Xen Hypervisor 4.13"
+#define PACKAGE_BUGREPORT "xen-devel@lists.xen.org"
+#define PACKAGE_URL "http://www.xen.org/"
@@ -0,0 +1,2 @@
+SUBSYSTEMS               :=  xen tools
+GIT_HTTP                 ?= n
@@ -155,7 +155,7 @@ LDLIBS_libxenstore += -ldl
 endif
 
 CFLAGS_libxenstat  = -I$(XEN_LIBXENSTAT)
-SHDEPS_libxenstat  = $(SHLIB_libxenctrl) $(SHLIB_libxenstore)
+SHDEPS_libxenstat  = $(SHLIB_libxenctrl) $(SHLIB_libxenstore) $(SHLIB_libxenforeignmemory)
 LDLIBS_libxenstat  = $(SHDEPS_libxenstat) $(XEN_LIBXENSTAT)/libxenstat$(libextension)
 SHLIB_libxenstat   = $(SHDEPS_libxenstat) -Wl,-rpath-link=$(XEN_LIBXENSTAT)
 
@@ -0,0 +1 @@
+/root/repo/tools/include/../../xen/include/public/argo.h
\ No newline at end of file
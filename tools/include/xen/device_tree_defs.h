@@ -0,0 +1 @@
+/root/repo/tools/include/../../xen/include/public/device_tree_defs.h
\ No newline at end of file
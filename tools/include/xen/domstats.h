@@ -0,0 +1 @@
+/root/repo/xen/include/public/domstats.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/tools/include/../../xen/include/xen/lib/x86/cpu-policy.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/tools/include/../../xen/include/xen/lib/x86/cpuid.h
\ No newline at end of file
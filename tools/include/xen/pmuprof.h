@@ -0,0 +1 @@
+/root/repo/xen/include/public/pmuprof.h
\ No newline at end of file
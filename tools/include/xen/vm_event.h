@@ -0,0 +1 @@
+/root/repo/tools/include/../../xen/include/public/vm_event.h
\ No newline at end of file
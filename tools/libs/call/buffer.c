@@ -14,6 +14,9 @@
  */
 
 #include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
 #include <pthread.h>
 
@@ -46,24 +49,195 @@ static void cache_unlock(xencall_handle *xcall)
     errno = saved_errno;
 }
 
+/* Size class of a buffer of nr_pages, or -1 if it is too big to cache. */
+static int buffer_class(size_t nr_pages)
+{
+    int c = 0;
+
+    while ( (1UL << c) < nr_pages )
+        if ( ++c == BUFFER_CACHE_CLASSES )
+            return -1;
+
+    return c;
+}
+
+/* Number of pages actually mapped for a buffer of nr_pages. */
+static size_t buffer_pages(size_t nr_pages)
+{
+    int c = buffer_class(nr_pages);
+
+    return c < 0 ? nr_pages : 1UL << c;
+}
+
+#ifndef __MINIOS__ /* Stubdomains are single threaded. */
+/*
+ * Each thread keeps a few buffers of each class for the handle it last
+ * used, which it allocates from and releases to without taking the global
+ * lock.  The caches of all threads are on a global list, so that closing a
+ * handle can reclaim its buffers from all of them.
+ */
+#define THREAD_CACHE_SIZE 2
+
+struct thread_cache {
+    /*
+     * Handle the buffers belong to, or NULL.  Only changed with the global
+     * lock held, by the owning thread or by xencall_close().
+     *
+     * The owning thread reads it, and uses the buffers, without the lock.
+     * That is only safe because xencall_close(), which flushes the caches
+     * of other threads, must not be called while another thread is using
+     * the handle (see xencall.h).  A thread bound to a different handle
+     * takes the lock before rebinding, so it never races with the flush.
+     */
+    xencall_handle *xcall;
+    struct thread_cache *next;          /* Protected by the global lock. */
+    int nr[BUFFER_CACHE_CLASSES];
+    void *buffers[BUFFER_CACHE_CLASSES][THREAD_CACHE_SIZE];
+    uint64_t hits, releases;            /* Not yet counted in xcall. */
+};
+
+static struct thread_cache *thread_caches;
+static __thread struct thread_cache *thread_cache;
+static pthread_key_t thread_cache_key;
+static pthread_once_t thread_cache_once = PTHREAD_ONCE_INIT;
+static bool thread_cache_usable;
+
+/* Give the buffers of tc back to its handle, with the global lock held. */
+static void thread_cache_flush(struct thread_cache *tc)
+{
+    xencall_handle *xcall = tc->xcall;
+    void *p;
+    int c;
+
+    if ( !xcall )
+        return;
+
+    for ( c = 0; c < BUFFER_CACHE_CLASSES; c++ )
+    {
+        while ( tc->nr[c] > 0 )
+        {
+            p = tc->buffers[c][--tc->nr[c]];
+            if ( xcall->buffer_cache_nr[c] < BUFFER_CACHE_SIZE )
+                xcall->buffer_cache[c][xcall->buffer_cache_nr[c]++] = p;
+            else
+                osdep_free_pages(xcall, p, 1UL << c);
+        }
+    }
+
+    xcall->buffer_total_allocations += tc->hits;
+    xcall->buffer_thread_cache_hits += tc->hits;
+    xcall->buffer_total_releases += tc->releases;
+    tc->hits = tc->releases = 0;
+    tc->xcall = NULL;
+}
+
+/* Called on thread exit. */
+static void thread_cache_destroy(void *arg)
+{
+    struct thread_cache *tc = arg, **pp;
+
+    pthread_mutex_lock(&cache_mutex);
+
+    thread_cache_flush(tc);
+    for ( pp = &thread_caches; *pp != tc; pp = &(*pp)->next )
+        ;
+    *pp = tc->next;
+
+    pthread_mutex_unlock(&cache_mutex);
+
+    /* In case another destructor frees buffers after this one. */
+    thread_cache = NULL;
+    free(tc);
+}
+
+static void thread_cache_init(void)
+{
+    thread_cache_usable = !pthread_key_create(&thread_cache_key,
+                                              thread_cache_destroy);
+}
+
+/*
+ * The calling thread's cache, holding buffers of xcall, or NULL if there
+ * can't be one.
+ */
+static struct thread_cache *thread_cache_get(xencall_handle *xcall)
+{
+    struct thread_cache *tc = thread_cache;
+    bool new_tc = false;
+    int saved_errno;
+
+    if ( tc && tc->xcall == xcall )
+        return tc;
+
+    if ( xcall->flags & XENCALL_OPENFLAG_NON_REENTRANT )
+        return NULL;
+
+    saved_errno = errno;
+
+    pthread_once(&thread_cache_once, thread_cache_init);
+    if ( !thread_cache_usable )
+        goto out;
+
+    if ( !tc )
+    {
+        tc = calloc(1, sizeof(*tc));
+        if ( !tc )
+            goto out;
+        if ( pthread_setspecific(thread_cache_key, tc) )
+        {
+            free(tc);
+            tc = NULL;
+            goto out;
+        }
+        thread_cache = tc;
+        new_tc = true;
+    }
+
+    pthread_mutex_lock(&cache_mutex);
+
+    if ( new_tc )
+    {
+        tc->next = thread_caches;
+        thread_caches = tc;
+    }
+
+    /* Switching handles: the buffers of the last one go back to it. */
+    thread_cache_flush(tc);
+    tc->xcall = xcall;
+
+    pthread_mutex_unlock(&cache_mutex);
+
+ out:
+    errno = saved_errno;
+    return tc;
+}
+#endif
+
 static void *cache_alloc(xencall_handle *xcall, size_t nr_pages)
 {
+    int c = buffer_class(nr_pages);
     void *p = NULL;
+#ifndef __MINIOS__
+    struct thread_cache *tc;
+
+    if ( c >= 0 && (tc = thread_cache_get(xcall)) != NULL && tc->nr[c] > 0 )
+    {
+        tc->hits++;
+        return tc->buffers[c][--tc->nr[c]];
+    }
+#endif
 
     cache_lock(xcall);
 
     xcall->buffer_total_allocations++;
-    xcall->buffer_current_allocations++;
-    if ( xcall->buffer_current_allocations > xcall->buffer_maximum_allocations )
-        xcall->buffer_maximum_allocations = xcall->buffer_current_allocations;
 
-    if ( nr_pages > 1 )
+    if ( c < 0 )
     {
         xcall->buffer_cache_toobig++;
     }
-    else if ( xcall->buffer_cache_nr > 0 )
+    else if ( xcall->buffer_cache_nr[c] > 0 )
     {
-        p = xcall->buffer_cache[--xcall->buffer_cache_nr];
+        p = xcall->buffer_cache[c][--xcall->buffer_cache_nr[c]];
         xcall->buffer_cache_hits++;
     }
     else
@@ -78,17 +252,27 @@ static void *cache_alloc(xencall_handle *xcall, size_t nr_pages)
 
 static int cache_free(xencall_handle *xcall, void *p, size_t nr_pages)
 {
+    int c = buffer_class(nr_pages);
     int rc = 0;
+#ifndef __MINIOS__
+    struct thread_cache *tc;
+
+    if ( c >= 0 && (tc = thread_cache_get(xcall)) != NULL &&
+         tc->nr[c] < THREAD_CACHE_SIZE )
+    {
+        tc->buffers[c][tc->nr[c]++] = p;
+        tc->releases++;
+        return 1;
+    }
+#endif
 
     cache_lock(xcall);
 
     xcall->buffer_total_releases++;
-    xcall->buffer_current_allocations--;
 
-    if ( nr_pages == 1 &&
-         xcall->buffer_cache_nr < BUFFER_CACHE_SIZE )
+    if ( c >= 0 && xcall->buffer_cache_nr[c] < BUFFER_CACHE_SIZE )
     {
-        xcall->buffer_cache[xcall->buffer_cache_nr++] = p;
+        xcall->buffer_cache[c][xcall->buffer_cache_nr[c]++] = p;
         rc = 1;
     }
 
@@ -97,29 +281,81 @@ static int cache_free(xencall_handle *xcall, void *p, size_t nr_pages)
     return rc;
 }
 
+int xencall_get_buffer_stats(xencall_handle *xcall,
+                             xencall_buffer_stats *stats)
+{
+#ifndef __MINIOS__
+    struct thread_cache *tc;
+#endif
+
+    cache_lock(xcall);
+
+    stats->allocations = xcall->buffer_total_allocations;
+    stats->releases = xcall->buffer_total_releases;
+    stats->thread_cache_hits = xcall->buffer_thread_cache_hits;
+    stats->cache_hits = xcall->buffer_cache_hits;
+    stats->cache_misses = xcall->buffer_cache_misses;
+    stats->toobig = xcall->buffer_cache_toobig;
+
+#ifndef __MINIOS__
+    /* Other threads may be updating these meanwhile. */
+    if ( !(xcall->flags & XENCALL_OPENFLAG_NON_REENTRANT) )
+    {
+        for ( tc = thread_caches; tc; tc = tc->next )
+        {
+            if ( tc->xcall != xcall )
+                continue;
+            stats->allocations += tc->hits;
+            stats->thread_cache_hits += tc->hits;
+            stats->releases += tc->releases;
+        }
+    }
+#endif
+
+    cache_unlock(xcall);
+
+    return 0;
+}
+
 void buffer_release_cache(xencall_handle *xcall)
 {
+#ifndef __MINIOS__
+    struct thread_cache *tc;
+#endif
     void *p;
+    int c;
 
     cache_lock(xcall);
 
-    DBGPRINTF("total allocations:%d total releases:%d",
+#ifndef __MINIOS__
+    if ( !(xcall->flags & XENCALL_OPENFLAG_NON_REENTRANT) )
+    {
+        for ( tc = thread_caches; tc; tc = tc->next )
+            if ( tc->xcall == xcall )
+                thread_cache_flush(tc);
+    }
+#endif
+
+    DBGPRINTF("total allocations:%"PRIu64" total releases:%"PRIu64,
               xcall->buffer_total_allocations,
               xcall->buffer_total_releases);
-    DBGPRINTF("current allocations:%d maximum allocations:%d",
-              xcall->buffer_current_allocations,
-              xcall->buffer_maximum_allocations);
-    DBGPRINTF("cache current size:%d",
-              xcall->buffer_cache_nr);
-    DBGPRINTF("cache hits:%d misses:%d toobig:%d",
+    DBGPRINTF("current allocations:%"PRIu64,
+              xcall->buffer_total_allocations -
+              xcall->buffer_total_releases);
+    DBGPRINTF("thread cache hits:%"PRIu64" cache hits:%"PRIu64
+              " misses:%"PRIu64" toobig:%"PRIu64,
+              xcall->buffer_thread_cache_hits,
               xcall->buffer_cache_hits,
               xcall->buffer_cache_misses,
               xcall->buffer_cache_toobig);
 
-    while ( xcall->buffer_cache_nr > 0 )
+    for ( c = 0; c < BUFFER_CACHE_CLASSES; c++ )
     {
-        p = xcall->buffer_cache[--xcall->buffer_cache_nr];
-        osdep_free_pages(xcall, p, 1);
+        while ( xcall->buffer_cache_nr[c] > 0 )
+        {
+            p = xcall->buffer_cache[c][--xcall->buffer_cache_nr[c]];
+            osdep_free_pages(xcall, p, 1UL << c);
+        }
     }
 
     cache_unlock(xcall);
@@ -130,7 +366,7 @@ void *xencall_alloc_buffer_pages(xencall_handle *xcall, size_t nr_pages)
     void *p = cache_alloc(xcall, nr_pages);
 
     if ( !p )
-        p = osdep_alloc_pages(xcall, nr_pages);
+        p = osdep_alloc_pages(xcall, buffer_pages(nr_pages));
 
     if (!p)
         return NULL;
@@ -146,7 +382,7 @@ void xencall_free_buffer_pages(xencall_handle *xcall, void *p, size_t nr_pages)
         return;
 
     if ( !cache_free(xcall, p, nr_pages) )
-        osdep_free_pages(xcall, p, nr_pages);
+        osdep_free_pages(xcall, p, buffer_pages(nr_pages));
 }
 
 struct allocation_header {
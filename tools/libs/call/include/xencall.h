@@ -70,6 +70,11 @@ xencall_handle *xencall_open(struct xentoollog_logger *logger,
  * This is the only function which may be safely called on a
  * xencall_handle in a child after a fork. xencall_free_*() must not
  * be called under such circumstances.
+ *
+ * No other thread may be using the handle, or go on using it, once
+ * xencall_close() is called: the buffers other threads have cached for
+ * the handle are reclaimed without their involvement, so the behaviour of
+ * a concurrent call on the handle is undefined.
  */
 int xencall_close(xencall_handle *xcall);
 
@@ -123,6 +128,25 @@ void xencall_free_buffer_pages(xencall_handle *xcall, void *p, size_t nr_pages);
 void *xencall_alloc_buffer(xencall_handle *xcall, size_t size);
 void xencall_free_buffer(xencall_handle *xcall, void *p);
 
+/*
+ * Statistics of the hypercall buffers allocated with a handle.
+ *
+ * Buffers of up to 16 pages are cached when freed, both by the thread which
+ * freed them and, with the handle, for all threads.
+ */
+typedef struct xencall_buffer_stats {
+    uint64_t allocations;       /* Buffers allocated */
+    uint64_t releases;          /* Buffers freed */
+    uint64_t thread_cache_hits; /* Allocations served by the thread's cache */
+    uint64_t cache_hits;        /* Allocations served by the handle's cache */
+    uint64_t cache_misses;      /* Allocations of buffers which could have
+                                   been cached, but weren't */
+    uint64_t toobig;            /* Allocations of buffers too big to cache */
+} xencall_buffer_stats;
+
+int xencall_get_buffer_stats(xencall_handle *xcall,
+                             xencall_buffer_stats *stats);
+
 /*
  * Are allocated hypercall buffers safe to be accessed by the hypervisor all
  * the time?
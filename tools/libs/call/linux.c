@@ -101,14 +101,44 @@ static void *alloc_pages_bufdev(xencall_handle *xcall, size_t npages)
     return p;
 }
 
+/*
+ * Without the hypercall buffer device, large buffers are backed by huge
+ * pages if the system has any reserved: they are populated with far fewer
+ * faults, and never get migrated while Xen accesses them.  Such buffers are
+ * rounded up to a multiple of the huge page size, if that wastes no more
+ * than an eighth of them, whether or not huge pages are then available.
+ */
+#define HUGEPAGE_PAGES (1UL << (21 - PAGE_SHIFT))
+
+static size_t nobufdev_pages(size_t npages)
+{
+    size_t rounded = (npages + HUGEPAGE_PAGES - 1) & ~(HUGEPAGE_PAGES - 1);
+
+    if ( npages < HUGEPAGE_PAGES || (rounded - npages) * 8 > npages )
+        return npages;
+
+    return rounded;
+}
+
 static void *alloc_pages_nobufdev(xencall_handle *xcall, size_t npages)
 {
-    size_t size = npages * PAGE_SIZE;
-    void *p;
+    size_t size;
+    void *p = MAP_FAILED;
     int rc, i, saved_errno;
 
+    npages = nobufdev_pages(npages);
+    size = npages * PAGE_SIZE;
+
+#ifdef MAP_HUGETLB
+    if ( !(npages & (HUGEPAGE_PAGES - 1)) )
+        p = mmap(NULL, size, PROT_READ|PROT_WRITE,
+                 MAP_PRIVATE|MAP_ANONYMOUS|MAP_LOCKED|MAP_HUGETLB, -1, 0);
+#endif
+
     /* Address returned by mmap is page aligned. */
-    p = mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|MAP_LOCKED, -1, 0);
+    if ( p == MAP_FAILED )
+        p = mmap(NULL, size, PROT_READ|PROT_WRITE,
+                 MAP_PRIVATE|MAP_ANONYMOUS|MAP_LOCKED, -1, 0);
     if ( p == MAP_FAILED )
     {
         PERROR("alloc_pages: mmap(,%zu,...) [nobufdev] failed", size);
@@ -164,6 +194,7 @@ void osdep_free_pages(xencall_handle *xcall, void *ptr, size_t npages)
 
     if ( xcall->buf_fd < 0 )
     {
+        npages = nobufdev_pages(npages);
         /* Recover the VMA flags. Maybe it's not necessary */
         madvise(ptr, npages * PAGE_SIZE, MADV_DOFORK);
     }
@@ -29,25 +29,29 @@ struct xencall_handle {
     Xentoolcore__Active_Handle tc_ah;
 
     /*
-     * A simple cache of unused, single page, hypercall buffers
+     * Caches of unused hypercall buffers, by size class: class c holds
+     * buffers of 1 << c pages.  Threads also keep a few buffers of each
+     * class of the handle they last used in a cache of their own, see
+     * buffer.c.
      *
      * Protected by a global lock.
      */
+#define BUFFER_CACHE_CLASSES 5
 #define BUFFER_CACHE_SIZE 4
-    int buffer_cache_nr;
-    void *buffer_cache[BUFFER_CACHE_SIZE];
+    int buffer_cache_nr[BUFFER_CACHE_CLASSES];
+    void *buffer_cache[BUFFER_CACHE_CLASSES][BUFFER_CACHE_SIZE];
 
     /*
      * Hypercall buffer statistics. All protected by the global
-     * buffer_cache lock.
+     * buffer_cache lock.  Allocations and releases served by the cache of
+     * a thread are counted there until it gets flushed.
      */
-    int buffer_total_allocations;
-    int buffer_total_releases;
-    int buffer_current_allocations;
-    int buffer_maximum_allocations;
-    int buffer_cache_hits;
-    int buffer_cache_misses;
-    int buffer_cache_toobig;
+    uint64_t buffer_total_allocations;
+    uint64_t buffer_total_releases;
+    uint64_t buffer_thread_cache_hits;
+    uint64_t buffer_cache_hits;
+    uint64_t buffer_cache_misses;
+    uint64_t buffer_cache_toobig;
 };
 
 int osdep_xencall_open(xencall_handle *xcall);
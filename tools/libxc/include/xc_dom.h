@@ -175,6 +175,8 @@ struct xc_dom_image {
     xc_interface *xch;
     uint32_t guest_domid;
     int claim_enabled; /* 0 by default, 1 enables it */
+    /* HVM memory is populated from this many threads if more than 1. */
+    unsigned int populate_threads;
 
     int xen_version;
     xen_capabilities_info_t xen_caps;
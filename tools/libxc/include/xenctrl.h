@@ -575,6 +575,20 @@ int xc_domain_unpause(xc_interface *xch,
 int xc_domain_destroy(xc_interface *xch,
                       uint32_t domid);
 
+/**
+ * Like xc_domain_destroy(), but return periodically so that the caller can
+ * report progress.  The call has to be repeated for as long as it fails with
+ * errno set to EAGAIN.
+ *
+ * @parm xch a handle to an open hypervisor interface
+ * @parm domid the domain id to destroy
+ * @parm nr_pages set to the number of pages the domain still owns on EAGAIN
+ * @return 0 once the domain is dead, -1 on failure
+ */
+int xc_domain_destroy_step(xc_interface *xch,
+                           uint32_t domid,
+                           uint64_t *nr_pages);
+
 
 /**
  * This function resumes a suspended domain. The domain should have
@@ -1211,6 +1225,34 @@ int xc_evtchn_reset(xc_interface *xch,
 typedef struct evtchn_status xc_evtchn_status_t;
 int xc_evtchn_status(xc_interface *xch, xc_evtchn_status_t *status);
 
+/**
+ * Notify the remote end of up to EVTCHN_SEND_BATCH_MAX local ports of the
+ * calling domain with a single hypercall.  Notifications to the same vCPU
+ * are coalesced by the hypervisor.
+ *
+ * @parm xch a handle to an open hypervisor interface
+ * @parm ports the local ports to notify
+ * @parm nr_ports the number of entries in @ports
+ * @parm nr_sent if non-NULL, returns the number of ports notified
+ * @return 0 on success, -1 on failure
+ */
+int xc_evtchn_send_batch(xc_interface *xch, const evtchn_port_t *ports,
+                         unsigned int nr_ports, unsigned int *nr_sent);
+
+/**
+ * Moderate notifications arriving on a local interdomain port of the
+ * calling domain: at most @max_events are delivered per @interval_us, and
+ * any excess is coalesced into one notification at the end of the interval.
+ *
+ * @parm xch a handle to an open hypervisor interface
+ * @parm port the local port to moderate
+ * @parm max_events events per interval, or 0 to disable moderation
+ * @parm interval_us the moderation interval, in microseconds
+ * @return 0 on success, -1 on failure
+ */
+int xc_evtchn_set_moderation(xc_interface *xch, evtchn_port_t port,
+                             uint32_t max_events, uint32_t interval_us);
+
 
 
 int xc_physdev_pci_access_modify(xc_interface *xch,
@@ -1300,6 +1342,35 @@ int xc_domain_getvnuma(xc_interface *xch,
 int xc_domain_soft_reset(xc_interface *xch,
                          uint32_t domid);
 
+typedef struct xen_domctl_p2m_superpages xc_p2m_superpages_t;
+
+/*
+ * Retrieve the superpage coverage of a domain's p2m: the number of RAM
+ * mappings of each size, and how many superpages have been split and
+ * re-coalesced over the domain's lifetime.
+ */
+int xc_domain_p2m_superpages(xc_interface *xch,
+                             uint32_t domid,
+                             xc_p2m_superpages_t *info);
+
+/*
+ * Switch hardware tracking of the accessed bits of a domain's p2m on or
+ * off.  Fails with EOPNOTSUPP if the hardware or paging mode can't provide
+ * them.
+ */
+int xc_domain_p2m_access_tracking(xc_interface *xch, uint32_t domid,
+                                  bool enable);
+
+/*
+ * Report and clear the accessed bits of the nr gfns starting at start_gfn.
+ * Bit i of bitmap (nr bits long) is set if gfn start_gfn + i has been
+ * accessed since the previous harvest; accessed, if not NULL, receives the
+ * number of bits set.  Tracking has to be enabled first.
+ */
+int xc_domain_p2m_harvest_accessed(xc_interface *xch, uint32_t domid,
+                                   uint64_t start_gfn, uint64_t nr,
+                                   uint8_t *bitmap, uint64_t *accessed);
+
 #if defined(__i386__) || defined(__x86_64__)
 /*
  * PC BIOS standard E820 types and structure.
@@ -1482,6 +1553,67 @@ int xc_lockprof_query(xc_interface *xch,
                       uint64_t *time,
                       xc_hypercall_buffer_t *data);
 
+/*
+ * Scheduling latency histograms of a pCPU or a domain
+ * (type is XEN_SYSCTL_SCHED_LATENCY_{cpu,domain}).
+ */
+typedef xen_sysctl_sched_latency_stats_t xc_sched_latency_stats_t;
+int xc_sched_latency_get(xc_interface *xch, uint32_t type, uint32_t id,
+                         xc_sched_latency_stats_t *stats);
+int xc_sched_latency_reset(xc_interface *xch);
+
+/*
+ * Lock contention statistics, by class of locks.  classes must have room for
+ * XEN_LOCKSTAT_CLASS_NR entries.  Recording starts disabled, and records one
+ * in sample contended acquisitions once enabled.
+ */
+typedef xen_sysctl_lockstat_class_t xc_lockstat_class_t;
+int xc_lockstat_enable(xc_interface *xch, uint32_t sample);
+int xc_lockstat_disable(xc_interface *xch);
+int xc_lockstat_reset(xc_interface *xch);
+int xc_lockstat_query(xc_interface *xch, uint32_t *enabled, uint32_t *sample,
+                      uint64_t *time, xc_lockstat_class_t *classes);
+
+/*
+ * Hypercall statistics of a domain, indexed by hypercall number.  On entry
+ * *nr_ops is the number of entries ops has room for, and on return the
+ * number of hypercalls Xen accounts, of which at most the former were
+ * written.
+ */
+typedef xen_sysctl_hypercall_op_stats_t xc_hypercall_op_stats_t;
+int xc_hypercall_stats_get(xc_interface *xch, uint32_t domid,
+                           uint32_t *nr_ops, xc_hypercall_op_stats_t *ops);
+
+/*
+ * VM exit counts and cycles of an HVM domain, by reason, summed over all
+ * its vCPUs if vcpu is XEN_SYSCTL_VMEXIT_STATS_all_vcpus.  reasons must
+ * have room for XEN_SYSCTL_VMEXIT_REASONS entries, and vendor says whether
+ * they are indexed by VMX or SVM exit reason.
+ */
+#if defined(__i386__) || defined(__x86_64__)
+typedef xen_sysctl_vmexit_reason_t xc_vmexit_reason_t;
+int xc_vmexit_stats_get(xc_interface *xch, uint32_t domid, uint32_t vcpu,
+                        uint32_t *vendor, xc_vmexit_reason_t *reasons);
+
+/*
+ * Sampling profiler of the hypervisor, whose per pCPU rings of samples are
+ * mapped with xenforeignmemory_map_resource() (see xen/pmuprof.h).  event is
+ * XEN_PMUPROF_EVENT_*, and a period of 0 picks about a thousand samples per
+ * second.
+ */
+int xc_pmuprof_start(xc_interface *xch, uint32_t event, uint64_t period);
+int xc_pmuprof_stop(xc_interface *xch);
+int xc_pmuprof_status(xc_interface *xch, uint32_t *running, uint32_t *event,
+                      uint64_t *period, uint32_t *nr_frames);
+#endif
+
+/*
+ * Read entry *symnum of the hypervisor's symbol table, and advance *symnum
+ * to the next one.  name is empty after the last entry.
+ */
+int xc_get_symbol(xc_interface *xch, uint32_t *symnum, char *type,
+                  uint64_t *address, char *name, uint32_t namelen);
+
 void *xc_memalign(xc_interface *xch, size_t alignment, size_t size);
 
 /**
@@ -1952,6 +2084,19 @@ int xc_mem_paging_resume(xc_interface *xch, uint32_t domain_id);
 int xc_mem_paging_nominate(xc_interface *xch, uint32_t domain_id,
                            uint64_t gfn);
 int xc_mem_paging_evict(xc_interface *xch, uint32_t domain_id, uint64_t gfn);
+
+/*
+ * Nominate or evict the gfns of the nr entries of an array in one go.  The
+ * rc field of each entry receives 0 on success or -errno, with -EBUSY
+ * meaning the gfn can't be paged out.
+ */
+typedef struct xen_mem_paging_batch_entry xc_mem_paging_batch_entry_t;
+int xc_mem_paging_nominate_batch(xc_interface *xch, uint32_t domain_id,
+                                 xc_mem_paging_batch_entry_t *entries,
+                                 unsigned int nr);
+int xc_mem_paging_evict_batch(xc_interface *xch, uint32_t domain_id,
+                              xc_mem_paging_batch_entry_t *entries,
+                              unsigned int nr);
 int xc_mem_paging_prep(xc_interface *xch, uint32_t domain_id, uint64_t gfn);
 int xc_mem_paging_load(xc_interface *xch, uint32_t domain_id,
                        uint64_t gfn, void *buffer);
@@ -2221,6 +2366,38 @@ int xc_memshr_range_share(xc_interface *xch,
                           uint64_t first_gfn,
                           uint64_t last_gfn);
 
+/* Share a batch of pairs of nominated pages, from source_domain and
+ * client_domain respectively, in a single hypercall.  Each entry's rc is set
+ * to 0 or to the (negative) error xc_memshr_share_gfns() would have failed
+ * with for that pair.  Grant references aren't supported.
+ *
+ * Fails as a whole only for errors unrelated to individual entries, e.g.
+ * EINVAL if sharing is not enabled on either of the domains.
+ */
+typedef struct xen_mem_sharing_batch_entry xc_memshr_batch_entry_t;
+int xc_memshr_share_batch(xc_interface *xch,
+                          uint32_t source_domain,
+                          uint32_t client_domain,
+                          xc_memshr_batch_entry_t *entries,
+                          uint32_t nr_entries);
+
+/* Turn domid into a fork of pdomid.  The fork must have been created paused,
+ * with HAP, the same number of vCPUs as the parent and no memory, and
+ * sharing must be enabled on both domains.  The parent is paused until the
+ * fork is destroyed.  The fork's memory is populated from the parent's on
+ * demand: shared for reads, copied for writes.  vCPU and HVM state are
+ * copied; event channels, grants and device model state are not.
+ */
+int xc_memshr_fork(xc_interface *xch,
+                   uint32_t pdomid,
+                   uint32_t domid);
+
+/* Reset a fork to its parent's state, dropping the memory it made private.
+ * The fork must be paused.
+ */
+int xc_memshr_fork_reset(xc_interface *xch,
+                         uint32_t domid);
+
 /* Debug calls: return the number of pages referencing the shared frame backing
  * the input argument. Should be one or greater. 
  *
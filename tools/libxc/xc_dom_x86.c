@@ -27,6 +27,7 @@
 #include <string.h>
 #include <inttypes.h>
 #include <assert.h>
+#include <pthread.h>
 
 #include <xen/xen.h>
 #include <xen/foreign/x86_32.h>
@@ -1311,15 +1312,271 @@ static int check_mmio_hole(uint64_t start, uint64_t memsize,
         return 1;
 }
 
+struct hvm_populate_stats {
+    unsigned long pages_4k, pages_2mb, pages_1gb;
+};
+
+/*
+ * Populate the guest frames [cur_pages, end_pages) of dom->p2m_host, using
+ * the largest extents possible.
+ */
+static int populate_hvm_range(struct xc_dom_image *dom, uint64_t cur_pages,
+                              uint64_t end_pages, unsigned int memflags,
+                              struct hvm_populate_stats *stats)
+{
+    xc_interface *xch = dom->xch;
+    uint32_t domid = dom->guest_domid;
+    unsigned long i, cur_pfn;
+    int rc = 0;
+
+    while ( (rc == 0) && (end_pages > cur_pages) )
+    {
+        /* Clip count to maximum 1GB extent. */
+        unsigned long count = end_pages - cur_pages;
+        unsigned long max_pages = SUPERPAGE_1GB_NR_PFNS;
+
+        if ( count > max_pages )
+            count = max_pages;
+
+        cur_pfn = dom->p2m_host[cur_pages];
+
+        /* Take care the corner cases of super page tails */
+        if ( ((cur_pfn & (SUPERPAGE_1GB_NR_PFNS-1)) != 0) &&
+             (count > (-cur_pfn & (SUPERPAGE_1GB_NR_PFNS-1))) )
+            count = -cur_pfn & (SUPERPAGE_1GB_NR_PFNS-1);
+        else if ( ((count & (SUPERPAGE_1GB_NR_PFNS-1)) != 0) &&
+                  (count > SUPERPAGE_1GB_NR_PFNS) )
+            count &= ~(SUPERPAGE_1GB_NR_PFNS - 1);
+
+        /* Attemp to allocate 1GB super page. Because in each pass
+         * we only allocate at most 1GB, we don't have to clip
+         * super page boundaries.
+         */
+        if ( ((count | cur_pfn) & (SUPERPAGE_1GB_NR_PFNS - 1)) == 0 &&
+             /* Check if there exists MMIO hole in the 1GB memory
+              * range */
+             !check_mmio_hole(cur_pfn << PAGE_SHIFT,
+                              SUPERPAGE_1GB_NR_PFNS << PAGE_SHIFT,
+                              dom->mmio_start, dom->mmio_size) )
+        {
+            long done;
+            unsigned long nr_extents = count >> SUPERPAGE_1GB_SHIFT;
+            xen_pfn_t sp_extents[nr_extents];
+
+            for ( i = 0; i < nr_extents; i++ )
+                sp_extents[i] =
+                    dom->p2m_host[cur_pages+(i<<SUPERPAGE_1GB_SHIFT)];
+
+            done = xc_domain_populate_physmap(xch, domid, nr_extents,
+                                              SUPERPAGE_1GB_SHIFT,
+                                              memflags, sp_extents);
+
+            if ( done > 0 )
+            {
+                stats->pages_1gb += done;
+                done <<= SUPERPAGE_1GB_SHIFT;
+                cur_pages += done;
+                count -= done;
+            }
+        }
+
+        if ( count != 0 )
+        {
+            /* Clip count to maximum 8MB extent. */
+            max_pages = SUPERPAGE_2MB_NR_PFNS * 4;
+            if ( count > max_pages )
+                count = max_pages;
+
+            /* Clip partial superpage extents to superpage
+             * boundaries. */
+            if ( ((cur_pfn & (SUPERPAGE_2MB_NR_PFNS-1)) != 0) &&
+                 (count > (-cur_pfn & (SUPERPAGE_2MB_NR_PFNS-1))) )
+                count = -cur_pfn & (SUPERPAGE_2MB_NR_PFNS-1);
+            else if ( ((count & (SUPERPAGE_2MB_NR_PFNS-1)) != 0) &&
+                      (count > SUPERPAGE_2MB_NR_PFNS) )
+                count &= ~(SUPERPAGE_2MB_NR_PFNS - 1); /* clip non-s.p. tail */
+
+            /* Attempt to allocate superpage extents. */
+            if ( ((count | cur_pfn) & (SUPERPAGE_2MB_NR_PFNS - 1)) == 0 )
+            {
+                long done;
+                unsigned long nr_extents = count >> SUPERPAGE_2MB_SHIFT;
+                xen_pfn_t sp_extents[nr_extents];
+
+                for ( i = 0; i < nr_extents; i++ )
+                    sp_extents[i] =
+                        dom->p2m_host[cur_pages+(i<<SUPERPAGE_2MB_SHIFT)];
+
+                done = xc_domain_populate_physmap(xch, domid, nr_extents,
+                                                  SUPERPAGE_2MB_SHIFT,
+                                                  memflags, sp_extents);
+
+                if ( done > 0 )
+                {
+                    stats->pages_2mb += done;
+                    done <<= SUPERPAGE_2MB_SHIFT;
+                    cur_pages += done;
+                    count -= done;
+                }
+            }
+        }
+
+        /* Fall back to 4kB extents. */
+        if ( count != 0 )
+        {
+            rc = xc_domain_populate_physmap_exact(
+                xch, domid, count, 0, memflags, &dom->p2m_host[cur_pages]);
+            cur_pages += count;
+            stats->pages_4k += count;
+        }
+    }
+
+    return rc;
+}
+
+/*
+ * Populating the memory of a large guest is dominated by Xen clearing and
+ * assigning the pages, which scales with the number of CPUs issuing
+ * XENMEM_populate_physmap.  In parallel mode the vmemranges are cut into
+ * slices, which worker threads pick up in an order alternating between the
+ * vNUMA nodes, so that all nodes are populated concurrently.
+ */
+#define POPULATE_SLICE_PFNS  (SUPERPAGE_1GB_NR_PFNS * 4)
+
+struct hvm_populate_slice {
+    uint64_t start, end;
+    unsigned int memflags;
+    unsigned int vnode;
+    unsigned int seq;    /* Index of the slice within its vmemrange. */
+};
+
+struct hvm_populate_state {
+    struct xc_dom_image *dom;
+    struct hvm_populate_slice *slices;
+    unsigned int nr_slices;
+
+    pthread_mutex_t lock;
+    /* Protected by lock. */
+    unsigned int next;
+    int rc;
+    struct hvm_populate_stats *stats;
+};
+
+static void *populate_hvm_worker(void *arg)
+{
+    struct hvm_populate_state *st = arg;
+    struct hvm_populate_stats stats = { 0 };
+    struct hvm_populate_slice *slice;
+    int rc = 0;
+
+    for ( ; ; )
+    {
+        slice = NULL;
+
+        pthread_mutex_lock(&st->lock);
+        if ( rc && !st->rc )
+            st->rc = rc;
+        if ( !st->rc && st->next < st->nr_slices )
+            slice = &st->slices[st->next++];
+        pthread_mutex_unlock(&st->lock);
+
+        if ( !slice )
+            break;
+
+        rc = populate_hvm_range(st->dom, slice->start, slice->end,
+                                slice->memflags, &stats);
+    }
+
+    pthread_mutex_lock(&st->lock);
+    st->stats->pages_4k += stats.pages_4k;
+    st->stats->pages_2mb += stats.pages_2mb;
+    st->stats->pages_1gb += stats.pages_1gb;
+    pthread_mutex_unlock(&st->lock);
+
+    return NULL;
+}
+
+static int cmp_populate_slice(const void *a, const void *b)
+{
+    const struct hvm_populate_slice *x = a, *y = b;
+
+    if ( x->seq != y->seq )
+        return x->seq < y->seq ? -1 : 1;
+    if ( x->vnode != y->vnode )
+        return x->vnode < y->vnode ? -1 : 1;
+
+    return x->start < y->start ? -1 : x->start > y->start;
+}
+
+static int populate_hvm_parallel(struct xc_dom_image *dom,
+                                 const struct hvm_populate_slice *ranges,
+                                 unsigned int nr_ranges,
+                                 struct hvm_populate_stats *stats)
+{
+    struct hvm_populate_state st = {
+        .dom = dom,
+        .lock = PTHREAD_MUTEX_INITIALIZER,
+        .stats = stats,
+    };
+    unsigned int i, nr_threads = dom->populate_threads, nr_started;
+    pthread_t *threads;
+    uint64_t start;
+
+    /* Upper bound, the first and last slice of a range may be partial. */
+    for ( i = 0; i < nr_ranges; i++ )
+        st.nr_slices += (ranges[i].end - ranges[i].start) /
+                        POPULATE_SLICE_PFNS + 2;
+
+    st.slices = xc_dom_malloc(dom, sizeof(*st.slices) * st.nr_slices);
+    threads = xc_dom_malloc(dom, sizeof(*threads) * nr_threads);
+    if ( !st.slices || !threads )
+        return -1;
+
+    st.nr_slices = 0;
+    for ( i = 0; i < nr_ranges; i++ )
+    {
+        struct hvm_populate_slice *slice;
+        unsigned int seq = 0;
+
+        for ( start = ranges[i].start; start < ranges[i].end;
+              start = slice->end )
+        {
+            slice = &st.slices[st.nr_slices++];
+            *slice = ranges[i];
+            slice->start = start;
+            slice->end = min(ranges[i].end,
+                             (start | (POPULATE_SLICE_PFNS - 1)) + 1);
+            slice->seq = seq++;
+        }
+    }
+
+    qsort(st.slices, st.nr_slices, sizeof(*st.slices), cmp_populate_slice);
+
+    /* The calling thread is a worker as well. */
+    for ( nr_started = 0; nr_started < nr_threads - 1; nr_started++ )
+        if ( pthread_create(&threads[nr_started], NULL,
+                            populate_hvm_worker, &st) )
+            break;
+
+    populate_hvm_worker(&st);
+
+    for ( i = 0; i < nr_started; i++ )
+        pthread_join(threads[i], NULL);
+
+    DOMPRINTF("%s: %u slices populated by %u threads", __FUNCTION__,
+              st.nr_slices, nr_started + 1);
+
+    return st.rc;
+}
+
 static int meminit_hvm(struct xc_dom_image *dom)
 {
     unsigned long i, vmemid, nr_pages = dom->total_pages;
     unsigned long p2m_size;
     unsigned long target_pages = dom->target_pages;
-    unsigned long cur_pages, cur_pfn;
     int rc;
-    unsigned long stat_normal_pages = 0, stat_2mb_pages = 0,
-        stat_1gb_pages = 0;
+    struct hvm_populate_stats stats = { 0 };
+    struct hvm_populate_slice *ranges;
     unsigned int memflags = 0;
     int claim_enabled = dom->claim_enabled;
     uint64_t total_pages;
@@ -1475,18 +1732,25 @@ static int meminit_hvm(struct xc_dom_image *dom)
         }
     }
 
-    stat_normal_pages = 0;
+    ranges = xc_dom_malloc(dom, sizeof(*ranges) * nr_vmemranges);
+    if ( ranges == NULL )
+    {
+        DOMPRINTF("Could not allocate vmemrange state");
+        goto error_out;
+    }
+
     for ( vmemid = 0; vmemid < nr_vmemranges; vmemid++ )
     {
         unsigned int new_memflags = memflags;
-        uint64_t end_pages;
         unsigned int vnode = vmemranges[vmemid].nid;
         unsigned int pnode = vnode_to_pnode[vnode];
 
         if ( pnode != XC_NUMA_NO_NODE )
             new_memflags |= XENMEMF_exact_node(pnode);
 
-        end_pages = vmemranges[vmemid].end >> PAGE_SHIFT;
+        ranges[vmemid].memflags = new_memflags;
+        ranges[vmemid].vnode = vnode;
+        ranges[vmemid].end = vmemranges[vmemid].end >> PAGE_SHIFT;
         /*
          * Consider vga hole belongs to the vmemrange that covers
          * 0xA0000-0xC0000. Note that 0x00000-0xA0000 is populated just
@@ -1494,126 +1758,36 @@ static int meminit_hvm(struct xc_dom_image *dom)
          */
         if ( vmemranges[vmemid].start == 0 && dom->device_model )
         {
-            cur_pages = 0xc0;
-            stat_normal_pages += 0xc0;
+            ranges[vmemid].start = 0xc0;
+            stats.pages_4k += 0xc0;
         }
         else
-            cur_pages = vmemranges[vmemid].start >> PAGE_SHIFT;
-
-        rc = 0;
-        while ( (rc == 0) && (end_pages > cur_pages) )
-        {
-            /* Clip count to maximum 1GB extent. */
-            unsigned long count = end_pages - cur_pages;
-            unsigned long max_pages = SUPERPAGE_1GB_NR_PFNS;
-
-            if ( count > max_pages )
-                count = max_pages;
-
-            cur_pfn = dom->p2m_host[cur_pages];
-
-            /* Take care the corner cases of super page tails */
-            if ( ((cur_pfn & (SUPERPAGE_1GB_NR_PFNS-1)) != 0) &&
-                 (count > (-cur_pfn & (SUPERPAGE_1GB_NR_PFNS-1))) )
-                count = -cur_pfn & (SUPERPAGE_1GB_NR_PFNS-1);
-            else if ( ((count & (SUPERPAGE_1GB_NR_PFNS-1)) != 0) &&
-                      (count > SUPERPAGE_1GB_NR_PFNS) )
-                count &= ~(SUPERPAGE_1GB_NR_PFNS - 1);
-
-            /* Attemp to allocate 1GB super page. Because in each pass
-             * we only allocate at most 1GB, we don't have to clip
-             * super page boundaries.
-             */
-            if ( ((count | cur_pfn) & (SUPERPAGE_1GB_NR_PFNS - 1)) == 0 &&
-                 /* Check if there exists MMIO hole in the 1GB memory
-                  * range */
-                 !check_mmio_hole(cur_pfn << PAGE_SHIFT,
-                                  SUPERPAGE_1GB_NR_PFNS << PAGE_SHIFT,
-                                  dom->mmio_start, dom->mmio_size) )
-            {
-                long done;
-                unsigned long nr_extents = count >> SUPERPAGE_1GB_SHIFT;
-                xen_pfn_t sp_extents[nr_extents];
-
-                for ( i = 0; i < nr_extents; i++ )
-                    sp_extents[i] =
-                        dom->p2m_host[cur_pages+(i<<SUPERPAGE_1GB_SHIFT)];
-
-                done = xc_domain_populate_physmap(xch, domid, nr_extents,
-                                                  SUPERPAGE_1GB_SHIFT,
-                                                  new_memflags, sp_extents);
-
-                if ( done > 0 )
-                {
-                    stat_1gb_pages += done;
-                    done <<= SUPERPAGE_1GB_SHIFT;
-                    cur_pages += done;
-                    count -= done;
-                }
-            }
-
-            if ( count != 0 )
-            {
-                /* Clip count to maximum 8MB extent. */
-                max_pages = SUPERPAGE_2MB_NR_PFNS * 4;
-                if ( count > max_pages )
-                    count = max_pages;
-
-                /* Clip partial superpage extents to superpage
-                 * boundaries. */
-                if ( ((cur_pfn & (SUPERPAGE_2MB_NR_PFNS-1)) != 0) &&
-                     (count > (-cur_pfn & (SUPERPAGE_2MB_NR_PFNS-1))) )
-                    count = -cur_pfn & (SUPERPAGE_2MB_NR_PFNS-1);
-                else if ( ((count & (SUPERPAGE_2MB_NR_PFNS-1)) != 0) &&
-                          (count > SUPERPAGE_2MB_NR_PFNS) )
-                    count &= ~(SUPERPAGE_2MB_NR_PFNS - 1); /* clip non-s.p. tail */
-
-                /* Attempt to allocate superpage extents. */
-                if ( ((count | cur_pfn) & (SUPERPAGE_2MB_NR_PFNS - 1)) == 0 )
-                {
-                    long done;
-                    unsigned long nr_extents = count >> SUPERPAGE_2MB_SHIFT;
-                    xen_pfn_t sp_extents[nr_extents];
-
-                    for ( i = 0; i < nr_extents; i++ )
-                        sp_extents[i] =
-                            dom->p2m_host[cur_pages+(i<<SUPERPAGE_2MB_SHIFT)];
-
-                    done = xc_domain_populate_physmap(xch, domid, nr_extents,
-                                                      SUPERPAGE_2MB_SHIFT,
-                                                      new_memflags, sp_extents);
-
-                    if ( done > 0 )
-                    {
-                        stat_2mb_pages += done;
-                        done <<= SUPERPAGE_2MB_SHIFT;
-                        cur_pages += done;
-                        count -= done;
-                    }
-                }
-            }
+            ranges[vmemid].start = vmemranges[vmemid].start >> PAGE_SHIFT;
+    }
 
-            /* Fall back to 4kB extents. */
-            if ( count != 0 )
-            {
-                rc = xc_domain_populate_physmap_exact(
-                    xch, domid, count, 0, new_memflags, &dom->p2m_host[cur_pages]);
-                cur_pages += count;
-                stat_normal_pages += count;
-            }
-        }
+    /* PoD only sets up p2m entries, which isn't worth any threads. */
+    if ( dom->populate_threads > 1 &&
+         !(memflags & XENMEMF_populate_on_demand) )
+        rc = populate_hvm_parallel(dom, ranges, nr_vmemranges, &stats);
+    else
+    {
+        for ( vmemid = 0, rc = 0; rc == 0 && vmemid < nr_vmemranges;
+              vmemid++ )
+            rc = populate_hvm_range(dom, ranges[vmemid].start,
+                                    ranges[vmemid].end,
+                                    ranges[vmemid].memflags, &stats);
+    }
 
-        if ( rc != 0 )
-        {
-            DOMPRINTF("Could not allocate memory for HVM guest.");
-            goto error_out;
-        }
+    if ( rc != 0 )
+    {
+        DOMPRINTF("Could not allocate memory for HVM guest.");
+        goto error_out;
     }
 
     DPRINTF("PHYSICAL MEMORY ALLOCATION:\n");
-    DPRINTF("  4KB PAGES: 0x%016lx\n", stat_normal_pages);
-    DPRINTF("  2MB PAGES: 0x%016lx\n", stat_2mb_pages);
-    DPRINTF("  1GB PAGES: 0x%016lx\n", stat_1gb_pages);
+    DPRINTF("  4KB PAGES: 0x%016lx\n", stats.pages_4k);
+    DPRINTF("  2MB PAGES: 0x%016lx\n", stats.pages_2mb);
+    DPRINTF("  1GB PAGES: 0x%016lx\n", stats.pages_1gb);
 
     rc = 0;
     goto out;
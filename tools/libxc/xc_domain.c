@@ -92,9 +92,27 @@ int xc_domain_destroy(xc_interface *xch,
     DECLARE_DOMCTL;
     domctl.cmd = XEN_DOMCTL_destroydomain;
     domctl.domain = domid;
+    domctl.u.destroydomain.flags = 0;
     return do_domctl(xch, &domctl);
 }
 
+int xc_domain_destroy_step(xc_interface *xch,
+                           uint32_t domid,
+                           uint64_t *nr_pages)
+{
+    int rc;
+    DECLARE_DOMCTL;
+
+    domctl.cmd = XEN_DOMCTL_destroydomain;
+    domctl.domain = domid;
+    domctl.u.destroydomain.flags = XEN_DOMCTL_DESTROY_report;
+    rc = do_domctl(xch, &domctl);
+    if ( rc < 0 && errno == EAGAIN )
+        *nr_pages = domctl.u.destroydomain.nr_pages;
+
+    return rc;
+}
+
 int xc_domain_shutdown(xc_interface *xch,
                        uint32_t domid,
                        int reason)
@@ -2345,6 +2363,75 @@ int xc_domain_soft_reset(xc_interface *xch,
     domctl.domain = domid;
     return do_domctl(xch, &domctl);
 }
+
+int xc_domain_p2m_superpages(xc_interface *xch,
+                             uint32_t domid,
+                             xc_p2m_superpages_t *info)
+{
+    int rc;
+    DECLARE_DOMCTL;
+
+    memset(&domctl.u.p2m_superpages, 0, sizeof(domctl.u.p2m_superpages));
+    domctl.cmd = XEN_DOMCTL_p2m_superpages;
+    domctl.domain = domid;
+
+    rc = do_domctl(xch, &domctl);
+    if ( !rc )
+        *info = domctl.u.p2m_superpages;
+
+    return rc;
+}
+
+static int xc_domain_p2m_access_bits_op(xc_interface *xch, uint32_t domid,
+                                        unsigned int op)
+{
+    DECLARE_DOMCTL;
+
+    memset(&domctl.u.p2m_access_bits, 0, sizeof(domctl.u.p2m_access_bits));
+    domctl.cmd = XEN_DOMCTL_p2m_access_bits;
+    domctl.domain = domid;
+    domctl.u.p2m_access_bits.op = op;
+
+    return do_domctl(xch, &domctl);
+}
+
+int xc_domain_p2m_access_tracking(xc_interface *xch, uint32_t domid,
+                                  bool enable)
+{
+    return xc_domain_p2m_access_bits_op(xch, domid,
+                                        enable ?
+                                        XEN_DOMCTL_P2M_ACCESS_BITS_ENABLE :
+                                        XEN_DOMCTL_P2M_ACCESS_BITS_DISABLE);
+}
+
+int xc_domain_p2m_harvest_accessed(xc_interface *xch, uint32_t domid,
+                                   uint64_t start_gfn, uint64_t nr,
+                                   uint8_t *bitmap, uint64_t *accessed)
+{
+    int rc;
+    DECLARE_DOMCTL;
+    DECLARE_HYPERCALL_BOUNCE(bitmap, (nr + 7) / 8,
+                             XC_HYPERCALL_BUFFER_BOUNCE_OUT);
+
+    if ( xc_hypercall_bounce_pre(xch, bitmap) )
+        return -1;
+
+    memset(&domctl.u.p2m_access_bits, 0, sizeof(domctl.u.p2m_access_bits));
+    domctl.cmd = XEN_DOMCTL_p2m_access_bits;
+    domctl.domain = domid;
+    domctl.u.p2m_access_bits.op = XEN_DOMCTL_P2M_ACCESS_BITS_HARVEST;
+    domctl.u.p2m_access_bits.start_gfn = start_gfn;
+    domctl.u.p2m_access_bits.nr = nr;
+    set_xen_guest_handle(domctl.u.p2m_access_bits.bitmap, bitmap);
+
+    rc = do_domctl(xch, &domctl);
+    if ( !rc && accessed )
+        *accessed = domctl.u.p2m_access_bits.accessed;
+
+    xc_hypercall_bounce_post(xch, bitmap);
+
+    return rc;
+}
 /*
  * Local variables:
  * mode: C
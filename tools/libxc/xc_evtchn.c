@@ -74,6 +74,42 @@ int xc_evtchn_status(xc_interface *xch, xc_evtchn_status_t *status)
                         sizeof(*status), 1);
 }
 
+int xc_evtchn_send_batch(xc_interface *xch, const evtchn_port_t *ports,
+                         unsigned int nr_ports, unsigned int *nr_sent)
+{
+    struct evtchn_send_batch arg;
+    int rc;
+
+    if ( nr_ports > EVTCHN_SEND_BATCH_MAX )
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    arg.nr_ports = nr_ports;
+    arg.nr_sent = 0;
+    memcpy(arg.ports, ports, nr_ports * sizeof(*ports));
+
+    rc = do_evtchn_op(xch, EVTCHNOP_send_batch, &arg, sizeof(arg), 0);
+
+    if ( nr_sent )
+        *nr_sent = arg.nr_sent;
+
+    return rc;
+}
+
+int xc_evtchn_set_moderation(xc_interface *xch, evtchn_port_t port,
+                             uint32_t max_events, uint32_t interval_us)
+{
+    struct evtchn_set_moderation arg = {
+        .port        = port,
+        .max_events  = max_events,
+        .interval_us = interval_us,
+    };
+
+    return do_evtchn_op(xch, EVTCHNOP_set_moderation, &arg, sizeof(arg), 0);
+}
+
 /*
  * Local variables:
  * mode: C
@@ -82,6 +82,47 @@ int xc_mem_paging_evict(xc_interface *xch, uint32_t domain_id, uint64_t gfn)
                                gfn, NULL);
 }
 
+static int xc_mem_paging_batch(xc_interface *xch, uint32_t domain_id,
+                               unsigned int op,
+                               xc_mem_paging_batch_entry_t *entries,
+                               unsigned int nr)
+{
+    size_t size = nr * sizeof(*entries);
+    int rc, old_errno;
+
+    if ( !nr )
+        return 0;
+
+    if ( mlock(entries, size) )
+        return -1;
+
+    rc = xc_mem_paging_memop(xch, domain_id, op, nr, entries);
+
+    old_errno = errno;
+    munlock(entries, size);
+    errno = old_errno;
+
+    return rc;
+}
+
+int xc_mem_paging_nominate_batch(xc_interface *xch, uint32_t domain_id,
+                                 xc_mem_paging_batch_entry_t *entries,
+                                 unsigned int nr)
+{
+    return xc_mem_paging_batch(xch, domain_id,
+                               XENMEM_paging_op_nominate_batch,
+                               entries, nr);
+}
+
+int xc_mem_paging_evict_batch(xc_interface *xch, uint32_t domain_id,
+                              xc_mem_paging_batch_entry_t *entries,
+                              unsigned int nr)
+{
+    return xc_mem_paging_batch(xch, domain_id,
+                               XENMEM_paging_op_evict_batch,
+                               entries, nr);
+}
+
 int xc_mem_paging_prep(xc_interface *xch, uint32_t domain_id, uint64_t gfn)
 {
     return xc_mem_paging_memop(xch, domain_id,
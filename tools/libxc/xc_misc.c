@@ -537,6 +537,250 @@ int xc_lockprof_query(xc_interface *xch,
     return rc;
 }
 
+int xc_sched_latency_get(xc_interface *xch, uint32_t type, uint32_t id,
+                         xc_sched_latency_stats_t *stats)
+{
+    int rc;
+    DECLARE_SYSCTL;
+    DECLARE_HYPERCALL_BOUNCE(stats, sizeof(*stats),
+                             XC_HYPERCALL_BUFFER_BOUNCE_OUT);
+
+    if ( xc_hypercall_bounce_pre(xch, stats) )
+        return -1;
+
+    sysctl.cmd = XEN_SYSCTL_sched_latency;
+    sysctl.u.sched_latency.cmd = XEN_SYSCTL_SCHED_LATENCY_get;
+    sysctl.u.sched_latency.type = type;
+    sysctl.u.sched_latency.id = id;
+    sysctl.u.sched_latency.pad = 0;
+    set_xen_guest_handle(sysctl.u.sched_latency.stats, stats);
+
+    rc = do_sysctl(xch, &sysctl);
+
+    xc_hypercall_bounce_post(xch, stats);
+
+    return rc;
+}
+
+int xc_sched_latency_reset(xc_interface *xch)
+{
+    DECLARE_SYSCTL;
+
+    sysctl.cmd = XEN_SYSCTL_sched_latency;
+    sysctl.u.sched_latency.cmd = XEN_SYSCTL_SCHED_LATENCY_reset;
+    sysctl.u.sched_latency.type = 0;
+    sysctl.u.sched_latency.id = 0;
+    sysctl.u.sched_latency.pad = 0;
+    set_xen_guest_handle(sysctl.u.sched_latency.stats, HYPERCALL_BUFFER_NULL);
+
+    return do_sysctl(xch, &sysctl);
+}
+
+static int xc_lockstat_op(xc_interface *xch, uint32_t cmd, uint32_t sample)
+{
+    DECLARE_SYSCTL;
+
+    sysctl.cmd = XEN_SYSCTL_lockstat_op;
+    sysctl.u.lockstat_op.cmd = cmd;
+    sysctl.u.lockstat_op.sample = sample;
+    sysctl.u.lockstat_op.nr_classes = 0;
+    set_xen_guest_handle(sysctl.u.lockstat_op.classes, HYPERCALL_BUFFER_NULL);
+
+    return do_sysctl(xch, &sysctl);
+}
+
+int xc_lockstat_enable(xc_interface *xch, uint32_t sample)
+{
+    return xc_lockstat_op(xch, XEN_SYSCTL_LOCKSTAT_enable, sample);
+}
+
+int xc_lockstat_disable(xc_interface *xch)
+{
+    return xc_lockstat_op(xch, XEN_SYSCTL_LOCKSTAT_disable, 0);
+}
+
+int xc_lockstat_reset(xc_interface *xch)
+{
+    return xc_lockstat_op(xch, XEN_SYSCTL_LOCKSTAT_reset, 0);
+}
+
+int xc_lockstat_query(xc_interface *xch, uint32_t *enabled, uint32_t *sample,
+                      uint64_t *time, xc_lockstat_class_t *classes)
+{
+    int rc;
+    DECLARE_SYSCTL;
+    DECLARE_HYPERCALL_BOUNCE(classes,
+                             XEN_LOCKSTAT_CLASS_NR * sizeof(*classes),
+                             XC_HYPERCALL_BUFFER_BOUNCE_OUT);
+
+    if ( xc_hypercall_bounce_pre(xch, classes) )
+        return -1;
+
+    sysctl.cmd = XEN_SYSCTL_lockstat_op;
+    sysctl.u.lockstat_op.cmd = XEN_SYSCTL_LOCKSTAT_query;
+    sysctl.u.lockstat_op.nr_classes = XEN_LOCKSTAT_CLASS_NR;
+    set_xen_guest_handle(sysctl.u.lockstat_op.classes, classes);
+
+    rc = do_sysctl(xch, &sysctl);
+
+    xc_hypercall_bounce_post(xch, classes);
+
+    if ( !rc )
+    {
+        *enabled = sysctl.u.lockstat_op.enabled;
+        *sample = sysctl.u.lockstat_op.sample;
+        *time = sysctl.u.lockstat_op.time;
+    }
+
+    return rc;
+}
+
+int xc_hypercall_stats_get(xc_interface *xch, uint32_t domid,
+                           uint32_t *nr_ops, xc_hypercall_op_stats_t *ops)
+{
+    int rc;
+    DECLARE_SYSCTL;
+    DECLARE_HYPERCALL_BOUNCE(ops, *nr_ops * sizeof(*ops),
+                             XC_HYPERCALL_BUFFER_BOUNCE_OUT);
+
+    if ( xc_hypercall_bounce_pre(xch, ops) )
+        return -1;
+
+    sysctl.cmd = XEN_SYSCTL_hypercall_stats;
+    sysctl.u.hypercall_stats.domid = domid;
+    sysctl.u.hypercall_stats.pad = 0;
+    sysctl.u.hypercall_stats.nr_ops = *nr_ops;
+    set_xen_guest_handle(sysctl.u.hypercall_stats.ops, ops);
+
+    rc = do_sysctl(xch, &sysctl);
+
+    xc_hypercall_bounce_post(xch, ops);
+
+    if ( !rc )
+        *nr_ops = sysctl.u.hypercall_stats.nr_ops;
+
+    return rc;
+}
+
+#if defined(__i386__) || defined(__x86_64__)
+int xc_vmexit_stats_get(xc_interface *xch, uint32_t domid, uint32_t vcpu,
+                        uint32_t *vendor, xc_vmexit_reason_t *reasons)
+{
+    int rc;
+    DECLARE_SYSCTL;
+    DECLARE_HYPERCALL_BOUNCE(reasons,
+                             XEN_SYSCTL_VMEXIT_REASONS * sizeof(*reasons),
+                             XC_HYPERCALL_BUFFER_BOUNCE_OUT);
+
+    if ( xc_hypercall_bounce_pre(xch, reasons) )
+        return -1;
+
+    sysctl.cmd = XEN_SYSCTL_vmexit_stats;
+    sysctl.u.vmexit_stats.domid = domid;
+    sysctl.u.vmexit_stats.pad = 0;
+    sysctl.u.vmexit_stats.vcpu = vcpu;
+    sysctl.u.vmexit_stats.pad2 = 0;
+    set_xen_guest_handle(sysctl.u.vmexit_stats.reasons, reasons);
+
+    rc = do_sysctl(xch, &sysctl);
+
+    xc_hypercall_bounce_post(xch, reasons);
+
+    if ( !rc && vendor )
+        *vendor = sysctl.u.vmexit_stats.vendor;
+
+    return rc;
+}
+
+static int xc_pmuprof_op(xc_interface *xch, xen_sysctl_pmuprof_op_t *op)
+{
+    int rc;
+    DECLARE_SYSCTL;
+
+    sysctl.cmd = XEN_SYSCTL_pmuprof_op;
+    sysctl.u.pmuprof_op = *op;
+
+    rc = do_sysctl(xch, &sysctl);
+
+    if ( !rc )
+        *op = sysctl.u.pmuprof_op;
+
+    return rc;
+}
+
+int xc_pmuprof_start(xc_interface *xch, uint32_t event, uint64_t period)
+{
+    xen_sysctl_pmuprof_op_t op = {
+        .cmd = XEN_SYSCTL_PMUPROF_start,
+        .event = event,
+        .period = period,
+    };
+
+    return xc_pmuprof_op(xch, &op);
+}
+
+int xc_pmuprof_stop(xc_interface *xch)
+{
+    xen_sysctl_pmuprof_op_t op = { .cmd = XEN_SYSCTL_PMUPROF_stop };
+
+    return xc_pmuprof_op(xch, &op);
+}
+
+int xc_pmuprof_status(xc_interface *xch, uint32_t *running, uint32_t *event,
+                      uint64_t *period, uint32_t *nr_frames)
+{
+    xen_sysctl_pmuprof_op_t op = { .cmd = XEN_SYSCTL_PMUPROF_status };
+    int rc = xc_pmuprof_op(xch, &op);
+
+    if ( !rc )
+    {
+        *running = op.running;
+        *event = op.event;
+        *period = op.period;
+        *nr_frames = op.nr_frames;
+    }
+
+    return rc;
+}
+#endif
+
+int xc_get_symbol(xc_interface *xch, uint32_t *symnum, char *type,
+                  uint64_t *address, char *name, uint32_t namelen)
+{
+    int rc;
+    DECLARE_PLATFORM_OP;
+    DECLARE_HYPERCALL_BOUNCE(name, namelen, XC_HYPERCALL_BUFFER_BOUNCE_OUT);
+
+    if ( !namelen )
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    if ( xc_hypercall_bounce_pre(xch, name) )
+        return -1;
+
+    platform_op.cmd = XENPF_get_symbol;
+    platform_op.u.symdata.namelen = namelen;
+    platform_op.u.symdata.symnum = *symnum;
+    set_xen_guest_handle(platform_op.u.symdata.name, name);
+
+    rc = do_platform_op(xch, &platform_op);
+
+    xc_hypercall_bounce_post(xch, name);
+
+    if ( !rc )
+    {
+        /* namelen is the symbol's length, which may not have fit. */
+        name[namelen - 1] = '\0';
+        *symnum = platform_op.u.symdata.symnum;
+        *type = platform_op.u.symdata.type;
+        *address = platform_op.u.symdata.address;
+    }
+
+    return rc;
+}
+
 int xc_getcpuinfo(xc_interface *xch, int max_cpus,
                   xc_cpuinfo_t *info, int *nr_cpus)
 {
@@ -0,0 +1,16 @@
+#define sbindir "/usr/local/sbin"
+#define bindir "/usr/local/bin"
+#define LIBEXEC "/usr/local/lib/xen"
+#define LIBEXEC_BIN "/usr/local/lib/xen/bin"
+#define libdir "/usr/local/lib"
+#define SHAREDIR "/usr/local/share"
+#define XENFIRMWAREDIR "/usr/local/lib/xen/boot"
+#define XEN_CONFIG_DIR "/etc/xen"
+#define XEN_SCRIPT_DIR "/etc/xen/scripts"
+#define XEN_LOCK_DIR "/var/lock"
+#define XEN_RUN_DIR "/var/run/xen"
+#define XEN_PAGING_DIR "/var/lib/xen/xenpaging"
+#define XEN_DUMP_DIR "/var/lib/xen/dump"
+#define XEN_LOG_DIR "/var/log/xen"
+#define XEN_LIB_DIR "/var/lib/xen"
+#define XEN_RUN_STORED "/var/run/xenstored"
@@ -221,6 +221,19 @@
  */
 #define LIBXL_HAVE_SCHED_NULL 1
 
+/*
+ * LIBXL_HAVE_SCHED_LATENCY indicates that scheduling latency histograms
+ * can be retrieved with libxl_sched_latency_get_{cpu,domain}() and reset
+ * with libxl_sched_latency_reset().
+ */
+#define LIBXL_HAVE_SCHED_LATENCY 1
+
+/*
+ * LIBXL_HAVE_HYPERCALL_STATS indicates that the hypercall statistics of a
+ * domain can be retrieved with libxl_domain_hypercall_stats_get().
+ */
+#define LIBXL_HAVE_HYPERCALL_STATS 1
+
 /*
  * libxl_domain_build_info has u.hvm.viridian_enable and _disable bitmaps
  * of the specified width.
@@ -1865,6 +1878,10 @@ libxl_vcpuinfo *libxl_list_vcpu(libxl_ctx *ctx, uint32_t domid,
                                 int *nb_vcpu, int *nr_cpus_out);
 void libxl_vcpuinfo_list_free(libxl_vcpuinfo *, int nr_vcpus);
 
+/* Call counts and latency histograms of a domain's hypercalls */
+int libxl_domain_hypercall_stats_get(libxl_ctx *ctx, uint32_t domid,
+                                     libxl_domain_hypercall_stats *stats);
+
 /*
  * Devices
  * =======
@@ -2419,6 +2436,13 @@ int libxl_sched_credit2_params_get(libxl_ctx *ctx, uint32_t poolid,
 int libxl_sched_credit2_params_set(libxl_ctx *ctx, uint32_t poolid,
                                    libxl_sched_credit2_params *scinfo);
 
+/* Scheduling latency statistics */
+int libxl_sched_latency_get_cpu(libxl_ctx *ctx, uint32_t cpu,
+                                libxl_sched_latency_stats *stats);
+int libxl_sched_latency_get_domain(libxl_ctx *ctx, uint32_t domid,
+                                   libxl_sched_latency_stats *stats);
+int libxl_sched_latency_reset(libxl_ctx *ctx);
+
 /* Scheduler Per-domain parameters */
 
 #define LIBXL_DOMAIN_SCHED_PARAM_WEIGHT_DEFAULT    -1
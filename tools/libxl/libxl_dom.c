@@ -1213,6 +1213,10 @@ out:
     return rc;
 }
 
+/* Guests from this size on are populated from several threads. */
+#define HVM_POPULATE_PARALLEL_MIN  (16ULL << 30)
+#define HVM_POPULATE_MAX_THREADS   8
+
 int libxl__build_hvm(libxl__gc *gc, uint32_t domid,
               libxl_domain_config *d_config,
               libxl__domain_build_state *state)
@@ -1250,6 +1254,14 @@ int libxl__build_hvm(libxl__gc *gc, uint32_t domid,
     mem_size = (uint64_t)(info->max_memkb - info->video_memkb) << 10;
     dom->target_pages = (uint64_t)(info->target_memkb - info->video_memkb) >> 2;
     dom->claim_enabled = libxl_defbool_val(info->claim_mode);
+    if (mem_size >= HVM_POPULATE_PARALLEL_MIN) {
+        /* Don't leave populating a large guest to a single dom0 vCPU. */
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+        if (cpus > 1)
+            dom->populate_threads = cpus < HVM_POPULATE_MAX_THREADS ?
+                                    cpus : HVM_POPULATE_MAX_THREADS;
+    }
     if (info->u.hvm.mmio_hole_memkb) {
         uint64_t max_ram_below_4g = (1ULL << 32) -
             (info->u.hvm.mmio_hole_memkb << 10);
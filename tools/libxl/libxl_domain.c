@@ -1331,7 +1331,18 @@ static void devices_destroy_cb(libxl__egc *egc,
         if (!ctx->xch) goto badchild;
 
         if (!dis->soft_reset) {
-            rc = xc_domain_destroy(ctx->xch, domid);
+            uint64_t nr_pages, reported = UINT64_MAX;
+
+            while ((rc = xc_domain_destroy_step(ctx->xch, domid,
+                                                &nr_pages)) < 0 &&
+                   errno == EAGAIN) {
+                /* Report progress about every GiB released. */
+                if (nr_pages + (1ULL << 18) <= reported) {
+                    LOGD(DEBUG, domid, "%"PRIu64" pages left to release",
+                         nr_pages);
+                    reported = nr_pages;
+                }
+            }
         } else {
             rc = xc_domain_pause(ctx->xch, domid);
             if (rc < 0) goto badchild;
@@ -1473,6 +1484,50 @@ err:
     return NULL;
 }
 
+int libxl_domain_hypercall_stats_get(libxl_ctx *ctx, uint32_t domid,
+                                     libxl_domain_hypercall_stats *stats)
+{
+    GC_INIT(ctx);
+    xc_hypercall_op_stats_t *xops;
+    uint32_t nr = 64, asked;
+    int i, b, rc;
+
+    /* Retry if Xen accounts more hypercalls than there was room for. */
+    do {
+        asked = nr;
+        xops = libxl__calloc(gc, asked, sizeof(*xops));
+        if (xc_hypercall_stats_get(ctx->xch, domid, &nr, xops)) {
+            LOGED(ERROR, domid, "Getting hypercall statistics");
+            rc = ERROR_FAIL;
+            goto out;
+        }
+    } while (nr > asked);
+
+    libxl_domain_hypercall_stats_dispose(stats);
+    libxl_domain_hypercall_stats_init(stats);
+
+    stats->num_ops = nr;
+    stats->ops = libxl__calloc(NOGC, nr, sizeof(*stats->ops));
+    for (i = 0; i < nr; i++) {
+        libxl_hypercall_op_stats *op = &stats->ops[i];
+
+        libxl_hypercall_op_stats_init(op);
+        op->calls = xops[i].calls;
+        op->preempted = xops[i].preempted;
+        op->time_ns = xops[i].time;
+        op->num_latency = XEN_SYSCTL_HYPERCALL_BUCKETS;
+        op->latency = libxl__calloc(NOGC, op->num_latency,
+                                    sizeof(*op->latency));
+        for (b = 0; b < XEN_SYSCTL_HYPERCALL_BUCKETS; b++)
+            op->latency[b] = xops[i].latency[b];
+    }
+
+    rc = 0;
+ out:
+    GC_FREE;
+    return rc;
+}
+
 static int libxl__set_vcpuonline_xenstore(libxl__gc *gc, uint32_t domid,
                                           const libxl_bitmap *cpumap,
                                           const libxl_dominfo *info)
@@ -399,6 +399,76 @@ int libxl_sched_credit2_params_set(libxl_ctx *ctx, uint32_t poolid,
     return rc;
 }
 
+static int sched_latency_get(libxl__gc *gc, uint32_t type, uint32_t id,
+                             libxl_sched_latency_stats *stats)
+{
+    xc_sched_latency_stats_t xstats;
+    int i, r;
+
+    r = xc_sched_latency_get(CTX->xch, type, id, &xstats);
+    if (r < 0) {
+        LOGE(ERROR, "getting scheduling latency statistics");
+        return ERROR_FAIL;
+    }
+
+    libxl_sched_latency_stats_dispose(stats);
+    libxl_sched_latency_stats_init(stats);
+
+    stats->num_wake_to_run = XEN_SYSCTL_SCHED_LATENCY_BUCKETS;
+    stats->wake_to_run = libxl__calloc(NOGC, stats->num_wake_to_run,
+                                       sizeof(*stats->wake_to_run));
+    stats->num_run_slice = XEN_SYSCTL_SCHED_LATENCY_BUCKETS;
+    stats->run_slice = libxl__calloc(NOGC, stats->num_run_slice,
+                                     sizeof(*stats->run_slice));
+
+    for (i = 0; i < XEN_SYSCTL_SCHED_LATENCY_BUCKETS; i++) {
+        stats->wake_to_run[i] = xstats.wake_to_run[i];
+        stats->run_slice[i] = xstats.run_slice[i];
+    }
+    stats->migrations = xstats.migrations;
+
+    return 0;
+}
+
+int libxl_sched_latency_get_cpu(libxl_ctx *ctx, uint32_t cpu,
+                                libxl_sched_latency_stats *stats)
+{
+    int rc;
+    GC_INIT(ctx);
+
+    rc = sched_latency_get(gc, XEN_SYSCTL_SCHED_LATENCY_cpu, cpu, stats);
+
+    GC_FREE;
+    return rc;
+}
+
+int libxl_sched_latency_get_domain(libxl_ctx *ctx, uint32_t domid,
+                                   libxl_sched_latency_stats *stats)
+{
+    int rc;
+    GC_INIT(ctx);
+
+    rc = sched_latency_get(gc, XEN_SYSCTL_SCHED_LATENCY_domain, domid, stats);
+
+    GC_FREE;
+    return rc;
+}
+
+int libxl_sched_latency_reset(libxl_ctx *ctx)
+{
+    int r, rc = 0;
+    GC_INIT(ctx);
+
+    r = xc_sched_latency_reset(ctx->xch);
+    if (r < 0) {
+        LOGE(ERROR, "resetting scheduling latency statistics");
+        rc = ERROR_FAIL;
+    }
+
+    GC_FREE;
+    return rc;
+}
+
 static int sched_credit2_domain_get(libxl__gc *gc, uint32_t domid,
                                     libxl_domain_sched_params *scinfo)
 {
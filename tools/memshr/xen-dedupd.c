@@ -0,0 +1,647 @@
+/*
+ * xen-dedupd.c
+ *
+ * Content based deduplication of HVM guest memory, driving the hypervisor's
+ * memory sharing primitives.
+ *
+ * Guest memory is scanned incrementally, at a configurable rate, through
+ * read-only foreign mappings.  Every page is hashed into a content index
+ * (effectively a cache: colliding buckets evict older entries).  When a page
+ * hashes the same as an indexed page elsewhere, both are compared byte for
+ * byte (the hypervisor doesn't check contents) and, if identical, nominated
+ * and queued for sharing.  Queued pairs are shared with one
+ * XENMEM_sharing_op_share_batch hypercall per batch.
+ *
+ * Hosts running many guests from the same image benefit most.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <xenctrl.h>
+#include <xenforeignmemory.h>
+
+#define PAGE_SIZE           XC_PAGE_SIZE
+
+/* Pages mapped at a time while scanning. */
+#define SCAN_CHUNK          512
+/* Max number of domains looked at. */
+#define MAX_DOMAINS         1024
+/* Forget which pages were shared every this many passes over a domain. */
+#define RESCAN_PASSES       16
+/* Linear probing distance in the content index. */
+#define INDEX_PROBE         4
+
+#define LOC_VALID           (1ULL << 63)
+#define LOC(domid, gfn)     (LOC_VALID | ((uint64_t)(domid) << 40) | (gfn))
+#define LOC_DOMID(loc)      ((uint32_t)(((loc) & ~LOC_VALID) >> 40))
+#define LOC_GFN(loc)        ((loc) & ((1ULL << 40) - 1))
+
+struct index_entry {
+    uint64_t hash;
+    uint64_t loc;
+};
+
+struct dom_state {
+    uint32_t domid;
+    bool present;            /* Seen in the latest domain list. */
+    xen_pfn_t max_gfn;
+    xen_pfn_t cursor;
+    unsigned int passes;
+    unsigned long *shared;   /* Bitmap of gfns shared by us. */
+};
+
+struct batch {
+    uint32_t source, client;
+    unsigned int nr;
+    xc_memshr_batch_entry_t *entries;
+};
+
+static struct {
+    uint64_t scanned, skipped, candidates, collisions, queued, shared, failed;
+} stats;
+
+static xc_interface *xch;
+static xenforeignmemory_handle *fmem;
+
+static struct index_entry *index_tbl;
+static uint64_t index_mask;
+
+static struct dom_state *doms[MAX_DOMAINS];
+static unsigned int nr_doms;
+
+static struct batch batch;
+static unsigned int batch_size = 256;
+
+static bool verbose, all_domains, enable_sharing;
+static volatile sig_atomic_t stop, dump_stats;
+
+#define BITS_PER_UL         (8 * sizeof(unsigned long))
+
+static bool test_gfn(const unsigned long *map, xen_pfn_t gfn)
+{
+    return map[gfn / BITS_PER_UL] & (1UL << (gfn % BITS_PER_UL));
+}
+
+static void set_gfn(unsigned long *map, xen_pfn_t gfn)
+{
+    map[gfn / BITS_PER_UL] |= 1UL << (gfn % BITS_PER_UL);
+}
+
+static size_t bitmap_size(xen_pfn_t max_gfn)
+{
+    return (max_gfn / BITS_PER_UL + 1) * sizeof(unsigned long);
+}
+
+/*
+ * A fast, non-cryptographic 64-bit hash over a page: four independent
+ * multiply-rotate lanes (as in xxHash) over 32 bytes per iteration, folded
+ * together at the end.  Collisions are harmless, as candidates are compared
+ * in full before being shared.
+ */
+#define PRIME1  0x9e3779b185ebca87ULL
+#define PRIME2  0xc2b2ae3d27d4eb4fULL
+#define PRIME3  0x165667b19e3779f9ULL
+
+static inline uint64_t rotl64(uint64_t x, unsigned int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t hash_round(uint64_t acc, uint64_t v)
+{
+    return rotl64(acc + v * PRIME2, 31) * PRIME1;
+}
+
+static uint64_t page_hash(const void *page)
+{
+    const uint64_t *p = page;
+    uint64_t a = PRIME1 + PRIME2, b = PRIME2, c = 0, d = -PRIME1, h;
+    unsigned int i;
+
+    for ( i = 0; i < PAGE_SIZE / sizeof(*p); i += 4 )
+    {
+        a = hash_round(a, p[i]);
+        b = hash_round(b, p[i + 1]);
+        c = hash_round(c, p[i + 2]);
+        d = hash_round(d, p[i + 3]);
+    }
+
+    h = rotl64(a, 1) + rotl64(b, 7) + rotl64(c, 12) + rotl64(d, 18);
+    h ^= h >> 33;
+    h *= PRIME2;
+    h ^= h >> 29;
+    h *= PRIME3;
+    h ^= h >> 32;
+
+    return h;
+}
+
+/*
+ * Look up hash in the index.  Returns the entry holding a matching page, or
+ * NULL after having recorded loc as the first page with this content.
+ */
+static struct index_entry *index_lookup(uint64_t hash, uint64_t loc)
+{
+    struct index_entry *e;
+    unsigned int i;
+
+    for ( i = 0; i < INDEX_PROBE; i++ )
+    {
+        e = &index_tbl[(hash + i) & index_mask];
+
+        if ( !(e->loc & LOC_VALID) )
+            break;
+        if ( e->hash == hash )
+            return e;
+    }
+
+    /* Evict the home slot if the probe sequence is full. */
+    if ( i == INDEX_PROBE )
+        e = &index_tbl[hash & index_mask];
+
+    e->hash = hash;
+    e->loc = loc;
+
+    return NULL;
+}
+
+static struct dom_state *find_domain(uint32_t domid)
+{
+    unsigned int i;
+
+    for ( i = 0; i < nr_doms; i++ )
+        if ( doms[i]->domid == domid )
+            return doms[i];
+
+    return NULL;
+}
+
+static void flush_batch(void)
+{
+    struct dom_state *cd = find_domain(batch.client);
+    unsigned int i;
+
+    if ( !batch.nr )
+        return;
+
+    if ( xc_memshr_share_batch(xch, batch.source, batch.client,
+                               batch.entries, batch.nr) )
+    {
+        if ( verbose )
+            fprintf(stderr, "sharing d%u -> d%u failed: %s\n",
+                    batch.client, batch.source, strerror(errno));
+        stats.failed += batch.nr;
+        batch.nr = 0;
+        return;
+    }
+
+    for ( i = 0; i < batch.nr; i++ )
+    {
+        if ( batch.entries[i].rc )
+        {
+            stats.failed++;
+            continue;
+        }
+
+        stats.shared++;
+        if ( cd && batch.entries[i].client_gfn <= cd->max_gfn )
+            set_gfn(cd->shared, batch.entries[i].client_gfn);
+    }
+
+    batch.nr = 0;
+}
+
+/*
+ * Compare two guest pages in full.  Returns 1 if they are identical, 0 if
+ * they differ, and -1 if either can't be mapped.
+ */
+static int pages_equal(uint32_t sdom, xen_pfn_t sgfn,
+                       uint32_t cdom, xen_pfn_t cgfn)
+{
+    void *s, *c = NULL;
+    int equal = -1, err;
+
+    s = xenforeignmemory_map(fmem, sdom, PROT_READ, 1, &sgfn, &err);
+    if ( !s || err )
+        goto out;
+
+    c = xenforeignmemory_map(fmem, cdom, PROT_READ, 1, &cgfn, &err);
+    if ( !c || err )
+        goto out;
+
+    equal = !memcmp(s, c, PAGE_SIZE);
+
+ out:
+    if ( c )
+        xenforeignmemory_unmap(fmem, c, 1);
+    if ( s )
+        xenforeignmemory_unmap(fmem, s, 1);
+
+    return equal;
+}
+
+/*
+ * (cdom, cgfn) hashes the same as the indexed page e.  If their contents
+ * match, nominate both and queue them for sharing.
+ */
+static void try_share(struct index_entry *e, uint32_t cdom, xen_pfn_t cgfn)
+{
+    uint32_t sdom = LOC_DOMID(e->loc);
+    xen_pfn_t sgfn = LOC_GFN(e->loc);
+    uint64_t sh, ch;
+    xc_memshr_batch_entry_t *be;
+
+    stats.candidates++;
+
+    /*
+     * Compare before nominating: a PVH dom0 can't map nominated pages, and
+     * pages left nominated would cost their guests a fault on next write.
+     * If the contents differ, or the indexed page can't be mapped any more
+     * (freed, or its domain destroyed), let the new page take its place.
+     */
+    switch ( pages_equal(sdom, sgfn, cdom, cgfn) )
+    {
+    case 0:
+        stats.collisions++;
+        /* fall through */
+    case -1:
+        e->loc = LOC(cdom, cgfn);
+        return;
+    }
+
+    if ( xc_memshr_nominate_gfn(xch, sdom, sgfn, &sh) )
+    {
+        e->loc = LOC(cdom, cgfn);
+        return;
+    }
+
+    /* E.g. referenced by a device model or a backend. */
+    if ( xc_memshr_nominate_gfn(xch, cdom, cgfn, &ch) )
+        return;
+
+    /*
+     * Nominated pages are read-only and any later write invalidates the
+     * handle, which sharing checks.  Either page may have been written
+     * between the comparison and its nomination though, so compare again
+     * where nominated pages can still be mapped.
+     */
+    if ( !pages_equal(sdom, sgfn, cdom, cgfn) )
+    {
+        stats.collisions++;
+        return;
+    }
+
+    if ( batch.nr && (batch.source != sdom || batch.client != cdom) )
+        flush_batch();
+
+    batch.source = sdom;
+    batch.client = cdom;
+    be = &batch.entries[batch.nr++];
+    memset(be, 0, sizeof(*be));
+    be->source_gfn = sgfn;
+    be->source_handle = sh;
+    be->client_gfn = cgfn;
+    be->client_handle = ch;
+    stats.queued++;
+
+    if ( batch.nr == batch_size )
+        flush_batch();
+}
+
+/* Scan up to budget pages of ds from its cursor onwards. */
+static void scan_domain(struct dom_state *ds, unsigned long budget)
+{
+    xen_pfn_t gfns[SCAN_CHUNK];
+    uint64_t hashes[SCAN_CHUNK];
+    int errs[SCAN_CHUNK];
+    unsigned int i, nr;
+    uint8_t *map;
+
+    while ( budget && !stop )
+    {
+        nr = SCAN_CHUNK;
+        if ( nr > budget )
+            nr = budget;
+        if ( nr > ds->max_gfn - ds->cursor + 1 )
+            nr = ds->max_gfn - ds->cursor + 1;
+
+        for ( i = 0; i < nr; i++ )
+            gfns[i] = ds->cursor + i;
+
+        /*
+         * The mapping has to be gone before nominating: pages with extra
+         * references can't be shared.
+         */
+        map = xenforeignmemory_map(fmem, ds->domid, PROT_READ, nr, gfns, errs);
+        if ( map )
+        {
+            for ( i = 0; i < nr; i++ )
+                if ( !errs[i] && !test_gfn(ds->shared, gfns[i]) )
+                    hashes[i] = page_hash(map + i * PAGE_SIZE);
+                else
+                    errs[i] = 1;
+
+            xenforeignmemory_unmap(fmem, map, nr);
+        }
+        else
+        {
+            /* Skip the chunk, rather than retrying it forever. */
+            stats.skipped += nr;
+            for ( i = 0; i < nr; i++ )
+                errs[i] = 1;
+        }
+
+        for ( i = 0; i < nr && !stop; i++ )
+        {
+            struct index_entry *e;
+            uint64_t loc = LOC(ds->domid, gfns[i]);
+
+            if ( errs[i] )
+                continue;
+
+            stats.scanned++;
+            e = index_lookup(hashes[i], loc);
+            if ( e && e->loc != loc )
+                try_share(e, ds->domid, gfns[i]);
+        }
+
+        budget -= nr;
+        ds->cursor += nr;
+        if ( ds->cursor > ds->max_gfn )
+        {
+            ds->cursor = 0;
+            if ( ++ds->passes % RESCAN_PASSES == 0 )
+                memset(ds->shared, 0, bitmap_size(ds->max_gfn));
+        }
+    }
+}
+
+static void forget_domain(unsigned int i)
+{
+    free(doms[i]->shared);
+    free(doms[i]);
+    doms[i] = doms[--nr_doms];
+}
+
+static int track_domain(uint32_t domid)
+{
+    struct dom_state *ds = find_domain(domid);
+    xen_pfn_t max_gfn;
+
+    if ( xc_domain_maximum_gpfn(xch, domid, &max_gfn) )
+        return -1;
+
+    if ( ds && ds->max_gfn != max_gfn )
+    {
+        /* Memory has grown (or shrunk): start over. */
+        unsigned long *shared = calloc(1, bitmap_size(max_gfn));
+
+        if ( !shared )
+            return -1;
+        free(ds->shared);
+        ds->shared = shared;
+        ds->max_gfn = max_gfn;
+        ds->cursor = 0;
+    }
+    else if ( !ds )
+    {
+        if ( nr_doms == MAX_DOMAINS )
+            return -1;
+
+        if ( enable_sharing && xc_memshr_control(xch, domid, 1) )
+        {
+            fprintf(stderr, "Could not enable sharing for d%u: %s\n",
+                    domid, strerror(errno));
+            return -1;
+        }
+
+        ds = calloc(1, sizeof(*ds));
+        if ( !ds )
+            return -1;
+        ds->shared = calloc(1, bitmap_size(max_gfn));
+        if ( !ds->shared )
+        {
+            free(ds);
+            return -1;
+        }
+        ds->domid = domid;
+        ds->max_gfn = max_gfn;
+        doms[nr_doms++] = ds;
+
+        if ( verbose )
+            printf("tracking d%u (max gfn %#"PRIx64")\n",
+                   domid, (uint64_t)max_gfn);
+    }
+
+    ds->present = true;
+
+    return 0;
+}
+
+/* Refresh the set of domains to scan. */
+static void update_domains(uint32_t *domids, unsigned int nr_domids)
+{
+    static xc_dominfo_t info[MAX_DOMAINS];
+    unsigned int i, j;
+    int n;
+
+    for ( i = 0; i < nr_doms; i++ )
+        doms[i]->present = false;
+
+    n = xc_domain_getinfo(xch, 0, MAX_DOMAINS, info);
+    for ( i = 0; n > 0 && i < n; i++ )
+    {
+        if ( !info[i].hvm || !info[i].hap || info[i].dying ||
+             info[i].shutdown )
+            continue;
+
+        if ( !all_domains )
+        {
+            for ( j = 0; j < nr_domids; j++ )
+                if ( domids[j] == info[i].domid )
+                    break;
+            if ( j == nr_domids )
+                continue;
+        }
+
+        track_domain(info[i].domid);
+    }
+
+    for ( i = 0; i < nr_doms; )
+        if ( !doms[i]->present )
+            forget_domain(i);
+        else
+            i++;
+}
+
+static void print_stats(void)
+{
+    printf("scanned %"PRIu64" skipped %"PRIu64" candidates %"PRIu64
+           " collisions %"PRIu64" queued %"PRIu64" shared %"PRIu64
+           " failed %"PRIu64" freed pages %ld\n",
+           stats.scanned, stats.skipped, stats.candidates, stats.collisions,
+           stats.queued, stats.shared, stats.failed,
+           xc_sharing_freed_pages(xch));
+    fflush(stdout);
+}
+
+static void handle_signal(int sig)
+{
+    if ( sig == SIGUSR1 )
+        dump_stats = 1;
+    else
+        stop = 1;
+}
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [options] (-a | domid...)\n"
+           "  -a         scan all HVM (HAP) domains\n"
+           "  -e         enable memory sharing for scanned domains\n"
+           "  -r pages   pages to scan per interval (default 65536)\n"
+           "  -i ms      scan interval (default 1000)\n"
+           "  -s order   log2 of the content index size (default 22)\n"
+           "  -b n       pairs per share hypercall (default 256)\n"
+           "  -v         verbose, print statistics every interval\n"
+           "SIGUSR1 prints statistics.\n", prog);
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long rate = 65536, interval_ms = 1000;
+    unsigned int index_order = 22, nr_domids = 0, i;
+    uint32_t *domids = NULL;
+    struct sigaction sa = { .sa_handler = handle_signal };
+    int opt, rc = 1;
+
+    while ( (opt = getopt(argc, argv, "aer:i:s:b:vh")) != -1 )
+    {
+        switch ( opt )
+        {
+        case 'a':
+            all_domains = true;
+            break;
+        case 'e':
+            enable_sharing = true;
+            break;
+        case 'r':
+            rate = strtoul(optarg, NULL, 0);
+            break;
+        case 'i':
+            interval_ms = strtoul(optarg, NULL, 0);
+            break;
+        case 's':
+            index_order = strtoul(optarg, NULL, 0);
+            break;
+        case 'b':
+            batch_size = strtoul(optarg, NULL, 0);
+            break;
+        case 'v':
+            verbose = true;
+            break;
+        default:
+            usage(argv[0]);
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    nr_domids = argc - optind;
+    if ( (!all_domains && !nr_domids) || !rate || !batch_size ||
+         index_order < 10 || index_order > 32 )
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if ( nr_domids )
+    {
+        domids = calloc(nr_domids, sizeof(*domids));
+        if ( !domids )
+            goto out;
+        for ( i = 0; i < nr_domids; i++ )
+            domids[i] = strtoul(argv[optind + i], NULL, 0);
+    }
+
+    index_mask = (1ULL << index_order) - 1;
+    index_tbl = calloc(index_mask + 1, sizeof(*index_tbl));
+    batch.entries = calloc(batch_size, sizeof(*batch.entries));
+    if ( !index_tbl || !batch.entries )
+    {
+        perror("calloc");
+        goto out;
+    }
+
+    xch = xc_interface_open(NULL, NULL, 0);
+    fmem = xenforeignmemory_open(NULL, 0);
+    if ( !xch || !fmem )
+    {
+        perror("Opening interfaces");
+        goto out;
+    }
+
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    sigaction(SIGUSR1, &sa, NULL);
+
+    while ( !stop )
+    {
+        struct timespec ts = {
+            .tv_sec = interval_ms / 1000,
+            .tv_nsec = (interval_ms % 1000) * 1000000,
+        };
+
+        update_domains(domids, nr_domids);
+
+        for ( i = 0; i < nr_doms && !stop; i++ )
+            scan_domain(doms[i], rate / nr_doms ?: 1);
+        flush_batch();
+
+        if ( verbose || dump_stats )
+        {
+            dump_stats = 0;
+            print_stats();
+        }
+
+        nanosleep(&ts, NULL);
+    }
+
+    flush_batch();
+    print_stats();
+    rc = 0;
+
+ out:
+    while ( nr_doms )
+        forget_domain(0);
+    if ( fmem )
+        xenforeignmemory_close(fmem);
+    if ( xch )
+        xc_interface_close(xch);
+    free(batch.entries);
+    free(index_tbl);
+    free(domids);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
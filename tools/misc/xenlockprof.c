@@ -6,8 +6,11 @@
  *        File: xenlockprof.c
  *      Author: Juergen Gross (juergen.gross@ts.fujitsu.com)
  *        Date: Oct 2009
- * 
- * Description: 
+ *
+ * Description: Print lock contention statistics, by class of locks, which
+ *              all hypervisor builds can record, or the per-lock profile of
+ *              builds with CONFIG_DEBUG_LOCK_PROFILE.  Statistics can be
+ *              saved to a file, and compared with a later snapshot.
  */
 
 #include <xenctrl.h>
@@ -15,46 +18,327 @@
 #include <stdlib.h>
 #include <sys/mman.h>
 #include <errno.h>
+#include <getopt.h>
 #include <string.h>
 #include <inttypes.h>
+#include <unistd.h>
 
-int main(int argc, char *argv[])
+#define SNAPSHOT_MAGIC   0x534b4c58 /* "XLKS" */
+#define SNAPSHOT_VERSION 1
+
+struct snapshot {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t nr_classes;
+    uint32_t enabled;
+    uint32_t sample;
+    uint32_t pad;
+    uint64_t time;
+    xc_lockstat_class_t classes[XEN_LOCKSTAT_CLASS_NR];
+};
+
+enum sort_key {
+    SORT_WAIT,
+    SORT_COUNT,
+    SORT_MAX,
+    SORT_HOLD,
+    SORT_NAME,
+};
+
+static const char *const class_names[XEN_LOCKSTAT_CLASS_NR] = {
+    [XEN_LOCKSTAT_CLASS_other] = "other",
+    [XEN_LOCKSTAT_CLASS_grant] = "grant",
+    [XEN_LOCKSTAT_CLASS_p2m]   = "p2m",
+    [XEN_LOCKSTAT_CLASS_heap]  = "heap",
+    [XEN_LOCKSTAT_CLASS_event] = "event",
+    [XEN_LOCKSTAT_CLASS_sched] = "sched",
+};
+
+static xc_interface *xch;
+static enum sort_key sort_key = SORT_WAIT;
+static unsigned int nr_callsites = 3;
+static int histogram;
+
+static void usage(const char *prog)
 {
-    xc_interface      *xc_handle;
-    uint32_t           i, j, n;
-    uint64_t           time;
-    double             l, b, sl, sb;
-    char               name[100];
-    DECLARE_HYPERCALL_BUFFER(xc_lockprof_data_t, data);
+    printf("Usage: %s [OPTION]...\n"
+           "Print lock contention statistics, by class of locks.\n\n"
+           "  -e, --enable[=N]     start recording, 1 in N contended "
+           "acquisitions\n"
+           "  -d, --disable        stop recording\n"
+           "  -r, --reset          reset the statistics (and the lock "
+           "profile)\n"
+           "  -s, --sort=KEY       sort by wait (default), count, max, hold "
+           "or name\n"
+           "  -c, --callsites=N    show the N most contended call sites of "
+           "each class\n"
+           "                       (default 3)\n"
+           "  -H, --histogram      show wait time histograms\n"
+           "  -w, --write=FILE     save the statistics to FILE\n"
+           "  -D, --diff=FILE      show the statistics since the ones saved "
+           "in FILE\n"
+           "  -i, --interval=SECS  show the statistics of every SECS seconds\n"
+           "  -l, --locks          show the per-lock profile instead "
+           "(CONFIG_DEBUG_LOCK_PROFILE)\n"
+           "  -h, --help           show this help\n", prog);
+}
+
+static const char *fmt_ns(char *buf, size_t len, uint64_t ns)
+{
+    if ( ns < 1000 )
+        snprintf(buf, len, "%"PRIu64"ns", ns);
+    else if ( ns < 1000000 )
+        snprintf(buf, len, "%.1fus", ns / 1E3);
+    else if ( ns < 1000000000 )
+        snprintf(buf, len, "%.1fms", ns / 1E6);
+    else
+        snprintf(buf, len, "%.2fs", ns / 1E9);
+
+    return buf;
+}
+
+static int get_snapshot(struct snapshot *s)
+{
+    memset(s, 0, sizeof(*s));
+    s->magic = SNAPSHOT_MAGIC;
+    s->version = SNAPSHOT_VERSION;
+    s->nr_classes = XEN_LOCKSTAT_CLASS_NR;
 
-    if ( (argc > 2) || ((argc == 2) && (strcmp(argv[1], "-r") != 0)) )
+    if ( xc_lockstat_query(xch, &s->enabled, &s->sample, &s->time,
+                           s->classes) )
     {
-        printf("%s: [-r]\n", argv[0]);
-        printf("no args: print lock profile data\n");
-        printf("    -r : reset profile data\n");
-        return 1;
+        fprintf(stderr, "Error getting lock statistics: %d (%s)\n",
+                errno, strerror(errno));
+        return -1;
+    }
+
+    return 0;
+}
+
+static int read_snapshot(const char *file, struct snapshot *s)
+{
+    FILE *f = fopen(file, "rb");
+    int ok;
+
+    if ( !f )
+    {
+        fprintf(stderr, "Error opening %s: %s\n", file, strerror(errno));
+        return -1;
     }
 
-    if ( (xc_handle = xc_interface_open(0,0,0)) == 0 )
+    ok = fread(s, sizeof(*s), 1, f) == 1;
+    fclose(f);
+
+    if ( !ok || s->magic != SNAPSHOT_MAGIC ||
+         s->version != SNAPSHOT_VERSION ||
+         s->nr_classes != XEN_LOCKSTAT_CLASS_NR )
     {
-        fprintf(stderr, "Error opening xc interface: %d (%s)\n",
-                errno, strerror(errno));
-        return 1;
+        fprintf(stderr, "%s is not a lock statistics snapshot\n", file);
+        return -1;
+    }
+
+    return 0;
+}
+
+static int write_snapshot(const char *file, const struct snapshot *s)
+{
+    FILE *f = fopen(file, "wb");
+
+    if ( !f || fwrite(s, sizeof(*s), 1, f) != 1 || fclose(f) )
+    {
+        fprintf(stderr, "Error writing %s: %s\n", file, strerror(errno));
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Turn cur into the statistics recorded since old was taken.  Maxima can't
+ * be subtracted, and stay those since the last reset.
+ */
+static void diff_snapshot(struct snapshot *cur, const struct snapshot *old)
+{
+    unsigned int i, j, k;
+
+    if ( cur->time < old->time )
+    {
+        fprintf(stderr, "Statistics were reset since the snapshot\n");
+        return;
+    }
+    cur->time -= old->time;
+
+    for ( i = 0; i < XEN_LOCKSTAT_CLASS_NR; i++ )
+    {
+        xc_lockstat_class_t *c = &cur->classes[i];
+        const xc_lockstat_class_t *o = &old->classes[i];
+
+        c->contended -= o->contended;
+        c->wait_time -= o->wait_time;
+        c->hold_cnt -= o->hold_cnt;
+        c->hold_time -= o->hold_time;
+        for ( j = 0; j < XEN_LOCKSTAT_BUCKETS; j++ )
+            c->wait_hist[j] -= o->wait_hist[j];
+
+        for ( j = 0; j < XEN_LOCKSTAT_CALLSITES; j++ )
+            for ( k = 0; k < XEN_LOCKSTAT_CALLSITES; k++ )
+                if ( o->callsite[k].count &&
+                     o->callsite[k].addr == c->callsite[j].addr &&
+                     o->callsite[k].count <= c->callsite[j].count )
+                    c->callsite[j].count -= o->callsite[k].count;
+    }
+}
+
+static const struct snapshot *sort_snapshot;
+
+static int cmp_class(const void *a, const void *b)
+{
+    unsigned int ia = *(const unsigned int *)a, ib = *(const unsigned int *)b;
+    const xc_lockstat_class_t *ca = &sort_snapshot->classes[ia];
+    const xc_lockstat_class_t *cb = &sort_snapshot->classes[ib];
+    uint64_t va, vb;
+
+    switch ( sort_key )
+    {
+    case SORT_NAME:
+        return strcmp(class_names[ia], class_names[ib]);
+    case SORT_COUNT:
+        va = ca->contended;
+        vb = cb->contended;
+        break;
+    case SORT_MAX:
+        va = ca->wait_max;
+        vb = cb->wait_max;
+        break;
+    case SORT_HOLD:
+        va = ca->hold_time;
+        vb = cb->hold_time;
+        break;
+    default:
+        va = ca->wait_time;
+        vb = cb->wait_time;
+        break;
+    }
+
+    return va < vb ? 1 : va > vb ? -1 : 0;
+}
+
+static int cmp_callsite(const void *a, const void *b)
+{
+    const struct xen_sysctl_lockstat_callsite *ca = a, *cb = b;
+
+    return ca->count < cb->count ? 1 : ca->count > cb->count ? -1 : 0;
+}
+
+static void print_histogram(const xc_lockstat_class_t *c)
+{
+    unsigned int i;
+    char lo[16], hi[16];
+
+    for ( i = 0; i < XEN_LOCKSTAT_BUCKETS; i++ )
+    {
+        if ( !c->wait_hist[i] )
+            continue;
+
+        fmt_ns(lo, sizeof(lo), i ? 1ULL << (i + 7) : 0);
+        if ( i == XEN_LOCKSTAT_BUCKETS - 1 )
+            snprintf(hi, sizeof(hi), "...");
+        else
+            fmt_ns(hi, sizeof(hi), 1ULL << (i + 8));
+        printf("      %8s - %-8s %12"PRIu64"\n", lo, hi, c->wait_hist[i]);
     }
+}
+
+static void print_snapshot(struct snapshot *s)
+{
+    unsigned int order[XEN_LOCKSTAT_CLASS_NR], i, j;
+    char t[6][16];
+
+    printf("Lock contention over %.3fs (%s", s->time / 1E9,
+           s->enabled ? "recording" : "not recording");
+    if ( s->sample > 1 )
+        printf(", 1 in %u contended acquisitions", s->sample);
+    printf(")\n\n");
+
+    for ( i = 0; i < XEN_LOCKSTAT_CLASS_NR; i++ )
+        order[i] = i;
+    sort_snapshot = s;
+    qsort(order, XEN_LOCKSTAT_CLASS_NR, sizeof(order[0]), cmp_class);
 
-    if ( argc > 1 )
+    printf("%-8s %12s %10s %10s %10s %10s %10s %10s\n", "class", "contended",
+           "wait", "avg wait", "max wait", "hold", "avg hold", "max hold");
+
+    for ( i = 0; i < XEN_LOCKSTAT_CLASS_NR; i++ )
     {
-        if ( xc_lockprof_reset(xc_handle) != 0 )
+        xc_lockstat_class_t *c = &s->classes[order[i]];
+
+        printf("%-8s %12"PRIu64" %10s %10s %10s %10s %10s %10s\n",
+               class_names[order[i]], c->contended,
+               fmt_ns(t[0], sizeof(t[0]), c->wait_time),
+               fmt_ns(t[1], sizeof(t[1]),
+                      c->contended ? c->wait_time / c->contended : 0),
+               fmt_ns(t[2], sizeof(t[2]), c->wait_max),
+               fmt_ns(t[3], sizeof(t[3]), c->hold_time),
+               fmt_ns(t[4], sizeof(t[4]),
+                      c->hold_cnt ? c->hold_time / c->hold_cnt : 0),
+               fmt_ns(t[5], sizeof(t[5]), c->hold_max));
+
+        qsort(c->callsite, XEN_LOCKSTAT_CALLSITES, sizeof(c->callsite[0]),
+              cmp_callsite);
+        for ( j = 0; j < nr_callsites && j < XEN_LOCKSTAT_CALLSITES; j++ )
         {
-            fprintf(stderr, "Error resetting profile data: %d (%s)\n",
-                    errno, strerror(errno));
-            return 1;
+            if ( !c->callsite[j].count )
+                break;
+            if ( c->callsite[j].name[0] )
+                printf("    %12"PRIu64"  %s\n", c->callsite[j].count,
+                       c->callsite[j].name);
+            else
+                printf("    %12"PRIu64"  %#"PRIx64"\n", c->callsite[j].count,
+                       c->callsite[j].addr);
         }
-        return 0;
+
+        if ( histogram && c->contended )
+            print_histogram(c);
+    }
+}
+
+static int cmp_lock(const void *a, const void *b)
+{
+    const xc_lockprof_data_t *la = a, *lb = b;
+    int64_t va, vb;
+
+    switch ( sort_key )
+    {
+    case SORT_NAME:
+        return strcmp(la->name, lb->name);
+    case SORT_COUNT:
+        va = la->block_cnt;
+        vb = lb->block_cnt;
+        break;
+    case SORT_HOLD:
+        va = la->lock_time;
+        vb = lb->lock_time;
+        break;
+    default:
+        va = la->block_time;
+        vb = lb->block_time;
+        break;
     }
 
+    return va < vb ? 1 : va > vb ? -1 : 0;
+}
+
+/* The per-lock profile of CONFIG_DEBUG_LOCK_PROFILE builds. */
+static int print_locks(void)
+{
+    uint32_t i, j, n;
+    uint64_t time;
+    double l, b, sl, sb;
+    char name[100];
+    DECLARE_HYPERCALL_BUFFER(xc_lockprof_data_t, data);
+
     n = 0;
-    if ( xc_lockprof_query_number(xc_handle, &n) != 0 )
+    if ( xc_lockprof_query_number(xch, &n) != 0 )
     {
         fprintf(stderr, "Error getting number of profile records: %d (%s)\n",
                 errno, strerror(errno));
@@ -62,7 +346,7 @@ int main(int argc, char *argv[])
     }
 
     n += 32;    /* just to be sure */
-    data = xc_hypercall_buffer_alloc(xc_handle, data, sizeof(*data) * n);
+    data = xc_hypercall_buffer_alloc(xch, data, sizeof(*data) * n);
     if ( data == NULL )
     {
         fprintf(stderr, "Could not allocate buffers: %d (%s)\n",
@@ -71,10 +355,11 @@ int main(int argc, char *argv[])
     }
 
     i = n;
-    if ( xc_lockprof_query(xc_handle, &i, &time, HYPERCALL_BUFFER(data)) != 0 )
+    if ( xc_lockprof_query(xch, &i, &time, HYPERCALL_BUFFER(data)) != 0 )
     {
         fprintf(stderr, "Error getting profile records: %d (%s)\n",
                 errno, strerror(errno));
+        xc_hypercall_buffer_free(xch, data);
         return 1;
     }
 
@@ -84,6 +369,8 @@ int main(int argc, char *argv[])
         i = n;
     }
 
+    qsort(data, i, sizeof(*data), cmp_lock);
+
     sl = 0;
     sb = 0;
     for ( j = 0; j < i; j++ )
@@ -114,7 +401,175 @@ int main(int argc, char *argv[])
     printf("total locked time:    %20.9fs\n", sl);
     printf("total blocked time:   %20.9fs\n", sb);
 
-    xc_hypercall_buffer_free(xc_handle, data);
+    xc_hypercall_buffer_free(xch, data);
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    static const struct option opts[] = {
+        { "enable",    optional_argument, NULL, 'e' },
+        { "disable",   no_argument,       NULL, 'd' },
+        { "reset",     no_argument,       NULL, 'r' },
+        { "sort",      required_argument, NULL, 's' },
+        { "callsites", required_argument, NULL, 'c' },
+        { "histogram", no_argument,       NULL, 'H' },
+        { "write",     required_argument, NULL, 'w' },
+        { "diff",      required_argument, NULL, 'D' },
+        { "interval",  required_argument, NULL, 'i' },
+        { "locks",     no_argument,       NULL, 'l' },
+        { "help",      no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+    const char *write_file = NULL, *diff_file = NULL;
+    int enable = 0, disable = 0, reset = 0, locks = 0, ch;
+    unsigned int sample = 0, interval = 0;
+    struct snapshot cur, old;
+
+    while ( (ch = getopt_long(argc, argv, "e::drs:c:Hw:D:i:lh",
+                              opts, NULL)) != -1 )
+    {
+        switch ( ch )
+        {
+        case 'e':
+            enable = 1;
+            if ( optarg )
+                sample = strtoul(optarg, NULL, 0);
+            break;
+        case 'd':
+            disable = 1;
+            break;
+        case 'r':
+            reset = 1;
+            break;
+        case 's':
+            if ( !strcmp(optarg, "wait") )
+                sort_key = SORT_WAIT;
+            else if ( !strcmp(optarg, "count") )
+                sort_key = SORT_COUNT;
+            else if ( !strcmp(optarg, "max") )
+                sort_key = SORT_MAX;
+            else if ( !strcmp(optarg, "hold") )
+                sort_key = SORT_HOLD;
+            else if ( !strcmp(optarg, "name") )
+                sort_key = SORT_NAME;
+            else
+            {
+                fprintf(stderr, "Unknown sort key %s\n", optarg);
+                return 1;
+            }
+            break;
+        case 'c':
+            nr_callsites = strtoul(optarg, NULL, 0);
+            break;
+        case 'H':
+            histogram = 1;
+            break;
+        case 'w':
+            write_file = optarg;
+            break;
+        case 'D':
+            diff_file = optarg;
+            break;
+        case 'i':
+            interval = strtoul(optarg, NULL, 0);
+            if ( !interval )
+            {
+                fprintf(stderr, "Invalid interval %s\n", optarg);
+                return 1;
+            }
+            break;
+        case 'l':
+            locks = 1;
+            break;
+        case 'h':
+            usage(argv[0]);
+            return 0;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ( optind != argc || (enable && disable) )
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if ( (xch = xc_interface_open(0,0,0)) == 0 )
+    {
+        fprintf(stderr, "Error opening xc interface: %d (%s)\n",
+                errno, strerror(errno));
+        return 1;
+    }
+
+    if ( reset )
+    {
+        /* Only one of the two kinds of statistics may be available. */
+        int rc1 = xc_lockstat_reset(xch), rc2 = xc_lockprof_reset(xch);
+
+        if ( rc1 && rc2 )
+        {
+            fprintf(stderr, "Error resetting lock statistics: %d (%s)\n",
+                    errno, strerror(errno));
+            return 1;
+        }
+    }
+
+    if ( (enable && xc_lockstat_enable(xch, sample)) ||
+         (disable && xc_lockstat_disable(xch)) )
+    {
+        fprintf(stderr, "Error %s lock statistics: %d (%s)\n",
+                enable ? "enabling" : "disabling", errno, strerror(errno));
+        return 1;
+    }
+
+    if ( locks )
+        return print_locks();
+
+    /* Changing the settings only doesn't print anything. */
+    if ( (enable || disable || reset) && !write_file && !diff_file &&
+         !interval )
+        return 0;
+
+    if ( diff_file && read_snapshot(diff_file, &old) )
+        return 1;
+
+    if ( get_snapshot(&cur) )
+        return 1;
+
+    if ( write_file && write_snapshot(write_file, &cur) )
+        return 1;
+
+    if ( interval )
+    {
+        struct snapshot diff;
+
+        for ( ; ; )
+        {
+            old = cur;
+            sleep(interval);
+            if ( get_snapshot(&cur) )
+                return 1;
+            diff = cur;
+            diff_snapshot(&diff, &old);
+            print_snapshot(&diff);
+            printf("\n");
+            fflush(stdout);
+        }
+    }
+
+    if ( write_file && !diff_file )
+        return 0;
+
+    if ( diff_file )
+        diff_snapshot(&cur, &old);
+
+    print_snapshot(&cur);
+
+    xc_interface_close(xch);
 
     return 0;
 }
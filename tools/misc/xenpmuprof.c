@@ -0,0 +1,975 @@
+/*
+ * xenpmuprof: sampling profiler of the hypervisor and its guests.
+ *
+ * "record" starts Xen's profiler, which samples where every pCPU is on PMU
+ * overflow NMIs, and copies the samples from the per pCPU rings into a file,
+ * along with Xen's own symbol table.  "report" then prints the samples as a
+ * flat profile, in the format of perf script, or as folded stacks which
+ * flamegraph.pl takes.
+ *
+ * Only Xen addresses are symbolised: guest samples are attributed to the
+ * domain, and the guest kernel or user space.
+ */
+
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <xenctrl.h>
+#include <xenforeignmemory.h>
+#include <xen/pmuprof.h>
+#include <xen-tools/libs.h>
+
+#define FILE_MAGIC   0x504d5058 /* "XPMP" */
+#define FILE_VERSION 1
+
+/* Followed by nr_syms struct file_sym, then nr_samples struct file_sample */
+struct file_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t event;
+    uint32_t nr_syms;
+    uint64_t period;
+    uint64_t nr_samples;
+    uint64_t lost;
+};
+
+/* Followed by namelen bytes of name, without a terminator */
+struct file_sym {
+    uint64_t addr;
+    uint32_t namelen;
+    uint32_t pad;
+};
+
+struct file_sample {
+    uint32_t cpu;
+    uint32_t pad;
+    xen_pmuprof_record_t rec;
+};
+
+/* Ring frames are mapped this many at a time, the most one mapping can be
+ * acquired with */
+#define CHUNK_FRAMES 32
+
+/* How often the rings are emptied, in ms */
+#define POLL_MS 100
+
+struct ring {
+    xenforeignmemory_resource_handle *header_res;
+    const volatile xen_pmuprof_header_t *header;
+    unsigned int nr_chunks;
+    xenforeignmemory_resource_handle **chunk_res;
+    void **chunks;
+    uint64_t pos;
+};
+
+struct sym {
+    uint64_t addr;
+    char *name;
+};
+
+/* Counts by key: symbols or folded stacks */
+struct tally_entry {
+    char *key;
+    uint64_t count;
+};
+
+struct tally {
+    struct tally_entry *entries;
+    size_t size, used;
+};
+
+static const char *const event_names[] = {
+    [XEN_PMUPROF_EVENT_cycles]       = "cycles",
+    [XEN_PMUPROF_EVENT_instructions] = "instructions",
+};
+
+static const char *const mode_names[] = {
+    [XEN_PMUPROF_MODE_xen]          = "xen",
+    [XEN_PMUPROF_MODE_guest_kernel] = "[guest kernel]",
+    [XEN_PMUPROF_MODE_guest_user]   = "[guest user]",
+};
+
+static xc_interface *xch;
+static struct sym *syms;
+static unsigned int nr_syms;
+static volatile sig_atomic_t interrupted;
+
+static void show_help(void)
+{
+    fprintf(stderr,
+            "xenpmuprof: sampling profiler of the hypervisor\n"
+            "Usage: xenpmuprof <command> [args]\n"
+            "Commands:\n"
+            "  help                   display this help\n"
+            "  record [-e EVENT] [-p PERIOD] [-t SECS] -o FILE\n"
+            "                         sample every PERIOD cycles (default),\n"
+            "                         or instructions, for SECS seconds or\n"
+            "                         until interrupted, into FILE\n"
+            "  report [-f FORMAT] [-n N] FILE\n"
+            "                         print the samples in FILE as the top N\n"
+            "                         symbols (FORMAT top, the default), as\n"
+            "                         perf script would (perf), or as folded\n"
+            "                         stacks for flamegraph.pl (folded)\n"
+            "  status                 show whether the profiler is running\n"
+            "  stop                   stop the profiler\n");
+}
+
+static int parse_event(const char *name)
+{
+    unsigned int i;
+
+    for ( i = 0; i < ARRAY_SIZE(event_names); i++ )
+        if ( !strcmp(name, event_names[i]) )
+            return i;
+
+    return -1;
+}
+
+static const char *event_name(uint32_t event)
+{
+    return event < ARRAY_SIZE(event_names) ? event_names[event] : "unknown";
+}
+
+/* Symbols */
+
+static int sym_cmp(const void *a, const void *b)
+{
+    const struct sym *x = a, *y = b;
+
+    return x->addr < y->addr ? -1 : x->addr > y->addr;
+}
+
+static int add_sym(uint64_t addr, const char *name, size_t len)
+{
+    static unsigned int size;
+
+    if ( nr_syms == size )
+    {
+        struct sym *tmp;
+
+        size = size ? size * 2 : 1024;
+        tmp = realloc(syms, size * sizeof(*tmp));
+        if ( !tmp )
+            return -1;
+        syms = tmp;
+    }
+
+    syms[nr_syms].name = strndup(name, len);
+    if ( !syms[nr_syms].name )
+        return -1;
+    syms[nr_syms++].addr = addr;
+
+    return 0;
+}
+
+/* Read the text symbols of the running hypervisor. */
+static int load_xen_syms(void)
+{
+    char name[128], type;
+    uint32_t symnum = 0;
+    uint64_t addr;
+
+    for ( ; ; )
+    {
+        if ( xc_get_symbol(xch, &symnum, &type, &addr, name, sizeof(name)) )
+        {
+            perror("Reading Xen's symbol table");
+            return -1;
+        }
+        if ( !name[0] )
+            break;
+
+        if ( (type == 't' || type == 'T') &&
+             add_sym(addr, name, strlen(name)) )
+        {
+            perror("Reading Xen's symbol table");
+            return -1;
+        }
+    }
+
+    qsort(syms, nr_syms, sizeof(*syms), sym_cmp);
+
+    return 0;
+}
+
+static const struct sym *lookup_sym(uint64_t addr)
+{
+    unsigned int lo = 0, hi = nr_syms;
+
+    /* The last symbol at or below addr */
+    while ( lo < hi )
+    {
+        unsigned int mid = lo + (hi - lo) / 2;
+
+        if ( syms[mid].addr <= addr )
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo ? &syms[lo - 1] : NULL;
+}
+
+/* Recording */
+
+static void on_signal(int sig)
+{
+    interrupted = 1;
+}
+
+static int map_ring(xenforeignmemory_handle *fmem, unsigned int cpu,
+                    struct ring *ring)
+{
+    unsigned int i, nr_frames;
+    void *addr = NULL;
+
+    ring->header_res = xenforeignmemory_map_resource(
+        fmem, DOMID_XEN, XENMEM_resource_pmuprof, cpu, 0, 1, &addr,
+        PROT_READ, 0);
+    if ( !ring->header_res )
+        return errno == ENOENT ? 0 : -1;
+
+    ring->header = addr;
+    if ( ring->header->version != XEN_PMUPROF_VERSION )
+    {
+        fprintf(stderr, "Unsupported ring version %u\n",
+                ring->header->version);
+        errno = EINVAL;
+        return -1;
+    }
+
+    nr_frames = ring->header->nr_frames;
+    ring->nr_chunks = (nr_frames + CHUNK_FRAMES - 1) / CHUNK_FRAMES;
+    ring->chunk_res = calloc(ring->nr_chunks, sizeof(*ring->chunk_res));
+    ring->chunks = calloc(ring->nr_chunks, sizeof(*ring->chunks));
+    if ( !ring->chunk_res || !ring->chunks )
+        return -1;
+
+    for ( i = 0; i < ring->nr_chunks; i++ )
+    {
+        unsigned int nr = nr_frames - i * CHUNK_FRAMES;
+
+        if ( nr > CHUNK_FRAMES )
+            nr = CHUNK_FRAMES;
+
+        ring->chunk_res[i] = xenforeignmemory_map_resource(
+            fmem, DOMID_XEN, XENMEM_resource_pmuprof, cpu,
+            1 + i * CHUNK_FRAMES, nr, &ring->chunks[i], PROT_READ, 0);
+        if ( !ring->chunk_res[i] )
+            return -1;
+    }
+
+    ring->pos = ring->header->head;
+
+    return 1;
+}
+
+static void unmap_ring(xenforeignmemory_handle *fmem, struct ring *ring)
+{
+    unsigned int i;
+
+    for ( i = 0; i < ring->nr_chunks; i++ )
+        if ( ring->chunk_res && ring->chunk_res[i] )
+            xenforeignmemory_unmap_resource(fmem, ring->chunk_res[i]);
+    if ( ring->header_res )
+        xenforeignmemory_unmap_resource(fmem, ring->header_res);
+
+    free(ring->chunk_res);
+    free(ring->chunks);
+}
+
+static const xen_pmuprof_record_t *ring_record(const struct ring *ring,
+                                               uint64_t n)
+{
+    unsigned int i = n & (ring->header->nr_records - 1);
+    unsigned int frame = i / XEN_PMUPROF_RECORDS_PER_FRAME;
+
+    return (const xen_pmuprof_record_t *)
+        ((const char *)ring->chunks[frame / CHUNK_FRAMES] +
+         (frame % CHUNK_FRAMES) * XC_PAGE_SIZE) +
+        i % XEN_PMUPROF_RECORDS_PER_FRAME;
+}
+
+/*
+ * Copy the new records of a ring into the file.  Xen may overwrite the
+ * oldest of them meanwhile: those are dropped once copied, see
+ * xen/pmuprof.h.
+ */
+static int drain_ring(struct ring *ring, FILE *f, struct file_header *fh)
+{
+    uint64_t nr = ring->header->nr_records, head, first, n;
+    static struct file_sample *buf;
+    static uint64_t buf_size;
+
+    if ( buf_size < nr )
+    {
+        free(buf);
+        buf = malloc(nr * sizeof(*buf));
+        if ( !buf )
+        {
+            buf_size = 0;
+            return -1;
+        }
+        buf_size = nr;
+    }
+
+    head = ring->header->head;
+    xen_rmb();
+
+    if ( head - ring->pos > nr )
+    {
+        fh->lost += head - ring->pos - nr;
+        ring->pos = head - nr;
+    }
+
+    for ( n = ring->pos; n < head; n++ )
+    {
+        buf[n - ring->pos].cpu = ring->header->cpu;
+        buf[n - ring->pos].pad = 0;
+        buf[n - ring->pos].rec = *ring_record(ring, n);
+    }
+
+    xen_rmb();
+    first = ring->header->head + 1;
+    first = first > nr ? first - nr : 0;
+
+    if ( first > ring->pos )
+    {
+        n = (first < head ? first : head) - ring->pos;
+        fh->lost += n;
+    }
+    else
+        n = 0;
+
+    if ( fwrite(buf + n, sizeof(*buf), head - ring->pos - n, f) !=
+         head - ring->pos - n )
+        return -1;
+
+    fh->nr_samples += head - ring->pos - n;
+    ring->pos = head;
+
+    return 0;
+}
+
+static int write_syms(FILE *f)
+{
+    unsigned int i;
+
+    for ( i = 0; i < nr_syms; i++ )
+    {
+        struct file_sym fs = {
+            .addr = syms[i].addr,
+            .namelen = strlen(syms[i].name),
+        };
+
+        if ( fwrite(&fs, sizeof(fs), 1, f) != 1 ||
+             fwrite(syms[i].name, fs.namelen, 1, f) != 1 )
+            return -1;
+    }
+
+    return 0;
+}
+
+static int record_func(int argc, char *argv[])
+{
+    struct file_header fh = {
+        .magic = FILE_MAGIC,
+        .version = FILE_VERSION,
+    };
+    xenforeignmemory_handle *fmem = NULL;
+    struct ring *rings = NULL;
+    const char *output = NULL;
+    unsigned int cpu, nr_cpus = 0, seconds = 0;
+    uint32_t running, event = XEN_PMUPROF_EVENT_cycles, nr_frames;
+    uint64_t period = 0;
+    xc_physinfo_t info = { 0 };
+    struct timespec start, now;
+    struct sigaction sa = { .sa_handler = on_signal };
+    int opt, rc = 1, started = 0;
+    FILE *f;
+
+    optind = 0;
+    while ( (opt = getopt(argc, argv, "e:p:t:o:")) != -1 )
+    {
+        switch ( opt )
+        {
+        case 'e':
+            if ( parse_event(optarg) < 0 )
+            {
+                fprintf(stderr, "Unknown event '%s'\n", optarg);
+                return 1;
+            }
+            event = parse_event(optarg);
+            break;
+        case 'p':
+            period = strtoull(optarg, NULL, 0);
+            break;
+        case 't':
+            seconds = strtoul(optarg, NULL, 0);
+            break;
+        case 'o':
+            output = optarg;
+            break;
+        default:
+            show_help();
+            return 1;
+        }
+    }
+
+    if ( !output )
+    {
+        show_help();
+        return 1;
+    }
+
+    f = fopen(output, "w");
+    if ( !f )
+    {
+        perror(output);
+        return 1;
+    }
+
+    if ( load_xen_syms() )
+        goto out;
+
+    fh.nr_syms = nr_syms;
+    if ( fwrite(&fh, sizeof(fh), 1, f) != 1 || write_syms(f) )
+    {
+        perror(output);
+        goto out;
+    }
+
+    if ( xc_physinfo(xch, &info) )
+    {
+        perror("xc_physinfo");
+        goto out;
+    }
+
+    if ( xc_pmuprof_start(xch, event, period) )
+    {
+        if ( errno == EBUSY )
+            fprintf(stderr, "The PMU is in use: the profiler is already "
+                    "running, or xenoprof or the vPMU are in use\n");
+        else
+            perror("Starting the profiler");
+        goto out;
+    }
+    started = 1;
+
+    if ( xc_pmuprof_status(xch, &running, &fh.event, &fh.period,
+                           &nr_frames) )
+    {
+        perror("Getting the profiler's status");
+        goto out;
+    }
+
+    fmem = xenforeignmemory_open(NULL, 0);
+    nr_cpus = info.max_cpu_id + 1;
+    rings = calloc(nr_cpus, sizeof(*rings));
+    if ( !fmem || !rings )
+    {
+        perror("Mapping the rings");
+        goto out;
+    }
+
+    for ( cpu = 0; cpu < nr_cpus; cpu++ )
+        if ( map_ring(fmem, cpu, &rings[cpu]) < 0 )
+        {
+            fprintf(stderr, "Mapping the ring of CPU%u: %s\n", cpu,
+                    strerror(errno));
+            goto out;
+        }
+
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    fprintf(stderr, "Sampling every %"PRIu64" %s, %s\n", fh.period,
+            event_name(fh.event),
+            seconds ? "until the time is up" : "until interrupted");
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        usleep(POLL_MS * 1000);
+
+        for ( cpu = 0; cpu < nr_cpus; cpu++ )
+            if ( rings[cpu].header && drain_ring(&rings[cpu], f, &fh) )
+            {
+                perror(output);
+                goto out;
+            }
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+    } while ( !interrupted &&
+              (!seconds || now.tv_sec - start.tv_sec < seconds) );
+
+    xc_pmuprof_stop(xch);
+    started = 0;
+
+    for ( cpu = 0; cpu < nr_cpus; cpu++ )
+        if ( rings[cpu].header && drain_ring(&rings[cpu], f, &fh) )
+        {
+            perror(output);
+            goto out;
+        }
+
+    /* Now that the counts are known */
+    if ( fseek(f, 0, SEEK_SET) || fwrite(&fh, sizeof(fh), 1, f) != 1 )
+    {
+        perror(output);
+        goto out;
+    }
+
+    fprintf(stderr, "%"PRIu64" samples written to %s, %"PRIu64" lost\n",
+            fh.nr_samples, output, fh.lost);
+    rc = 0;
+
+ out:
+    if ( started )
+        xc_pmuprof_stop(xch);
+    if ( rings )
+        for ( cpu = 0; cpu < nr_cpus; cpu++ )
+            unmap_ring(fmem, &rings[cpu]);
+    free(rings);
+    if ( fmem )
+        xenforeignmemory_close(fmem);
+    if ( fclose(f) && !rc )
+    {
+        perror(output);
+        rc = 1;
+    }
+
+    return rc;
+}
+
+/* Reporting */
+
+static uint64_t hash(const char *s)
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
+
+    while ( *s )
+        h = (h ^ (unsigned char)*s++) * 0x100000001b3ULL;
+
+    return h;
+}
+
+static int tally_add(struct tally *t, const char *key)
+{
+    size_t i;
+
+    if ( t->used * 2 >= t->size )
+    {
+        struct tally old = *t;
+
+        t->size = old.size ? old.size * 2 : 1024;
+        t->used = 0;
+        t->entries = calloc(t->size, sizeof(*t->entries));
+        if ( !t->entries )
+            return -1;
+
+        for ( i = 0; i < old.size; i++ )
+        {
+            struct tally_entry *e;
+
+            if ( !old.entries[i].key )
+                continue;
+
+            e = &t->entries[hash(old.entries[i].key) & (t->size - 1)];
+            while ( e->key )
+                e = e == &t->entries[t->size - 1] ? t->entries : e + 1;
+            *e = old.entries[i];
+            t->used++;
+        }
+        free(old.entries);
+    }
+
+    for ( i = hash(key) & (t->size - 1); t->entries[i].key;
+          i = (i + 1) & (t->size - 1) )
+        if ( !strcmp(t->entries[i].key, key) )
+        {
+            t->entries[i].count++;
+            return 0;
+        }
+
+    t->entries[i].key = strdup(key);
+    if ( !t->entries[i].key )
+        return -1;
+    t->entries[i].count = 1;
+    t->used++;
+
+    return 0;
+}
+
+static int tally_cmp(const void *a, const void *b)
+{
+    const struct tally_entry *x = a, *y = b;
+
+    if ( x->count != y->count )
+        return x->count > y->count ? -1 : 1;
+    if ( !x->key || !y->key )
+        return !x->key - !y->key;
+    return strcmp(x->key, y->key);
+}
+
+/* Sort by decreasing count, with the free entries at the end. */
+static void tally_sort(struct tally *t)
+{
+    qsort(t->entries, t->size, sizeof(*t->entries), tally_cmp);
+}
+
+static void format_domain(char *buf, size_t len,
+                          const xen_pmuprof_record_t *rec)
+{
+    if ( rec->domid == DOMID_IDLE )
+        snprintf(buf, len, "idle");
+    else
+        snprintf(buf, len, "d%u", rec->domid);
+}
+
+static const char *mode_name(const xen_pmuprof_record_t *rec)
+{
+    return rec->mode < ARRAY_SIZE(mode_names) ? mode_names[rec->mode]
+                                               : "[unknown]";
+}
+
+/* The symbol of a Xen address, with its offset if off */
+static void format_addr(char *buf, size_t len, uint64_t addr, int off)
+{
+    const struct sym *sym = lookup_sym(addr);
+
+    if ( !sym )
+        snprintf(buf, len, "[unknown]");
+    else if ( off )
+        snprintf(buf, len, "%s+%#"PRIx64, sym->name, addr - sym->addr);
+    else
+        snprintf(buf, len, "%s", sym->name);
+}
+
+static int report_top(struct tally *t, const xen_pmuprof_record_t *rec)
+{
+    char key[160], dom[16];
+
+    format_domain(dom, sizeof(dom), rec);
+    if ( rec->mode == XEN_PMUPROF_MODE_xen )
+        format_addr(key, sizeof(key), rec->ip, 0);
+    else
+        snprintf(key, sizeof(key), "%s %s", mode_name(rec), dom);
+
+    return tally_add(t, key);
+}
+
+/* Outermost first: the domain, Xen or the guest, then Xen's callers */
+static int report_folded(struct tally *t, const xen_pmuprof_record_t *rec)
+{
+    char key[(XEN_PMUPROF_MAX_CALLERS + 3) * 64], name[128];
+    unsigned int i, nr = rec->nr_callers;
+    size_t len;
+
+    format_domain(key, sizeof(key), rec);
+    len = strlen(key);
+    len += snprintf(key + len, sizeof(key) - len, ";%s", mode_name(rec));
+
+    if ( rec->mode == XEN_PMUPROF_MODE_xen )
+    {
+        if ( nr > XEN_PMUPROF_MAX_CALLERS )
+            nr = XEN_PMUPROF_MAX_CALLERS;
+
+        for ( i = nr; i-- > 0 && len < sizeof(key); )
+        {
+            format_addr(name, sizeof(name), rec->callers[i], 0);
+            len += snprintf(key + len, sizeof(key) - len, ";%s", name);
+        }
+        if ( len < sizeof(key) )
+        {
+            format_addr(name, sizeof(name), rec->ip, 0);
+            snprintf(key + len, sizeof(key) - len, ";%s", name);
+        }
+    }
+
+    return tally_add(t, key);
+}
+
+static void report_perf(const struct file_header *fh,
+                        const struct file_sample *s)
+{
+    const xen_pmuprof_record_t *rec = &s->rec;
+    unsigned int i, nr = rec->nr_callers;
+    char comm[16], name[160];
+
+    format_domain(comm, sizeof(comm), rec);
+    printf("%s %u/%u [%03u] %"PRIu64".%06"PRIu64": %"PRIu64" %s:\n",
+           comm, rec->domid, rec->vcpu, s->cpu, rec->time / 1000000000,
+           (rec->time % 1000000000) / 1000, fh->period,
+           event_name(fh->event));
+
+    if ( rec->mode != XEN_PMUPROF_MODE_xen )
+    {
+        printf("\t%16"PRIx64" [unknown] (%s)\n\n", rec->ip, mode_name(rec));
+        return;
+    }
+
+    format_addr(name, sizeof(name), rec->ip, 1);
+    printf("\t%16"PRIx64" %s (xen-syms)\n", rec->ip, name);
+
+    if ( nr > XEN_PMUPROF_MAX_CALLERS )
+        nr = XEN_PMUPROF_MAX_CALLERS;
+    for ( i = 0; i < nr; i++ )
+    {
+        format_addr(name, sizeof(name), rec->callers[i], 1);
+        printf("\t%16"PRIx64" %s (xen-syms)\n", rec->callers[i], name);
+    }
+    printf("\n");
+}
+
+static int read_syms(FILE *f, unsigned int n)
+{
+    char name[256];
+    unsigned int i;
+
+    for ( i = 0; i < n; i++ )
+    {
+        struct file_sym fs;
+
+        if ( fread(&fs, sizeof(fs), 1, f) != 1 ||
+             fs.namelen >= sizeof(name) ||
+             fread(name, fs.namelen, 1, f) != 1 ||
+             add_sym(fs.addr, name, fs.namelen) )
+            return -1;
+    }
+
+    /* Recorded in order, but don't rely on it. */
+    qsort(syms, nr_syms, sizeof(*syms), sym_cmp);
+
+    return 0;
+}
+
+static int report_func(int argc, char *argv[])
+{
+    enum { TOP, PERF, FOLDED } format = TOP;
+    struct tally t = { 0 };
+    struct file_header fh;
+    struct file_sample s;
+    unsigned int top = 30;
+    uint64_t total = 0;
+    size_t i;
+    int opt, rc = 1;
+    FILE *f;
+
+    optind = 0;
+    while ( (opt = getopt(argc, argv, "f:n:")) != -1 )
+    {
+        switch ( opt )
+        {
+        case 'f':
+            if ( !strcmp(optarg, "top") )
+                format = TOP;
+            else if ( !strcmp(optarg, "perf") )
+                format = PERF;
+            else if ( !strcmp(optarg, "folded") )
+                format = FOLDED;
+            else
+            {
+                fprintf(stderr, "Unknown format '%s'\n", optarg);
+                return 1;
+            }
+            break;
+        case 'n':
+            top = strtoul(optarg, NULL, 0);
+            break;
+        default:
+            show_help();
+            return 1;
+        }
+    }
+
+    if ( optind != argc - 1 )
+    {
+        show_help();
+        return 1;
+    }
+
+    f = fopen(argv[optind], "r");
+    if ( !f )
+    {
+        perror(argv[optind]);
+        return 1;
+    }
+
+    if ( fread(&fh, sizeof(fh), 1, f) != 1 || fh.magic != FILE_MAGIC ||
+         fh.version != FILE_VERSION )
+    {
+        fprintf(stderr, "%s: not a xenpmuprof file\n", argv[optind]);
+        goto out;
+    }
+
+    if ( read_syms(f, fh.nr_syms) )
+    {
+        fprintf(stderr, "%s: bad symbol table\n", argv[optind]);
+        goto out;
+    }
+
+    while ( fread(&s, sizeof(s), 1, f) == 1 )
+    {
+        total++;
+
+        switch ( format )
+        {
+        case TOP:
+            if ( report_top(&t, &s.rec) )
+                goto nomem;
+            break;
+        case FOLDED:
+            if ( report_folded(&t, &s.rec) )
+                goto nomem;
+            break;
+        case PERF:
+            report_perf(&fh, &s);
+            break;
+        }
+    }
+
+    switch ( format )
+    {
+    case TOP:
+        tally_sort(&t);
+        printf("Samples: %"PRIu64" of %s, every %"PRIu64", %"PRIu64
+               " lost\n\n", total, event_name(fh.event), fh.period, fh.lost);
+        printf("Overhead   Samples  Where\n");
+        for ( i = 0; i < t.size && i < top && t.entries[i].key; i++ )
+            printf("%7.2f%%  %8"PRIu64"  %s\n",
+                   100.0 * t.entries[i].count / total, t.entries[i].count,
+                   t.entries[i].key);
+        break;
+
+    case FOLDED:
+        for ( i = 0; i < t.size; i++ )
+            if ( t.entries[i].key )
+                printf("%s %"PRIu64"\n", t.entries[i].key,
+                       t.entries[i].count);
+        break;
+
+    case PERF:
+        break;
+    }
+
+    rc = 0;
+    goto out;
+
+ nomem:
+    perror("report");
+ out:
+    for ( i = 0; i < t.size; i++ )
+        free(t.entries[i].key);
+    free(t.entries);
+    fclose(f);
+
+    return rc;
+}
+
+/* Control */
+
+static int status_func(int argc, char *argv[])
+{
+    uint32_t running, event, nr_frames;
+    uint64_t period;
+
+    if ( xc_pmuprof_status(xch, &running, &event, &period, &nr_frames) )
+    {
+        perror("Getting the profiler's status");
+        return 1;
+    }
+
+    printf("%s", running ? "Running" : "Stopped");
+    if ( period )
+        printf(", sampling every %"PRIu64" %s into rings of %u frames",
+               period, event_name(event), nr_frames);
+    printf("\n");
+
+    return 0;
+}
+
+static int stop_func(int argc, char *argv[])
+{
+    if ( xc_pmuprof_stop(xch) )
+    {
+        perror("Stopping the profiler");
+        return 1;
+    }
+
+    return 0;
+}
+
+static int help_func(int argc, char *argv[])
+{
+    show_help();
+    return 0;
+}
+
+static const struct {
+    const char *name;
+    int (*function)(int argc, char *argv[]);
+    int needs_xen;
+} main_options[] = {
+    { "help",   help_func,   0 },
+    { "record", record_func, 1 },
+    { "report", report_func, 0 },
+    { "status", status_func, 1 },
+    { "stop",   stop_func,   1 },
+};
+
+int main(int argc, char *argv[])
+{
+    unsigned int i;
+    int ret;
+
+    if ( argc <= 1 )
+    {
+        show_help();
+        return 0;
+    }
+
+    for ( i = 0; i < ARRAY_SIZE(main_options); i++ )
+        if ( !strcmp(main_options[i].name, argv[1]) )
+            break;
+
+    if ( i == ARRAY_SIZE(main_options) )
+    {
+        fprintf(stderr, "Unrecognised command '%s' -- try "
+                "'xenpmuprof help'\n", argv[1]);
+        return 1;
+    }
+
+    if ( main_options[i].needs_xen )
+    {
+        xch = xc_interface_open(0, 0, 0);
+        if ( !xch )
+        {
+            fprintf(stderr, "failed to get the handler\n");
+            return 1;
+        }
+    }
+
+    ret = main_options[i].function(argc - 1, argv + 1);
+
+    if ( xch )
+        xc_interface_close(xch);
+
+    return ret;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
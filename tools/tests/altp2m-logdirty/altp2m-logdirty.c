@@ -0,0 +1,300 @@
+/*
+ * altp2m-logdirty.c
+ *
+ * Measure the cost of log-dirty tracking of an HVM guest with altp2m views.
+ * A number of views are created, log-dirty mode is enabled as for a live
+ * migration, and the dirty bitmap is cleaned at regular intervals while the
+ * guest runs its workload.  For every round, the pages dirtied are reported
+ * along with the guest's EPT violation (or NPF) exits, from the per-domain
+ * VM exit counters, and, if Xen has been built with performance counters,
+ * how host p2m changes were propagated to the views.
+ *
+ * With deferred propagation ("altp2m-lazy-propagate", the default) the view
+ * the guest runs on is updated right away, so each dirtied page costs one
+ * exit, as without altp2m.  The other views are only marked stale, instead
+ * of being written to and flushed for every page.  Boot Xen with
+ * "altp2m-lazy-propagate=0" to compare.
+ *
+ * The guest must have been created with altp2m enabled (altp2m="external"
+ * or "mixed").
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <xenctrl.h>
+
+#define DEFAULT_VIEWS     4
+#define DEFAULT_ROUNDS    10
+#define DEFAULT_INTERVAL  100   /* ms */
+#define MAX_VIEWS         9     /* MAX_ALTP2M - 1, view 0 being the host's. */
+
+#define VMX_EXIT_EPT_VIOLATION 48
+
+/* altp2m perf counters reported, by their description. */
+static const char *const counters[] = {
+    "altp2m: changes propagated",
+    "altp2m: propagations not needed",
+    "altp2m: propagations deferred",
+    "altp2m: stale entries fixed up",
+};
+#define NR_COUNTERS (sizeof(counters) / sizeof(counters[0]))
+
+/*
+ * Read the counters listed above (summed over all pCPUs).  Returns -1 if
+ * performance counters are not available.
+ */
+static int read_counters(xc_interface *xch, uint64_t *vals)
+{
+    DECLARE_HYPERCALL_BUFFER(xc_perfc_desc_t, pcd);
+    DECLARE_HYPERCALL_BUFFER(xc_perfc_val_t, pcv);
+    int num_desc, num_val, i, j, rc = -1;
+    unsigned int c, v;
+
+    if ( xc_perfc_query_number(xch, &num_desc, &num_val) )
+        return -1;
+
+    pcd = xc_hypercall_buffer_alloc(xch, pcd, sizeof(*pcd) * num_desc);
+    pcv = xc_hypercall_buffer_alloc(xch, pcv, sizeof(*pcv) * num_val);
+    if ( !pcd || !pcv )
+        goto out;
+
+    if ( xc_perfc_query(xch, HYPERCALL_BUFFER(pcd), HYPERCALL_BUFFER(pcv)) )
+        goto out;
+
+    memset(vals, 0, sizeof(*vals) * NR_COUNTERS);
+    for ( i = 0, v = 0; i < num_desc; v += pcd[i++].nr_vals )
+        for ( c = 0; c < NR_COUNTERS; c++ )
+            if ( !strcmp(pcd[i].name, counters[c]) )
+                for ( j = 0; j < pcd[i].nr_vals; j++ )
+                    vals[c] += pcv[v + j];
+    rc = 0;
+
+ out:
+    xc_hypercall_buffer_free(xch, pcd);
+    xc_hypercall_buffer_free(xch, pcv);
+
+    return rc;
+}
+
+/* Number of second level page fault exits of all of domid's vCPUs. */
+static int read_faults(xc_interface *xch, uint32_t domid, uint64_t *faults)
+{
+    static xc_vmexit_reason_t reasons[XEN_SYSCTL_VMEXIT_REASONS];
+    uint32_t vendor;
+
+    if ( xc_vmexit_stats_get(xch, domid, XEN_SYSCTL_VMEXIT_STATS_all_vcpus,
+                             &vendor, reasons) )
+        return -1;
+
+    *faults = reasons[vendor == XEN_SYSCTL_VMEXIT_STATS_svm
+                      ? XEN_SYSCTL_VMEXIT_SVM_NPF
+                      : VMX_EXIT_EPT_VIOLATION].count;
+
+    return 0;
+}
+
+static int usage(const char *prog)
+{
+    printf("usage: %s [-v views] [-r rounds] [-i interval] domid\n", prog);
+    printf("  -v views     altp2m views to create (1-%u, default %u)\n",
+           MAX_VIEWS, DEFAULT_VIEWS);
+    printf("  -r rounds    log-dirty rounds (default %u)\n", DEFAULT_ROUNDS);
+    printf("  -i interval  ms between cleaning the bitmap (default %u)\n",
+           DEFAULT_INTERVAL);
+    return 1;
+}
+
+int main(int argc, char *argv[])
+{
+    DECLARE_HYPERCALL_BUFFER(unsigned long, bitmap);
+    xc_interface *xch;
+    xc_dominfo_t info;
+    xc_shadow_op_stats_t stats;
+    xen_pfn_t max_gpfn;
+    unsigned long p2m_size, bitmap_pages = 0;
+    unsigned int nr_views = DEFAULT_VIEWS, rounds = DEFAULT_ROUNDS;
+    unsigned int interval = DEFAULT_INTERVAL, created = 0, i, c;
+    uint16_t views[MAX_VIEWS];
+    uint64_t before[NR_COUNTERS], after[NR_COUNTERS], total[NR_COUNTERS] = {};
+    uint64_t faults_before, faults_after, dirty = 0, faults = 0;
+    uint32_t domid;
+    bool altp2m = false, logdirty = false, perfc;
+    int opt, rc = 1;
+
+    while ( (opt = getopt(argc, argv, "v:r:i:")) != -1 )
+    {
+        switch ( opt )
+        {
+        case 'v':
+            nr_views = strtoul(optarg, NULL, 0);
+            break;
+        case 'r':
+            rounds = strtoul(optarg, NULL, 0);
+            break;
+        case 'i':
+            interval = strtoul(optarg, NULL, 0);
+            break;
+        default:
+            return usage(argv[0]);
+        }
+    }
+
+    if ( optind != argc - 1 || !nr_views || nr_views > MAX_VIEWS ||
+         !rounds || !interval )
+        return usage(argv[0]);
+    domid = strtoul(argv[optind], NULL, 0);
+
+    xch = xc_interface_open(NULL, NULL, 0);
+    if ( !xch )
+    {
+        perror("xc_interface_open");
+        return 1;
+    }
+
+    if ( xc_domain_getinfo(xch, domid, 1, &info) != 1 ||
+         info.domid != domid || !info.hvm )
+    {
+        fprintf(stderr, "d%u is not an HVM domain\n", domid);
+        goto out;
+    }
+
+    if ( xc_domain_maximum_gpfn(xch, domid, &max_gpfn) < 0 )
+    {
+        perror("xc_domain_maximum_gpfn");
+        goto out;
+    }
+    p2m_size = max_gpfn + 1;
+    bitmap_pages = (p2m_size + 8 * XC_PAGE_SIZE - 1) / (8 * XC_PAGE_SIZE);
+
+    bitmap = xc_hypercall_buffer_alloc_pages(xch, bitmap, bitmap_pages);
+    if ( !bitmap )
+    {
+        perror("xc_hypercall_buffer_alloc_pages");
+        goto out;
+    }
+
+    if ( xc_altp2m_set_domain_state(xch, domid, true) )
+    {
+        perror("xc_altp2m_set_domain_state");
+        goto out;
+    }
+    altp2m = true;
+
+    for ( ; created < nr_views; created++ )
+        if ( xc_altp2m_create_view(xch, domid, XENMEM_access_default,
+                                   &views[created]) )
+        {
+            perror("xc_altp2m_create_view");
+            goto out;
+        }
+
+    if ( xc_shadow_control(xch, domid, XEN_DOMCTL_SHADOW_OP_ENABLE_LOGDIRTY,
+                           NULL, 0, NULL, 0, NULL) < 0 )
+    {
+        perror("enable log-dirty");
+        goto out;
+    }
+    logdirty = true;
+
+    /* Start from a clean bitmap. */
+    if ( xc_shadow_control(xch, domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
+                           HYPERCALL_BUFFER(bitmap), p2m_size,
+                           NULL, 0, &stats) != p2m_size )
+    {
+        perror("clean log-dirty bitmap");
+        goto out;
+    }
+
+    perfc = !read_counters(xch, before);
+
+    printf("d%u, %u altp2m views, %u ms rounds\n", domid, nr_views, interval);
+    printf("%5s %10s %10s %8s", "round", "dirty", "faults", "f/page");
+    if ( perfc )
+        printf(" %10s %10s %10s %10s", "sync", "skipped", "deferred",
+               "fixed-up");
+    printf("\n");
+
+    for ( i = 0; i < rounds; i++ )
+    {
+        if ( read_faults(xch, domid, &faults_before) )
+        {
+            perror("xc_vmexit_stats_get");
+            goto out;
+        }
+
+        usleep(interval * 1000);
+
+        if ( read_faults(xch, domid, &faults_after) )
+        {
+            perror("xc_vmexit_stats_get");
+            goto out;
+        }
+
+        /* Collect this round's dirty pages, and re-arm tracking. */
+        if ( xc_shadow_control(xch, domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
+                               HYPERCALL_BUFFER(bitmap), p2m_size,
+                               NULL, 0, &stats) != p2m_size )
+        {
+            perror("clean log-dirty bitmap");
+            goto out;
+        }
+
+        dirty += stats.dirty_count;
+        faults += faults_after - faults_before;
+
+        printf("%5u %10u %10"PRIu64" %8.2f", i, stats.dirty_count,
+               faults_after - faults_before,
+               stats.dirty_count ? (double)(faults_after - faults_before) /
+                                   stats.dirty_count : 0.0);
+
+        if ( perfc && !read_counters(xch, after) )
+            for ( c = 0; c < NR_COUNTERS; c++ )
+            {
+                printf(" %10"PRIu64, after[c] - before[c]);
+                total[c] += after[c] - before[c];
+                before[c] = after[c];
+            }
+        printf("\n");
+    }
+
+    printf("%5s %10"PRIu64" %10"PRIu64" %8.2f", "total", dirty, faults,
+           dirty ? (double)faults / dirty : 0.0);
+    if ( perfc )
+        for ( c = 0; c < NR_COUNTERS; c++ )
+            printf(" %10"PRIu64, total[c]);
+    printf("\n");
+
+    rc = 0;
+
+ out:
+    if ( logdirty )
+        xc_shadow_control(xch, domid, XEN_DOMCTL_SHADOW_OP_OFF,
+                          NULL, 0, NULL, 0, NULL);
+    while ( created-- )
+        xc_altp2m_destroy_view(xch, domid, views[created]);
+    if ( altp2m )
+        xc_altp2m_set_domain_state(xch, domid, false);
+    xc_hypercall_buffer_free_pages(xch, bitmap, bitmap_pages);
+    xc_interface_close(xch);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,187 @@
+/*
+ * evtchn-batch-bench.c
+ *
+ * Microbenchmark comparing per-port EVTCHNOP_send notifications with
+ * EVTCHNOP_send_batch.  A number of loopback event channels are bound in
+ * the calling domain and notified repeatedly, either one hypercall per port
+ * or one hypercall per batch.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <xenctrl.h>
+#include <xenevtchn.h>
+
+#define DEFAULT_PORTS      16
+#define DEFAULT_ITERATIONS 10000
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/*
+ * Consume and unmask the notifications raised by one round.  Every local
+ * port fires exactly once per round, and xenevtchn_pending() blocks when
+ * nothing is outstanding, so read no more than were sent.
+ */
+static int drain(xenevtchn_handle *xce, unsigned int nr)
+{
+    xenevtchn_port_or_error_t port;
+
+    while ( nr-- )
+    {
+        port = xenevtchn_pending(xce);
+        if ( port < 0 )
+            return -1;
+        xenevtchn_unmask(xce, port);
+    }
+
+    return 0;
+}
+
+static int usage(const char *prog)
+{
+    printf("usage: %s [nr-ports [iterations]]\n", prog);
+    printf("  nr-ports    number of loopback channels (1-%u, default %u)\n",
+           EVTCHN_SEND_BATCH_MAX, DEFAULT_PORTS);
+    printf("  iterations  rounds of notifications (default %u)\n",
+           DEFAULT_ITERATIONS);
+    return 1;
+}
+
+int main(int argc, char *argv[])
+{
+    xc_interface *xch = NULL;
+    xenevtchn_handle *xce = NULL;
+    evtchn_port_t local[EVTCHN_SEND_BATCH_MAX];
+    evtchn_port_t remote[EVTCHN_SEND_BATCH_MAX];
+    unsigned int nr_ports = DEFAULT_PORTS, iterations = DEFAULT_ITERATIONS;
+    unsigned int i, j, bound = 0;
+    uint64_t start, single_ns = 0, batch_ns = 0;
+    int rc = 1;
+
+    if ( argc > 3 )
+        return usage(argv[0]);
+    if ( argc > 1 )
+        nr_ports = strtoul(argv[1], NULL, 0);
+    if ( argc > 2 )
+        iterations = strtoul(argv[2], NULL, 0);
+    if ( !nr_ports || nr_ports > EVTCHN_SEND_BATCH_MAX || !iterations )
+        return usage(argv[0]);
+
+    xch = xc_interface_open(NULL, NULL, 0);
+    if ( !xch )
+    {
+        perror("xc_interface_open");
+        goto out;
+    }
+
+    xce = xenevtchn_open(NULL, 0);
+    if ( !xce )
+    {
+        perror("xenevtchn_open");
+        goto out;
+    }
+
+    /* Build loopback channels: notifying remote[i] raises local[i]. */
+    for ( bound = 0; bound < nr_ports; bound++ )
+    {
+        xenevtchn_port_or_error_t p;
+
+        p = xenevtchn_bind_unbound_port(xce, DOMID_SELF);
+        if ( p < 0 )
+        {
+            perror("xenevtchn_bind_unbound_port");
+            goto out;
+        }
+        local[bound] = p;
+
+        p = xenevtchn_bind_interdomain(xce, DOMID_SELF, local[bound]);
+        if ( p < 0 )
+        {
+            perror("xenevtchn_bind_interdomain");
+            xenevtchn_unbind(xce, local[bound]);
+            goto out;
+        }
+        remote[bound] = p;
+    }
+
+    for ( i = 0; i < iterations; i++ )
+    {
+        start = now_ns();
+        for ( j = 0; j < nr_ports; j++ )
+            if ( xenevtchn_notify(xce, remote[j]) )
+            {
+                perror("xenevtchn_notify");
+                goto out;
+            }
+        single_ns += now_ns() - start;
+
+        if ( drain(xce, nr_ports) )
+        {
+            perror("xenevtchn_pending");
+            goto out;
+        }
+
+        start = now_ns();
+        if ( xc_evtchn_send_batch(xch, remote, nr_ports, NULL) )
+        {
+            perror("xc_evtchn_send_batch");
+            goto out;
+        }
+        batch_ns += now_ns() - start;
+
+        if ( drain(xce, nr_ports) )
+        {
+            perror("xenevtchn_pending");
+            goto out;
+        }
+    }
+
+    printf("%u ports, %u iterations\n", nr_ports, iterations);
+    printf("  EVTCHNOP_send:       %8"PRIu64" ns/round, %6"PRIu64" ns/port\n",
+           single_ns / iterations, single_ns / iterations / nr_ports);
+    printf("  EVTCHNOP_send_batch: %8"PRIu64" ns/round, %6"PRIu64" ns/port\n",
+           batch_ns / iterations, batch_ns / iterations / nr_ports);
+
+    rc = 0;
+
+ out:
+    if ( xce )
+    {
+        while ( bound-- )
+        {
+            xenevtchn_unbind(xce, remote[bound]);
+            xenevtchn_unbind(xce, local[bound]);
+        }
+        xenevtchn_close(xce);
+    }
+    if ( xch )
+        xc_interface_close(xch);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,251 @@
+/*
+ * unshare-latency.c
+ *
+ * Measure the latency of unsharing (copy-on-write breaking) a shared page
+ * as a function of the number of gfns sharing it.
+ *
+ * For each sharer count N, N consecutive gfns of the client domain are
+ * shared with a single gfn of the source domain, so that one frame backs
+ * N + 1 gfns.  Then client gfns are unshared one at a time, by grabbing a
+ * writable foreign mapping as "memshrtool unshare" does, and the time each
+ * of them takes is recorded.  The time to map a private page is reported as
+ * a baseline for the mapping overhead.
+ *
+ * This overwrites the client gfns with the contents of the source gfn: use
+ * scratch domains, with sharing enabled, only.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#define XC_WANT_COMPAT_MAP_FOREIGN_API
+#include <xenctrl.h>
+
+#define DEFAULT_SAMPLES  256
+#define BATCH            256
+
+static const unsigned int default_counts[] = { 1, 16, 64, 256, 1024, 4096 };
+#define NR_DEFAULT_COUNTS (sizeof(default_counts) / sizeof(default_counts[0]))
+
+static xc_interface *xch;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+/* Grab (and drop) a writable mapping of gfn, returning the time it took. */
+static int map_writable(uint32_t domid, unsigned long gfn, uint64_t *ns)
+{
+    uint64_t start = now_ns();
+    void *map = xc_map_foreign_range(xch, domid, XC_PAGE_SIZE,
+                                     PROT_READ | PROT_WRITE, gfn);
+
+    if ( !map )
+        return -1;
+
+    *ns = now_ns() - start;
+    munmap(map, XC_PAGE_SIZE);
+
+    return 0;
+}
+
+/* Make nr client gfns starting at cgfn share the frame backing sgfn. */
+static int share_range(uint32_t sdom, unsigned long sgfn,
+                       uint32_t cdom, unsigned long cgfn, unsigned int nr)
+{
+    xc_memshr_batch_entry_t entries[BATCH];
+    unsigned int i, n, done;
+    uint64_t sh;
+
+    for ( done = 0; done < nr; done += n )
+    {
+        n = nr - done < BATCH ? nr - done : BATCH;
+
+        /* Returns the current handle if the gfn is shared already. */
+        if ( xc_memshr_nominate_gfn(xch, sdom, sgfn, &sh) )
+            return -1;
+
+        memset(entries, 0, sizeof(entries));
+        for ( i = 0; i < n; i++ )
+        {
+            entries[i].source_gfn = sgfn;
+            entries[i].source_handle = sh;
+            entries[i].client_gfn = cgfn + done + i;
+            if ( xc_memshr_nominate_gfn(xch, cdom, entries[i].client_gfn,
+                                        &entries[i].client_handle) )
+                return -1;
+        }
+
+        if ( xc_memshr_share_batch(xch, sdom, cdom, entries, n) )
+            return -1;
+
+        for ( i = 0; i < n; i++ )
+            if ( entries[i].rc )
+            {
+                errno = -entries[i].rc;
+                return -1;
+            }
+    }
+
+    return 0;
+}
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [-n samples] <source-domid> <source-gfn> "
+           "<client-domid> <client-gfn> [sharers...]\n", prog);
+    printf("  sharers    numbers of client gfns to share (default 1 16 64 "
+           "256 1024 4096)\n");
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int samples = DEFAULT_SAMPLES, nr_counts, *counts = NULL;
+    unsigned int i, j, n, max = 0;
+    unsigned long sgfn, cgfn;
+    uint32_t sdom, cdom;
+    uint64_t *lat = NULL, total, base;
+    int opt, rc = 1;
+
+    while ( (opt = getopt(argc, argv, "n:h")) != -1 )
+    {
+        switch ( opt )
+        {
+        case 'n':
+            samples = strtoul(optarg, NULL, 0);
+            break;
+        default:
+            usage(argv[0]);
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    if ( argc - optind < 4 || !samples )
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    sdom = strtoul(argv[optind], NULL, 0);
+    sgfn = strtoul(argv[optind + 1], NULL, 0);
+    cdom = strtoul(argv[optind + 2], NULL, 0);
+    cgfn = strtoul(argv[optind + 3], NULL, 0);
+
+    nr_counts = argc - optind - 4;
+    if ( !nr_counts )
+        nr_counts = NR_DEFAULT_COUNTS;
+    counts = calloc(nr_counts, sizeof(*counts));
+    if ( !counts )
+        goto out;
+    for ( i = 0; i < nr_counts; i++ )
+    {
+        counts[i] = argc - optind > 4 ? strtoul(argv[optind + 4 + i], NULL, 0)
+                                      : default_counts[i];
+        if ( !counts[i] )
+        {
+            usage(argv[0]);
+            goto out;
+        }
+        if ( counts[i] > max )
+            max = counts[i];
+    }
+
+    lat = calloc(samples < max ? samples : max, sizeof(*lat));
+    xch = xc_interface_open(NULL, NULL, 0);
+    if ( !lat || !xch )
+    {
+        perror("setup");
+        goto out;
+    }
+
+    /* Unshare anything left over from a previous run, and get a baseline. */
+    for ( i = 0; i < max; i++ )
+        if ( map_writable(cdom, cgfn + i, &base) )
+        {
+            fprintf(stderr, "mapping d%u gfn %#lx: %s\n",
+                    cdom, cgfn + i, strerror(errno));
+            goto out;
+        }
+    if ( map_writable(cdom, cgfn, &base) )
+        goto out;
+
+    printf("baseline (private page) %"PRIu64" ns\n", base);
+    printf("%8s %8s %10s %10s %10s %10s\n",
+           "sharers", "samples", "avg ns", "p50 ns", "p99 ns", "max ns");
+
+    for ( i = 0; i < nr_counts; i++ )
+    {
+        if ( share_range(sdom, sgfn, cdom, cgfn, counts[i]) )
+        {
+            fprintf(stderr, "sharing %u gfns: %s\n", counts[i],
+                    strerror(errno));
+            goto out;
+        }
+
+        /* Time the first unshares, while the page is still widely shared. */
+        n = samples < counts[i] ? samples : counts[i];
+        for ( j = 0, total = 0; j < counts[i]; j++ )
+        {
+            uint64_t ns;
+
+            if ( map_writable(cdom, cgfn + j, &ns) )
+            {
+                fprintf(stderr, "unsharing d%u gfn %#lx: %s\n",
+                        cdom, cgfn + j, strerror(errno));
+                goto out;
+            }
+            if ( j < n )
+            {
+                lat[j] = ns;
+                total += ns;
+            }
+        }
+
+        qsort(lat, n, sizeof(*lat), cmp_u64);
+        printf("%8u %8u %10"PRIu64" %10"PRIu64" %10"PRIu64" %10"PRIu64"\n",
+               counts[i], n, total / n, lat[n / 2],
+               lat[(n * 99ull) / 100], lat[n - 1]);
+    }
+
+    rc = 0;
+
+ out:
+    if ( xch )
+        xc_interface_close(xch);
+    free(lat);
+    free(counts);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,305 @@
+/*
+ * sched-latency.c
+ *
+ * Measure wakeup-to-run latency of dom0 vCPUs.  Two threads, pinned to
+ * different vCPUs, ping-pong notifications over a loopback event channel.
+ * The receiving thread blocks in the kernel, so its vCPU goes idle and has
+ * to be woken up and scheduled by Xen for every notification.  Half of the
+ * round trip time approximates the wakeup-to-run latency, and the
+ * distribution is reported to compare scheduler configurations (e.g.
+ * credit2_runqueue=socket vs. llc, or sched-gran=cpu vs. core).
+ *
+ * If Xen has been built with performance counters, the number of context
+ * switches and of scheduling rendezvous skipped (for sched-gran=core or
+ * socket) during the run is reported as well.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <xenctrl.h>
+#include <xenevtchn.h>
+
+#define DEFAULT_ITERATIONS 10000
+
+/* Scheduler perf counters reported, by their description. */
+static const char *const counters[] = {
+    "sched: context switches",
+    "sched: rendezvous skipped (idle)",
+};
+#define NR_COUNTERS (sizeof(counters) / sizeof(counters[0]))
+
+struct endpoint {
+    xenevtchn_handle *xce;
+    evtchn_port_t local;   /* Port we wait on. */
+    evtchn_port_t remote;  /* Port we notify. */
+    int cpu;
+};
+
+static unsigned int iterations = DEFAULT_ITERATIONS;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static int pin(int cpu)
+{
+    cpu_set_t set;
+
+    if ( cpu < 0 )
+        return 0;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+
+    return sched_setaffinity(0, sizeof(set), &set);
+}
+
+/* Block until the local port fires, then unmask it again. */
+static int wait_event(struct endpoint *ep)
+{
+    struct pollfd pfd = { .fd = xenevtchn_fd(ep->xce), .events = POLLIN };
+    xenevtchn_port_or_error_t port;
+
+    for ( ; ; )
+    {
+        if ( poll(&pfd, 1, -1) < 0 )
+        {
+            if ( errno == EINTR )
+                continue;
+            return -1;
+        }
+
+        port = xenevtchn_pending(ep->xce);
+        if ( port < 0 )
+            continue;
+
+        xenevtchn_unmask(ep->xce, port);
+        if ( port == ep->local )
+            return 0;
+    }
+}
+
+static void *responder(void *arg)
+{
+    struct endpoint *ep = arg;
+    unsigned int i;
+
+    if ( pin(ep->cpu) )
+        perror("sched_setaffinity (responder)");
+
+    for ( i = 0; i < iterations; i++ )
+    {
+        if ( wait_event(ep) || xenevtchn_notify(ep->xce, ep->remote) )
+        {
+            perror("responder");
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Read the counters listed above (summed over all pCPUs).  Returns -1 if
+ * performance counters are not available.
+ */
+static int read_counters(xc_interface *xch, uint64_t *vals)
+{
+    DECLARE_HYPERCALL_BUFFER(xc_perfc_desc_t, pcd);
+    DECLARE_HYPERCALL_BUFFER(xc_perfc_val_t, pcv);
+    int num_desc, num_val, i, j, rc = -1;
+    unsigned int c, v;
+
+    if ( !xch || xc_perfc_query_number(xch, &num_desc, &num_val) )
+        return -1;
+
+    pcd = xc_hypercall_buffer_alloc(xch, pcd, sizeof(*pcd) * num_desc);
+    pcv = xc_hypercall_buffer_alloc(xch, pcv, sizeof(*pcv) * num_val);
+    if ( !pcd || !pcv )
+        goto out;
+
+    if ( xc_perfc_query(xch, HYPERCALL_BUFFER(pcd), HYPERCALL_BUFFER(pcv)) )
+        goto out;
+
+    memset(vals, 0, sizeof(*vals) * NR_COUNTERS);
+    for ( i = 0, v = 0; i < num_desc; v += pcd[i++].nr_vals )
+        for ( c = 0; c < NR_COUNTERS; c++ )
+            if ( !strcmp(pcd[i].name, counters[c]) )
+                for ( j = 0; j < pcd[i].nr_vals; j++ )
+                    vals[c] += pcv[v + j];
+    rc = 0;
+
+ out:
+    xc_hypercall_buffer_free(xch, pcd);
+    xc_hypercall_buffer_free(xch, pcv);
+
+    return rc;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+static int bind_pair(struct endpoint *a, struct endpoint *b)
+{
+    xenevtchn_port_or_error_t port;
+
+    port = xenevtchn_bind_unbound_port(a->xce, DOMID_SELF);
+    if ( port < 0 )
+        return -1;
+    a->local = port;
+
+    port = xenevtchn_bind_interdomain(b->xce, DOMID_SELF, a->local);
+    if ( port < 0 )
+        return -1;
+    b->local = port;
+
+    a->remote = b->local;
+    b->remote = a->local;
+
+    return 0;
+}
+
+static int usage(const char *prog)
+{
+    printf("usage: %s [-n iterations] [cpu-a cpu-b]\n", prog);
+    printf("  cpu-a, cpu-b  dom0 vCPUs to pin the two threads to\n");
+    return 1;
+}
+
+int main(int argc, char *argv[])
+{
+    struct endpoint a = { .cpu = -1 }, b = { .cpu = -1 };
+    xc_interface *xch = NULL;
+    pthread_t thread;
+    uint64_t *samples, start, total = 0;
+    uint64_t before[NR_COUNTERS], after[NR_COUNTERS];
+    unsigned int i, c;
+    int opt, rc = 1, have_counters;
+
+    while ( (opt = getopt(argc, argv, "n:h")) != -1 )
+    {
+        switch ( opt )
+        {
+        case 'n':
+            iterations = strtoul(optarg, NULL, 0);
+            break;
+        default:
+            return usage(argv[0]);
+        }
+    }
+
+    if ( argc - optind == 2 )
+    {
+        a.cpu = atoi(argv[optind]);
+        b.cpu = atoi(argv[optind + 1]);
+    }
+    else if ( argc != optind || !iterations )
+        return usage(argv[0]);
+
+    samples = calloc(iterations, sizeof(*samples));
+    a.xce = xenevtchn_open(NULL, 0);
+    b.xce = xenevtchn_open(NULL, 0);
+    if ( !samples || !a.xce || !b.xce )
+    {
+        perror("setup");
+        goto out;
+    }
+
+    if ( bind_pair(&a, &b) )
+    {
+        perror("binding loopback event channel");
+        goto out;
+    }
+
+    if ( pin(a.cpu) )
+        perror("sched_setaffinity");
+
+    /* Not fatal: only needed for the perf counters. */
+    xch = xc_interface_open(NULL, NULL, 0);
+    have_counters = !read_counters(xch, before);
+
+    if ( pthread_create(&thread, NULL, responder, &b) )
+    {
+        perror("pthread_create");
+        goto out;
+    }
+
+    for ( i = 0; i < iterations; i++ )
+    {
+        start = now_ns();
+        if ( xenevtchn_notify(a.xce, a.remote) || wait_event(&a) )
+        {
+            perror("initiator");
+            break;
+        }
+        samples[i] = (now_ns() - start) / 2;
+        total += samples[i];
+    }
+
+    pthread_join(thread, NULL);
+
+    if ( have_counters && read_counters(xch, after) )
+        have_counters = 0;
+
+    if ( i == iterations )
+    {
+        qsort(samples, iterations, sizeof(*samples), cmp_u64);
+
+        printf("wakeup-to-run latency over %u iterations (ns):\n", iterations);
+        printf("  min %"PRIu64" avg %"PRIu64" p50 %"PRIu64
+               " p99 %"PRIu64" max %"PRIu64"\n",
+               samples[0], total / iterations, samples[iterations / 2],
+               samples[(iterations * 99ull) / 100], samples[iterations - 1]);
+
+        for ( c = 0; have_counters && c < NR_COUNTERS; c++ )
+            printf("  %-34s %10"PRIu64" (%.2f per iteration)\n", counters[c],
+                   after[c] - before[c],
+                   (double)(after[c] - before[c]) / iterations);
+        rc = 0;
+    }
+
+ out:
+    if ( xch )
+        xc_interface_close(xch);
+    if ( b.xce )
+        xenevtchn_close(b.xce);
+    if ( a.xce )
+        xenevtchn_close(a.xce);
+    free(samples);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
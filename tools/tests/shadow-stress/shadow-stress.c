@@ -0,0 +1,243 @@
+/*
+ * shadow-stress.c
+ *
+ * Watch how the shadow pagetable code copes with a guest creating and
+ * writing to large numbers of page tables.
+ *
+ * Run a page table heavy workload inside the guest, e.g. a fork bomb kept
+ * in check ("while :; do /bin/true & done" in a few shells), then point
+ * this at it.  For PV guests, -l enables shadow log-dirty mode, as live
+ * migration does, and cleans the dirty bitmap every interval so that the
+ * shadows are exercised throughout.  The shadow performance counters are
+ * sampled every interval and printed as rates per second.
+ *
+ * Performance counters are host wide and need a hypervisor built with
+ * CONFIG_PERF_COUNTERS: use an otherwise idle host.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <xenctrl.h>
+
+#define DEFAULT_INTERVAL 1
+#define DEFAULT_SAMPLES  10
+
+static const struct counter {
+    const char *desc;   /* As in xen/include/asm-x86/perfc_defn.h */
+    const char *label;
+} counters[] = {
+    { "calls to shadow_fault",              "faults" },
+    { "calls to shadow_hash_lookup",        "lookups" },
+    { "shadow hash misses",                 "misses" },
+    { "shadow hash table resizes",          "resizes" },
+    { "shadow OOS unsyncs",                 "unsyncs" },
+    { "shadow OOS evictions",               "evicts" },
+    { "shadow OOS resyncs",                 "resyncs" },
+    { "shadow OOS lookups hitting first slot", "oos-hit" },
+    { "shadow OOS lookups hitting second slot", "oos-hit2" },
+    { "shadow OOS per-vcpu probes missing", "probe-miss" },
+    { "calls to sh_resync_all",             "resync-all" },
+};
+#define NR_COUNTERS (sizeof(counters) / sizeof(counters[0]))
+
+static xc_interface *xch;
+static volatile sig_atomic_t interrupted;
+
+static void sigint(int sig)
+{
+    interrupted = 1;
+}
+
+/* Sum up the values of the counters of interest.  -1 if not present. */
+static int sample(int64_t *vals)
+{
+    DECLARE_HYPERCALL_BUFFER(xc_perfc_desc_t, pcd);
+    DECLARE_HYPERCALL_BUFFER(xc_perfc_val_t, pcv);
+    xc_perfc_val_t *val;
+    int nr_desc, nr_val, i, j, rc = -1;
+    unsigned int c;
+
+    if ( xc_perfc_query_number(xch, &nr_desc, &nr_val) )
+        return -1;
+
+    pcd = xc_hypercall_buffer_alloc(xch, pcd, sizeof(*pcd) * nr_desc);
+    pcv = xc_hypercall_buffer_alloc(xch, pcv, sizeof(*pcv) * nr_val);
+    if ( !pcd || !pcv )
+        goto out;
+
+    if ( xc_perfc_query(xch, HYPERCALL_BUFFER(pcd), HYPERCALL_BUFFER(pcv)) )
+        goto out;
+
+    for ( c = 0; c < NR_COUNTERS; c++ )
+        vals[c] = -1;
+
+    for ( i = 0, val = pcv; i < nr_desc; val += pcd[i++].nr_vals )
+        for ( c = 0; c < NR_COUNTERS; c++ )
+        {
+            if ( strcmp(pcd[i].name, counters[c].desc) )
+                continue;
+            vals[c] = 0;
+            for ( j = 0; j < pcd[i].nr_vals; j++ )
+                vals[c] += val[j];
+        }
+
+    rc = 0;
+
+ out:
+    xc_hypercall_buffer_free(xch, pcd);
+    xc_hypercall_buffer_free(xch, pcv);
+
+    return rc;
+}
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [-l] [-i interval] [-n samples] <domid>\n", prog);
+    printf("  -l    put the guest in log-dirty mode meanwhile (PV guests)\n");
+    printf("  -i    seconds between samples (default %u)\n",
+           DEFAULT_INTERVAL);
+    printf("  -n    number of samples, 0 for until interrupted "
+           "(default %u)\n", DEFAULT_SAMPLES);
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int interval = DEFAULT_INTERVAL, samples = DEFAULT_SAMPLES;
+    unsigned int n, c;
+    unsigned long mb = 0;
+    int64_t prev[NR_COUNTERS], cur[NR_COUNTERS];
+    bool logdirty = false, enabled = false;
+    uint32_t domid;
+    int opt, rc = 1;
+
+    while ( (opt = getopt(argc, argv, "li:n:h")) != -1 )
+    {
+        switch ( opt )
+        {
+        case 'l':
+            logdirty = true;
+            break;
+        case 'i':
+            interval = strtoul(optarg, NULL, 0);
+            break;
+        case 'n':
+            samples = strtoul(optarg, NULL, 0);
+            break;
+        default:
+            usage(argv[0]);
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    if ( argc - optind != 1 || !interval )
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    domid = strtoul(argv[optind], NULL, 0);
+
+    xch = xc_interface_open(NULL, NULL, 0);
+    if ( !xch )
+    {
+        perror("xc_interface_open");
+        return 1;
+    }
+
+    signal(SIGINT, sigint);
+    signal(SIGTERM, sigint);
+
+    if ( logdirty )
+    {
+        if ( xc_shadow_control(xch, domid,
+                               XEN_DOMCTL_SHADOW_OP_ENABLE_LOGDIRTY,
+                               NULL, 0, NULL, 0, NULL) < 0 )
+        {
+            fprintf(stderr, "enabling log-dirty mode for d%u: %s\n",
+                    domid, strerror(errno));
+            goto out;
+        }
+        enabled = true;
+    }
+
+    if ( xc_shadow_control(xch, domid, XEN_DOMCTL_SHADOW_OP_GET_ALLOCATION,
+                           NULL, 0, &mb, 0, NULL) < 0 )
+        mb = 0;
+    printf("d%u shadow pool %lu MB\n", domid, mb);
+
+    if ( sample(prev) )
+    {
+        fprintf(stderr, "reading performance counters: %s\n",
+                strerror(errno));
+        goto out;
+    }
+    for ( c = 0; c < NR_COUNTERS; c++ )
+        if ( prev[c] < 0 )
+            fprintf(stderr, "counter \"%s\" not available\n",
+                    counters[c].desc);
+
+    for ( c = 0; c < NR_COUNTERS; c++ )
+        printf(" %10s", counters[c].label);
+    printf("\n");
+
+    for ( n = 0; !interrupted && (!samples || n < samples); n++ )
+    {
+        sleep(interval);
+
+        /* Have the guest's pages write protected again, as migration does. */
+        if ( enabled &&
+             xc_shadow_control(xch, domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
+                               NULL, 0, NULL, 0, NULL) < 0 )
+        {
+            fprintf(stderr, "cleaning log-dirty bitmap: %s\n",
+                    strerror(errno));
+            goto out;
+        }
+
+        if ( sample(cur) )
+            goto out;
+
+        for ( c = 0; c < NR_COUNTERS; c++ )
+            printf(" %10"PRId64,
+                   cur[c] < 0 ? -1 : (cur[c] - prev[c]) / interval);
+        printf("\n");
+
+        memcpy(prev, cur, sizeof(prev));
+    }
+
+    rc = 0;
+
+ out:
+    if ( enabled &&
+         xc_shadow_control(xch, domid, XEN_DOMCTL_SHADOW_OP_OFF,
+                           NULL, 0, NULL, 0, NULL) < 0 )
+    {
+        fprintf(stderr, "disabling log-dirty mode for d%u: %s\n",
+                domid, strerror(errno));
+        rc = 1;
+    }
+
+    xc_interface_close(xch);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,195 @@
+/*
+ * xencall-buffers-bench.c
+ *
+ * Microbenchmark of the libxencall hypercall buffer allocator.  A number of
+ * threads share one handle and repeatedly allocate and free a buffer, as
+ * the libxc bounce buffers do, optionally making a hypercall which writes
+ * to it in between.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <xencall.h>
+#include <xen/xen.h>
+#include <xen/version.h>
+
+#define DEFAULT_THREADS    4
+#define DEFAULT_SIZE       4096
+#define DEFAULT_ITERATIONS 100000
+#define MAX_THREADS        256
+
+static xencall_handle *xcall;
+static size_t size = DEFAULT_SIZE;
+static unsigned int iterations = DEFAULT_ITERATIONS;
+static int hypercall;
+
+struct worker {
+    pthread_t thread;
+    uint64_t ns;
+    int rc;
+};
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void *worker_fn(void *arg)
+{
+    struct worker *w = arg;
+    uint64_t start = now_ns();
+    unsigned int i;
+    void *buf;
+
+    for ( i = 0; i < iterations; i++ )
+    {
+        buf = xencall_alloc_buffer(xcall, size);
+        if ( !buf )
+        {
+            w->rc = errno;
+            break;
+        }
+
+        if ( hypercall &&
+             xencall2(xcall, __HYPERVISOR_xen_version, XENVER_extraversion,
+                      (uintptr_t)buf) < 0 )
+            w->rc = errno;
+
+        xencall_free_buffer(xcall, buf);
+
+        if ( w->rc )
+            break;
+    }
+
+    w->ns = now_ns() - start;
+
+    return NULL;
+}
+
+static int usage(const char *prog)
+{
+    printf("usage: %s [-t threads] [-s size] [-n iterations] [-x]\n", prog);
+    printf("  -t threads     threads sharing the handle (1-%u, default %u)\n",
+           MAX_THREADS, DEFAULT_THREADS);
+    printf("  -s size        buffer size in bytes (default %u)\n",
+           DEFAULT_SIZE);
+    printf("  -n iterations  allocations per thread (default %u)\n",
+           DEFAULT_ITERATIONS);
+    printf("  -x             make a hypercall with each buffer\n");
+    return 1;
+}
+
+int main(int argc, char *argv[])
+{
+    static struct worker workers[MAX_THREADS];
+    unsigned int nr_threads = DEFAULT_THREADS, i, started = 0;
+    xencall_buffer_stats stats;
+    uint64_t start, elapsed, total_ns = 0;
+    int opt, err, rc = 1;
+
+    while ( (opt = getopt(argc, argv, "t:s:n:x")) != -1 )
+    {
+        switch ( opt )
+        {
+        case 't':
+            nr_threads = strtoul(optarg, NULL, 0);
+            break;
+        case 's':
+            size = strtoul(optarg, NULL, 0);
+            break;
+        case 'n':
+            iterations = strtoul(optarg, NULL, 0);
+            break;
+        case 'x':
+            hypercall = 1;
+            break;
+        default:
+            return usage(argv[0]);
+        }
+    }
+
+    if ( optind != argc || !nr_threads || nr_threads > MAX_THREADS ||
+         !iterations || size < sizeof(xen_extraversion_t) )
+        return usage(argv[0]);
+
+    xcall = xencall_open(NULL, 0);
+    if ( !xcall )
+    {
+        perror("xencall_open");
+        return 1;
+    }
+
+    start = now_ns();
+    for ( started = 0; started < nr_threads; started++ )
+    {
+        /* pthread_create() returns an error number, it doesn't set errno. */
+        err = pthread_create(&workers[started].thread, NULL, worker_fn,
+                             &workers[started]);
+        if ( err )
+        {
+            fprintf(stderr, "pthread_create: %s\n", strerror(err));
+            break;
+        }
+    }
+
+    for ( i = 0; i < started; i++ )
+        pthread_join(workers[i].thread, NULL);
+    elapsed = now_ns() - start;
+
+    if ( started < nr_threads )
+        goto out;
+
+    for ( i = 0; i < nr_threads; i++ )
+    {
+        if ( workers[i].rc )
+        {
+            fprintf(stderr, "thread %u: %s\n", i, strerror(workers[i].rc));
+            goto out;
+        }
+        total_ns += workers[i].ns;
+    }
+
+    printf("%u threads, %zu byte buffers, %u iterations%s\n", nr_threads,
+           size, iterations, hypercall ? ", with hypercalls" : "");
+    printf("  %8"PRIu64" ns/iteration per thread, %.0f iterations/s\n",
+           total_ns / nr_threads / iterations,
+           (double)nr_threads * iterations * 1e9 / elapsed);
+
+    if ( !xencall_get_buffer_stats(xcall, &stats) )
+        printf("  allocations %"PRIu64", thread cache hits %"PRIu64
+               ", cache hits %"PRIu64", misses %"PRIu64", too big %"PRIu64
+               "\n", stats.allocations, stats.thread_cache_hits,
+               stats.cache_hits, stats.cache_misses, stats.toobig);
+
+    rc = 0;
+
+ out:
+    xencall_close(xcall);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -19,6 +19,7 @@
  */
 
 
+#include <fcntl.h>
 #include <unistd.h>
 #include <xc_private.h>
 
@@ -60,6 +61,19 @@ int write_page(int fd, void *page, int i)
     return file_op(fd, page, i, &my_write);
 }
 
+/*
+ * Start reading page i in the background, so that a later read_page() of
+ * it doesn't have to wait for the disk.  Several prefetches issued in a row
+ * are serviced in parallel.
+ */
+int prefetch_page(int fd, int i)
+{
+    off_t offset = i;
+
+    return posix_fadvise(fd, offset << PAGE_SHIFT, PAGE_SIZE,
+                         POSIX_FADV_WILLNEED);
+}
+
 
 /*
  * Local variables:
@@ -26,6 +26,7 @@
 
 int read_page(int fd, void *page, int i);
 int write_page(int fd, void *page, int i);
+int prefetch_page(int fd, int i);
 
 
 #endif
@@ -0,0 +1,431 @@
+/******************************************************************************
+ *
+ * Compressed in-memory store for paged-out pages.
+ *
+ * Evicted pages are LZ4 compressed and kept in dom0 memory, up to a size
+ * budget, so that paging them back in doesn't have to wait for the disk.
+ * When the budget is exceeded, the pages stored longest ago are written to
+ * their slot in the pagefile.  Every page stored keeps its pagefile slot,
+ * so demoting a page never has to allocate one.
+ *
+ * Pages which don't compress to less than three quarters of their size
+ * aren't worth keeping, and go to the pagefile straight away.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "file_ops.h"
+#include "page_store.h"
+
+/* Largest compressed size worth keeping in memory */
+#define MAX_STORED_SIZE (PAGE_SIZE - PAGE_SIZE / 4)
+
+struct stored_page {
+    /* LRU list, most recently stored first */
+    struct stored_page *prev, *next;
+    unsigned long gfn;
+    int slot;
+    unsigned int len;
+    unsigned char data[];
+};
+
+static struct stored_page **stored;
+static struct stored_page *lru_head, *lru_tail;
+static unsigned long budget, used;
+
+static struct {
+    unsigned long stored;       /* pages put into the store */
+    unsigned long rejected;     /* pages not compressible enough */
+    unsigned long demoted;      /* pages written out to make room */
+    unsigned long hits;         /* page-ins served from memory */
+    unsigned long misses;       /* page-ins read from the pagefile */
+    unsigned long long bytes;   /* compressed size of the pages stored */
+} stats;
+
+
+/*
+ * A minimal LZ4 block compressor: greedy matching through a hash table of
+ * the last position each 4 byte sequence was seen at.  Returns the size of
+ * the compressed data, or 0 if that exceeds dst_len.
+ */
+#define HASH_BITS     12
+#define MIN_MATCH     4
+#define MF_LIMIT      12    /* No match may start in the last 12 bytes */
+#define LAST_LITERALS 5     /* The last 5 bytes are always literals */
+
+static uint32_t read32(const uint8_t *p)
+{
+    uint32_t v;
+
+    memcpy(&v, p, sizeof(v));
+
+    return v;
+}
+
+static unsigned int hash32(uint32_t v)
+{
+    return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+static uint8_t *put_length(uint8_t *op, size_t len)
+{
+    for ( ; len >= 255; len -= 255 )
+        *op++ = 255;
+    *op++ = len;
+
+    return op;
+}
+
+static size_t lz4_compress_block(const uint8_t *src, size_t len,
+                                 uint8_t *dst, size_t dst_len)
+{
+    uint16_t table[1 << HASH_BITS];
+    const uint8_t *ip = src, *anchor = src, *end = src + len;
+    const uint8_t *mf_limit = end - MF_LIMIT;
+    const uint8_t *match_limit = end - LAST_LITERALS;
+    uint8_t *op = dst, *oend = dst + dst_len, *token;
+    size_t lit;
+
+    memset(table, 0, sizeof(table));
+
+    if ( len > MF_LIMIT )
+        ip++;
+
+    while ( len > MF_LIMIT && ip < mf_limit )
+    {
+        uint32_t seq = read32(ip);
+        unsigned int h = hash32(seq);
+        const uint8_t *ref = src + table[h], *m, *r;
+        size_t mlen;
+
+        table[h] = ip - src;
+
+        if ( ref >= ip || ip - ref > 0xffff || read32(ref) != seq )
+        {
+            ip++;
+            continue;
+        }
+
+        /* Extend the match backwards, then forwards */
+        while ( ip > anchor && ref > src && ip[-1] == ref[-1] )
+        {
+            ip--;
+            ref--;
+        }
+        for ( m = ip + MIN_MATCH, r = ref + MIN_MATCH;
+              m < match_limit && *m == *r; m++, r++ )
+            ;
+
+        lit = ip - anchor;
+        mlen = m - ip - MIN_MATCH;
+
+        /* Token, literal length, literals, offset, match length */
+        if ( op + 1 + lit / 255 + 1 + lit + 2 + mlen / 255 + 1 > oend )
+            return 0;
+
+        token = op++;
+        *token = (lit < 15 ? lit : 15) << 4;
+        if ( lit >= 15 )
+            op = put_length(op, lit - 15);
+        memcpy(op, anchor, lit);
+        op += lit;
+
+        *op++ = (ip - ref) & 0xff;
+        *op++ = (ip - ref) >> 8;
+
+        *token |= mlen < 15 ? mlen : 15;
+        if ( mlen >= 15 )
+            op = put_length(op, mlen - 15);
+
+        ip = anchor = m;
+    }
+
+    /* Trailing literals */
+    lit = end - anchor;
+    if ( op + 1 + lit / 255 + 1 + lit > oend )
+        return 0;
+
+    token = op++;
+    *token = (lit < 15 ? lit : 15) << 4;
+    if ( lit >= 15 )
+        op = put_length(op, lit - 15);
+    memcpy(op, anchor, lit);
+    op += lit;
+
+    return op - dst;
+}
+
+
+static int get_length(const uint8_t **ip, const uint8_t *end, size_t *len)
+{
+    unsigned int b;
+
+    do {
+        if ( *ip >= end )
+            return -1;
+        b = *(*ip)++;
+        *len += b;
+    } while ( b == 255 );
+
+    return 0;
+}
+
+/*
+ * Decompress an LZ4 block into dst, which has to be filled exactly.
+ * Returns 0 on success, -1 on malformed input.
+ *
+ * The decoder in xen/common/lz4 can't be reused here, as its variant for
+ * unknown output sizes rejects matches shorter than 8 bytes.
+ */
+static int lz4_decompress_block(const uint8_t *src, size_t len,
+                                uint8_t *dst, size_t dst_len)
+{
+    const uint8_t *ip = src, *end = src + len;
+    uint8_t *op = dst, *oend = dst + dst_len;
+
+    while ( ip < end )
+    {
+        unsigned int token = *ip++;
+        size_t lit = token >> 4, mlen = token & 15, off;
+
+        if ( lit == 15 && get_length(&ip, end, &lit) )
+            return -1;
+        if ( lit > end - ip || lit > oend - op )
+            return -1;
+        memcpy(op, ip, lit);
+        ip += lit;
+        op += lit;
+
+        /* The last sequence has no match */
+        if ( ip == end )
+            break;
+
+        if ( end - ip < 2 )
+            return -1;
+        off = ip[0] | (ip[1] << 8);
+        ip += 2;
+
+        if ( mlen == 15 && get_length(&ip, end, &mlen) )
+            return -1;
+        mlen += MIN_MATCH;
+        if ( !off || off > op - dst || mlen > oend - op )
+            return -1;
+
+        /* Byte by byte, as the match may overlap its own output */
+        for ( ; mlen; mlen--, op++ )
+            *op = op[-off];
+    }
+
+    return op == oend ? 0 : -1;
+}
+
+
+static void lru_unlink(struct stored_page *sp)
+{
+    if ( sp->prev )
+        sp->prev->next = sp->next;
+    else
+        lru_head = sp->next;
+
+    if ( sp->next )
+        sp->next->prev = sp->prev;
+    else
+        lru_tail = sp->prev;
+}
+
+static void lru_push(struct stored_page *sp)
+{
+    sp->prev = NULL;
+    sp->next = lru_head;
+    if ( lru_head )
+        lru_head->prev = sp;
+    else
+        lru_tail = sp;
+    lru_head = sp;
+}
+
+static void remove_page(struct stored_page *sp)
+{
+    lru_unlink(sp);
+    stored[sp->gfn] = NULL;
+    used -= sizeof(*sp) + sp->len;
+    free(sp);
+}
+
+static int decompress_page(const struct stored_page *sp, void *page)
+{
+    return lz4_decompress_block(sp->data, sp->len, page, PAGE_SIZE);
+}
+
+/* Write the page stored longest ago out to its slot in the pagefile */
+static int demote_page(struct xenpaging *paging)
+{
+    xc_interface *xch = paging->xc_handle;
+    struct stored_page *sp = lru_tail;
+
+    if ( decompress_page(sp, paging->paging_buffer) )
+    {
+        ERROR("Error decompressing page %lx", sp->gfn);
+        return -1;
+    }
+
+    if ( write_page(paging->fd, paging->paging_buffer, sp->slot) < 0 )
+    {
+        PERROR("Error writing page %lx", sp->gfn);
+        return -1;
+    }
+
+    remove_page(sp);
+    stats.demoted++;
+
+    return 0;
+}
+
+int page_store_init(struct xenpaging *paging, unsigned long size)
+{
+    budget = size;
+    if ( !budget )
+        return 0;
+
+    stored = calloc(paging->max_pages, sizeof(*stored));
+
+    return stored ? 0 : -ENOMEM;
+}
+
+void page_store_teardown(struct xenpaging *paging)
+{
+    xc_interface *xch = paging->xc_handle;
+
+    if ( !budget )
+        return;
+
+    DPRINTF("page store: %lu stored (%llu bytes), %lu rejected, %lu demoted, "
+            "%lu hits, %lu misses\n", stats.stored, stats.bytes,
+            stats.rejected, stats.demoted, stats.hits, stats.misses);
+
+    while ( lru_head )
+        remove_page(lru_head);
+    free(stored);
+    stored = NULL;
+}
+
+/* Keep a compressed copy of the page about to be paged out to slot
+ * Returns < 0 on fatal error
+ * Returns 0 if the page has to be written to the pagefile
+ * Returns > 0 if the page was stored
+ */
+int page_store_put(struct xenpaging *paging, unsigned long gfn, int slot,
+                   const void *page)
+{
+    static uint8_t buf[MAX_STORED_SIZE];
+    struct stored_page *sp;
+    size_t len;
+
+    if ( !budget )
+        return 0;
+
+    len = lz4_compress_block(page, PAGE_SIZE, buf, sizeof(buf));
+    if ( !len )
+    {
+        stats.rejected++;
+        return 0;
+    }
+
+    if ( sizeof(*sp) + len > budget )
+        return 0;
+
+    /* Make room, oldest pages first */
+    while ( used + sizeof(*sp) + len > budget )
+        if ( demote_page(paging) )
+            return -1;
+
+    sp = malloc(sizeof(*sp) + len);
+    if ( !sp )
+        return 0;
+
+    sp->gfn = gfn;
+    sp->slot = slot;
+    sp->len = len;
+    memcpy(sp->data, buf, len);
+
+    stored[gfn] = sp;
+    lru_push(sp);
+    used += sizeof(*sp) + len;
+
+    stats.stored++;
+    stats.bytes += len;
+
+    return 1;
+}
+
+/* Fetch, and forget, the page stored for gfn
+ * Returns < 0 on error
+ * Returns 0 if the page has to be read from the pagefile
+ * Returns > 0 if the page was stored
+ */
+int page_store_get(struct xenpaging *paging, unsigned long gfn, void *page)
+{
+    xc_interface *xch = paging->xc_handle;
+    struct stored_page *sp;
+
+    if ( !budget )
+        return 0;
+
+    sp = stored[gfn];
+    if ( !sp )
+    {
+        stats.misses++;
+        return 0;
+    }
+
+    if ( decompress_page(sp, page) )
+    {
+        ERROR("Error decompressing page %lx", gfn);
+        return -1;
+    }
+
+    remove_page(sp);
+    stats.hits++;
+
+    return 1;
+}
+
+int page_store_contains(unsigned long gfn)
+{
+    return budget && stored[gfn];
+}
+
+/* Forget the page stored for gfn, if any */
+void page_store_drop(unsigned long gfn)
+{
+    if ( page_store_contains(gfn) )
+        remove_page(stored[gfn]);
+}
+
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
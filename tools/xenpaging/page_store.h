@@ -0,0 +1,47 @@
+/******************************************************************************
+ * tools/xenpaging/page_store.h
+ *
+ * Compressed in-memory store for paged-out pages.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __XEN_PAGING_PAGE_STORE_H__
+#define __XEN_PAGING_PAGE_STORE_H__
+
+
+#include "xenpaging.h"
+
+
+int page_store_init(struct xenpaging *paging, unsigned long budget);
+void page_store_teardown(struct xenpaging *paging);
+int page_store_put(struct xenpaging *paging, unsigned long gfn, int slot,
+                   const void *page);
+int page_store_get(struct xenpaging *paging, unsigned long gfn, void *page);
+int page_store_contains(unsigned long gfn);
+void page_store_drop(unsigned long gfn);
+
+#endif // __XEN_PAGING_PAGE_STORE_H__
+
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -19,12 +19,17 @@
  */
 
 
+#include <time.h>
 #include "xc_bitops.h"
 #include "policy.h"
 
 
 #define DEFAULT_MRU_SIZE (1024 * 16)
 
+/* Minimum time between two samples of the accessed bits */
+#define HARVEST_INTERVAL_MS 1000
+#define MAX_AGE 255
+
 
 static unsigned long *mru;
 static unsigned int i_mru;
@@ -35,6 +40,49 @@ static unsigned int unconsumed_cleared;
 static unsigned long current_gfn;
 static unsigned long max_pages;
 
+/*
+ * With accessed bits available, victims are taken from cold_queue, which
+ * holds the candidate gfns ordered by the number of samples they have gone
+ * unaccessed for, coldest first.
+ */
+static int use_access_bits;
+static uint8_t *age;
+static uint8_t *accessed;
+static unsigned int *cold_queue;
+static unsigned int cold_head, cold_tail;
+static uint64_t last_harvest;
+
+static uint64_t now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000ull + ts.tv_nsec / 1000000;
+}
+
+static int access_bits_init(struct xenpaging *paging)
+{
+    xc_interface *xch = paging->xc_handle;
+
+    if ( xc_domain_p2m_access_tracking(xch, paging->vm_event.domain_id, 1) )
+    {
+        DPRINTF("accessed bits unavailable (%d), choosing victims round-robin\n",
+                errno);
+        return 0;
+    }
+
+    age = calloc(max_pages, sizeof(*age));
+    accessed = malloc((max_pages + 7) / 8);
+    cold_queue = malloc(max_pages * sizeof(*cold_queue));
+    if ( !age || !accessed || !cold_queue )
+        return -ENOMEM;
+
+    use_access_bits = 1;
+
+    return 0;
+}
+
 
 int policy_init(struct xenpaging *paging)
 {
@@ -71,12 +119,99 @@ int policy_init(struct xenpaging *paging)
     /* Start in the middle to avoid paging during BIOS startup */
     current_gfn = max_pages / 2;
 
-    rc = 0;
+    rc = access_bits_init(paging);
  out:
     return rc;
 }
 
-unsigned long policy_choose_victim(struct xenpaging *paging)
+void policy_teardown(struct xenpaging *paging)
+{
+    if ( use_access_bits )
+        xc_domain_p2m_access_tracking(paging->xc_handle,
+                                      paging->vm_event.domain_id, 0);
+}
+
+/*
+ * Sample and clear the accessed bits, age the gfns accordingly, and queue
+ * all candidates coldest first.  Returns the number of gfns queued, or -1
+ * if it is too early to take another sample.
+ */
+static int refill_cold_queue(struct xenpaging *paging)
+{
+    xc_interface *xch = paging->xc_handle;
+    unsigned int count[MAX_AGE + 1] = { 0 }, pos[MAX_AGE + 1];
+    unsigned long gfn;
+    uint64_t now = now_ms();
+    int a;
+
+    if ( last_harvest && now - last_harvest < HARVEST_INTERVAL_MS )
+        return -1;
+
+    if ( xc_domain_p2m_harvest_accessed(xch, paging->vm_event.domain_id, 0,
+                                        max_pages, accessed, NULL) )
+    {
+        PERROR("Error harvesting accessed bits, choosing victims round-robin");
+        use_access_bits = 0;
+        return -1;
+    }
+    last_harvest = now;
+
+    /* Give gfns which failed to be nominated another chance */
+    bitmap_clear(unconsumed, max_pages);
+
+    for ( gfn = 0; gfn < max_pages; gfn++ )
+    {
+        if ( accessed[gfn / 8] & (1 << (gfn % 8)) )
+            age[gfn] = 0;
+        else if ( age[gfn] < MAX_AGE )
+            age[gfn]++;
+
+        if ( !test_bit(gfn, bitmap) )
+            count[age[gfn]]++;
+    }
+
+    /* Sort the candidates by decreasing age */
+    pos[MAX_AGE] = 0;
+    for ( a = MAX_AGE; a > 0; a-- )
+        pos[a - 1] = pos[a] + count[a];
+
+    for ( gfn = 0; gfn < max_pages; gfn++ )
+        if ( !test_bit(gfn, bitmap) )
+            cold_queue[pos[age[gfn]]++] = gfn;
+
+    cold_head = 0;
+    cold_tail = pos[0];
+
+    DPRINTF("queued %u candidates, %u not accessed for %u samples or more\n",
+            cold_tail, pos[MAX_AGE], MAX_AGE);
+
+    return cold_tail;
+}
+
+static unsigned long choose_coldest(struct xenpaging *paging)
+{
+    unsigned long gfn;
+
+    do {
+        while ( cold_head < cold_tail )
+        {
+            gfn = cold_queue[cold_head++];
+
+            /* Paged out, recently paged in, or already tried */
+            if ( test_bit(gfn, bitmap) || test_bit(gfn, unconsumed) )
+                continue;
+
+            set_bit(gfn, unconsumed);
+            return gfn;
+        }
+    } while ( refill_cold_queue(paging) > 0 );
+
+    /* No more pages, wait in poll */
+    paging->use_poll_timeout = 1;
+    return INVALID_MFN;
+}
+
+static unsigned long choose_round_robin(struct xenpaging *paging)
 {
     xc_interface *xch = paging->xc_handle;
     unsigned long i;
@@ -136,6 +271,14 @@ unsigned long policy_choose_victim(struct xenpaging *paging)
     return current_gfn;
 }
 
+unsigned long policy_choose_victim(struct xenpaging *paging)
+{
+    if ( use_access_bits )
+        return choose_coldest(paging);
+
+    return choose_round_robin(paging);
+}
+
 void policy_notify_paged_out(unsigned long gfn)
 {
     set_bit(gfn, bitmap);
@@ -32,6 +32,7 @@
 
 #include "xc_bitops.h"
 #include "file_ops.h"
+#include "page_store.h"
 #include "policy.h"
 #include "xenpaging.h"
 
@@ -208,6 +209,7 @@ static void usage(void)
     printf(" -f <file>      --pagefile=<file>        pagefile to use. This option is required.\n");
     printf(" -m <max_memkb> --max_memkb=<max_memkb>  maximum amount of memory to handle.\n");
     printf(" -r <num>       --mru_size=<num>         number of paged-in pages to keep in memory.\n");
+    printf(" -z <kb>        --compressed=<kb>        keep up to <kb> of compressed pages in memory.\n");
     printf(" -v             --verbose                enable debug output.\n");
     printf(" -h             --help                   this output.\n");
 }
@@ -215,13 +217,14 @@ static void usage(void)
 static int xenpaging_getopts(struct xenpaging *paging, int argc, char *argv[])
 {
     int ch;
-    static const char sopts[] = "hvd:f:m:r:";
+    static const char sopts[] = "hvd:f:m:r:z:";
     static const struct option lopts[] = {
         {"help", 0, NULL, 'h'},
         {"verbose", 0, NULL, 'v'},
         {"domain", 1, NULL, 'd'},
         {"pagefile", 1, NULL, 'f'},
         {"mru_size", 1, NULL, 'm'},
+        {"compressed", 1, NULL, 'z'},
         { }
     };
 
@@ -242,6 +245,9 @@ static int xenpaging_getopts(struct xenpaging *paging, int argc, char *argv[])
         case 'r':
             paging->policy_mru_size = atoi(optarg);
             break;
+        case 'z':
+            paging->compressed_kb = strtoul(optarg, NULL, 0);
+            break;
         case 'v':
             paging->debug = 1;
             break;
@@ -466,6 +472,14 @@ static struct xenpaging *xenpaging_init(int argc, char *argv[])
         goto err;
     }
 
+    /* Initialise compressed page store */
+    rc = page_store_init(paging, paging->compressed_kb << 10);
+    if ( rc != 0 )
+    {
+        PERROR("Error initialising compressed page store");
+        goto err;
+    }
+
     paging->paging_buffer = init_page();
     if ( !paging->paging_buffer )
     {
@@ -521,6 +535,9 @@ static void xenpaging_teardown(struct xenpaging *paging)
     xs_unwatch(paging->xs_handle, watch_target_tot_pages, "");
     xs_unwatch(paging->xs_handle, "@releaseDomain", watch_token);
 
+    policy_teardown(paging);
+    page_store_teardown(paging);
+
     paging->xc_handle = NULL;
     /* Tear down domain paging in Xen */
     munmap(paging->vm_event.ring_page, PAGE_SIZE);
@@ -587,85 +604,6 @@ static void put_response(struct vm_event *vm_event, vm_event_response_t *rsp)
     RING_PUSH_RESPONSES(back_ring);
 }
 
-/* Evict a given gfn
- * Returns < 0 on fatal error
- * Returns 0 on successful evict
- * Returns > 0 if gfn can not be evicted
- */
-static int xenpaging_evict_page(struct xenpaging *paging, unsigned long gfn, int slot)
-{
-    xc_interface *xch = paging->xc_handle;
-    void *page;
-    xen_pfn_t victim = gfn;
-    int ret;
-
-    DECLARE_DOMCTL;
-
-    /* Nominate page */
-    ret = xc_mem_paging_nominate(xch, paging->vm_event.domain_id, gfn);
-    if ( ret < 0 )
-    {
-        /* unpageable gfn is indicated by EBUSY */
-        if ( errno == EBUSY )
-            ret = 1;
-        else
-            PERROR("Error nominating page %lx", gfn);
-        goto out;
-    }
-
-    /* Map page */
-    page = xc_map_foreign_pages(xch, paging->vm_event.domain_id, PROT_READ, &victim, 1);
-    if ( page == NULL )
-    {
-        PERROR("Error mapping page %lx", gfn);
-        ret = -1;
-        goto out;
-    }
-
-    /* Copy page */
-    ret = write_page(paging->fd, page, slot);
-    if ( ret < 0 )
-    {
-        PERROR("Error copying page %lx", gfn);
-        munmap(page, PAGE_SIZE);
-        ret = -1;
-        goto out;
-    }
-
-    /* Release page */
-    munmap(page, PAGE_SIZE);
-
-    /* Tell Xen to evict page */
-    ret = xc_mem_paging_evict(xch, paging->vm_event.domain_id, gfn);
-    if ( ret < 0 )
-    {
-        /* A gfn in use is indicated by EBUSY */
-        if ( errno == EBUSY )
-        {
-                ret = 1;
-                DPRINTF("Nominated page %lx busy", gfn);
-        } else
-            PERROR("Error evicting page %lx", gfn);
-        goto out;
-    }
-
-    DPRINTF("evict_page > gfn %lx pageslot %d\n", gfn, slot);
-    /* Notify policy of page being paged out */
-    policy_notify_paged_out(gfn);
-
-    /* Update index */
-    paging->slot_to_gfn[slot] = gfn;
-    paging->gfn_to_slot[gfn] = slot;
-
-    /* Record number of evicted pages */
-    paging->num_paged_out++;
-
-    ret = 0;
-
- out:
-    return ret;
-}
-
 static int xenpaging_resume_page(struct xenpaging *paging, vm_event_response_t *rsp, int notify_policy)
 {
     /* Put the page info on the ring */
@@ -699,8 +637,12 @@ static int xenpaging_populate_page(struct xenpaging *paging, unsigned long gfn,
 
     DPRINTF("populate_page < gfn %lx pageslot %d\n", gfn, i);
 
-    /* Read page */
-    ret = read_page(paging->fd, paging->paging_buffer, i);
+    /* Read page, from memory if it is still there */
+    ret = page_store_get(paging, gfn, paging->paging_buffer);
+    if ( ret > 0 )
+        ret = 0;
+    else if ( ret == 0 )
+        ret = read_page(paging->fd, paging->paging_buffer, i);
     if ( ret != 0 )
     {
         PERROR("Error reading page");
@@ -753,19 +695,65 @@ static void resume_pages(struct xenpaging *paging, int num_pages)
         page_in_trigger();
 }
 
-/* Evict one gfn and write it to the given slot
+/* Start reading the pages requested on the ring, without consuming them,
+ * so that the reads of a burst of page-in requests proceed in parallel
+ */
+static void prefetch_requests(struct xenpaging *paging)
+{
+    vm_event_back_ring_t *back_ring = &paging->vm_event.back_ring;
+    RING_IDX req_cons = back_ring->req_cons;
+    RING_IDX req_prod = back_ring->sring->req_prod;
+    vm_event_request_t req;
+
+    /* Read the requests only after the producer index */
+    xen_rmb();
+
+    for ( ; req_cons != req_prod; req_cons++ )
+    {
+        memcpy(&req, RING_GET_REQUEST(back_ring, req_cons), sizeof(req));
+
+        if ( req.u.mem_paging.gfn < paging->max_pages &&
+             !(req.u.mem_paging.flags & MEM_PAGING_DROP_PAGE) &&
+             test_bit(req.u.mem_paging.gfn, paging->bitmap) &&
+             !page_store_contains(req.u.mem_paging.gfn) )
+            prefetch_page(paging->fd,
+                          paging->gfn_to_slot[req.u.mem_paging.gfn]);
+    }
+}
+
+/* Guests tend to touch neighbouring pages together: start reading those
+ * of the gfns following a paged-in one which are in the pagefile
+ */
+static void prefetch_neighbours(struct xenpaging *paging, unsigned long gfn)
+{
+    unsigned long end = gfn + XENPAGING_PREFETCH_WINDOW;
+
+    if ( end >= paging->max_pages )
+        end = paging->max_pages - 1;
+
+    while ( gfn++ < end )
+        if ( test_bit(gfn, paging->bitmap) && !page_store_contains(gfn) )
+            prefetch_page(paging->fd, paging->gfn_to_slot[gfn]);
+}
+
+/* Choose victims, nominate, copy and evict them, all in one batch
  * Returns < 0 on fatal error
- * Returns 0 on successful evict
- * Returns > 0 if no gfn can be evicted
+ * Returns the number of pages evicted otherwise, the slots not used for
+ * them are put back onto the free slot stack
  */
-static int evict_victim(struct xenpaging *paging, int slot)
+static int evict_batch(struct xenpaging *paging, int *slots, int num_slots)
 {
     xc_interface *xch = paging->xc_handle;
-    unsigned long gfn;
+    domid_t domain_id = paging->vm_event.domain_id;
+    xc_mem_paging_batch_entry_t entries[XENPAGING_EVICT_BATCH_SIZE];
+    xen_pfn_t victims[XENPAGING_EVICT_BATCH_SIZE];
     static int num_paged_out;
-    int ret;
+    unsigned long gfn;
+    void *page;
+    int i, rc, num = 0, evicted = 0, ret = -1;
 
-    do
+    /* Choose victims */
+    while ( num < num_slots && !interrupted )
     {
         gfn = policy_choose_victim(paging);
         if ( gfn == INVALID_MFN )
@@ -781,70 +769,201 @@ static int evict_victim(struct xenpaging *paging, int slot)
                 xenpaging_mem_paging_flush_ioemu_cache(paging);
                 num_paged_out = paging->num_paged_out;
             }
-            ret = ENOSPC;
-            goto out;
+            break;
         }
 
-        if ( interrupted )
+        entries[num].gfn = gfn;
+        entries[num].rc = 0;
+        entries[num]._pad = 0;
+        num++;
+    }
+
+    if ( !num )
+    {
+        ret = 0;
+        goto out;
+    }
+
+    /* Nominate pages */
+    if ( xc_mem_paging_nominate_batch(xch, domain_id, entries, num) < 0 )
+    {
+        PERROR("Error nominating %d pages", num);
+        goto out;
+    }
+
+    /* Drop unpageable gfns, indicated by EBUSY */
+    for ( i = 0, evicted = 0; i < num; i++ )
+    {
+        if ( entries[i].rc == -EBUSY )
+            continue;
+        if ( entries[i].rc )
         {
-            ret = EINTR;
+            errno = -entries[i].rc;
+            PERROR("Error nominating page %"PRIx64, entries[i].gfn);
             goto out;
         }
+        entries[evicted] = entries[i];
+        victims[evicted] = entries[i].gfn;
+        evicted++;
+    }
+    num = evicted;
+    evicted = 0;
 
-        ret = xenpaging_evict_page(paging, gfn, slot);
-        if ( ret < 0 )
+    if ( !num )
+    {
+        ret = 0;
+        goto out;
+    }
+
+    /* Map pages */
+    page = xc_map_foreign_pages(xch, domain_id, PROT_READ, victims, num);
+    if ( page == NULL )
+    {
+        PERROR("Error mapping %d pages", num);
+        goto out;
+    }
+
+    /* Copy pages, to memory if they compress well enough */
+    for ( i = 0; i < num; i++ )
+    {
+        rc = page_store_put(paging, entries[i].gfn, slots[i],
+                            page + i * PAGE_SIZE);
+        if ( rc == 0 )
+            rc = write_page(paging->fd, page + i * PAGE_SIZE, slots[i]);
+        if ( rc < 0 )
+        {
+            PERROR("Error copying page %"PRIx64, entries[i].gfn);
+            munmap(page, num * PAGE_SIZE);
             goto out;
+        }
     }
-    while ( ret );
 
-    if ( test_and_set_bit(gfn, paging->bitmap) )
-        ERROR("Page %lx has been evicted before", gfn);
+    /* Release pages */
+    munmap(page, num * PAGE_SIZE);
+
+    /* Tell Xen to evict pages */
+    if ( xc_mem_paging_evict_batch(xch, domain_id, entries, num) < 0 )
+    {
+        PERROR("Error evicting %d pages", num);
+        goto out;
+    }
+
+    for ( i = 0; i < num; i++ )
+    {
+        gfn = entries[i].gfn;
+
+        /* A gfn in use is indicated by EBUSY */
+        if ( entries[i].rc == -EBUSY )
+        {
+            DPRINTF("Nominated page %lx busy", gfn);
+            page_store_drop(gfn);
+            continue;
+        }
+        if ( entries[i].rc )
+        {
+            errno = -entries[i].rc;
+            PERROR("Error evicting page %lx", gfn);
+            goto out;
+        }
+
+        DPRINTF("evict_page > gfn %lx pageslot %d\n", gfn, slots[i]);
+        /* Notify policy of page being paged out */
+        policy_notify_paged_out(gfn);
+
+        /* Update index */
+        paging->slot_to_gfn[slots[i]] = gfn;
+        paging->gfn_to_slot[gfn] = slots[i];
+
+        /* Record number of evicted pages */
+        paging->num_paged_out++;
+
+        if ( test_and_set_bit(gfn, paging->bitmap) )
+            ERROR("Page %lx has been evicted before", gfn);
+
+        evicted++;
+    }
 
-    ret = 0;
+    ret = evicted;
 
  out:
+    /* Return unused slots */
+    for ( i = 0; i < num_slots; i++ )
+        if ( !paging->slot_to_gfn[slots[i]] )
+            paging->free_slot_stack[paging->stack_count++] = slots[i];
+
     return ret;
 }
 
-/* Evict a batch of pages and write them to a free slot in the paging file
- * Returns < 0 on fatal error
- * Returns 0 if no gfn can be evicted
- * Returns > 0 on successful evict
- */
-static int evict_pages(struct xenpaging *paging, int num_pages)
+/* Find up to num free slots in the paging file, known free ones first */
+static int get_free_slots(struct xenpaging *paging, int *slots, int num)
 {
-    xc_interface *xch = paging->xc_handle;
-    int rc, slot, num = 0;
+    static int next_slot;
+    int i, j, n = 0, slot;
 
-    /* Reuse known free slots */
-    while ( paging->stack_count > 0 && num < num_pages )
+    while ( paging->stack_count > 0 && n < num )
     {
         slot = paging->free_slot_stack[--paging->stack_count];
-        rc = evict_victim(paging, slot);
-        if ( rc )
-        {
-            num = rc < 0 ? -1 : num;
-            return num;
-        }
-        num++;
+
+        /* The stack may hold stale and duplicate entries */
+        if ( paging->slot_to_gfn[slot] )
+            continue;
+        for ( j = 0; j < n && slots[j] != slot; j++ )
+            ;
+        if ( j == n )
+            slots[n++] = slot;
     }
 
-    /* Scan all slots slots for remainders */
-    for ( slot = 0; slot < paging->max_pages && num < num_pages; slot++ )
+    /* Scan all slots for remainders */
+    for ( i = 0; i < paging->max_pages && n < num; i++ )
     {
+        slot = next_slot++;
+        if ( next_slot >= paging->max_pages )
+            next_slot = 0;
+
         /* Slot is allocated */
         if ( paging->slot_to_gfn[slot] )
             continue;
 
-        rc = evict_victim(paging, slot);
-        if ( rc )
-        {
-            num = rc < 0 ? -1 : num;
+        for ( j = 0; j < n && slots[j] != slot; j++ )
+            ;
+        if ( j == n )
+            slots[n++] = slot;
+    }
+
+    return n;
+}
+
+/* Evict a batch of pages and write them to a free slot in the paging file
+ * Returns < 0 on fatal error
+ * Returns 0 if no gfn can be evicted
+ * Returns > 0 on successful evict
+ */
+static int evict_pages(struct xenpaging *paging, int num_pages)
+{
+    int slots[XENPAGING_EVICT_BATCH_SIZE];
+    int rc, n, num = 0;
+
+    while ( num < num_pages && !interrupted )
+    {
+        n = num_pages - num;
+        if ( n > XENPAGING_EVICT_BATCH_SIZE )
+            n = XENPAGING_EVICT_BATCH_SIZE;
+
+        n = get_free_slots(paging, slots, n);
+        if ( !n )
             break;
-        }
 
-        num++;
+        rc = evict_batch(paging, slots, n);
+        if ( rc < 0 )
+            return -1;
+
+        num += rc;
+
+        /* No (more) pageable gfns */
+        if ( rc < n )
+            break;
     }
+
     return num;
 }
 
@@ -899,6 +1018,8 @@ int main(int argc, char *argv[])
             DPRINTF("Got event from Xen\n");
         }
 
+        prefetch_requests(paging);
+
         while ( RING_HAS_UNCONSUMED_REQUESTS(&paging->vm_event.back_ring) )
         {
             /* Indicate possible error */
@@ -933,6 +1054,7 @@ int main(int argc, char *argv[])
                             req.u.mem_paging.gfn, slot);
                     /* Notify policy of page being dropped */
                     policy_notify_dropped(req.u.mem_paging.gfn);
+                    page_store_drop(req.u.mem_paging.gfn);
                 }
                 else
                 {
@@ -942,6 +1064,8 @@ int main(int argc, char *argv[])
                         ERROR("Error populating page %"PRIx64"", req.u.mem_paging.gfn);
                         goto out;
                     }
+
+                    prefetch_neighbours(paging, req.u.mem_paging.gfn);
                 }
 
                 /* Prepare the response */
@@ -1030,10 +1154,10 @@ int main(int argc, char *argv[])
                 prev_num = num;
             }
             /* Limit the number of evicts to be able to process page-in requests */
-            if ( num > 42 )
+            if ( num > XENPAGING_EVICT_BATCH_SIZE )
             {
                 paging->use_poll_timeout = 0;
-                num = 42;
+                num = XENPAGING_EVICT_BATCH_SIZE;
             }
             if ( evict_pages(paging, num) < 0 )
                 goto out;
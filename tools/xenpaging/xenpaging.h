@@ -32,6 +32,8 @@
 #include <xen/vm_event.h>
 
 #define XENPAGING_PAGEIN_QUEUE_SIZE 64
+#define XENPAGING_EVICT_BATCH_SIZE 64
+#define XENPAGING_PREFETCH_WINDOW 8
 
 struct vm_event {
     domid_t domain_id;
@@ -60,6 +62,7 @@ struct xenpaging {
     int num_paged_out;
     int target_tot_pages;
     int policy_mru_size;
+    unsigned long compressed_kb;
     int use_poll_timeout;
     int debug;
     int stack_count;
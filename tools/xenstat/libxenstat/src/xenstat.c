@@ -58,6 +58,9 @@ static void xenstat_free_vcpus(xenstat_node * node);
 static void xenstat_free_networks(xenstat_node * node);
 static void xenstat_free_xen_version(xenstat_node * node);
 static void xenstat_free_vbds(xenstat_node * node);
+static int  xenstat_collect_vmexits(xenstat_node * node);
+static void xenstat_free_vmexits(xenstat_node * node);
+static void xenstat_uninit_vmexits(xenstat_handle * handle);
 static void xenstat_uninit_vcpus(xenstat_handle * handle);
 static void xenstat_uninit_xen_version(xenstat_handle * handle);
 static char *xenstat_get_domain_name(xenstat_handle * handle, unsigned int domain_id);
@@ -71,7 +74,9 @@ static xenstat_collector collectors[] = {
 	{ XENSTAT_XEN_VERSION, xenstat_collect_xen_version,
 	  xenstat_free_xen_version, xenstat_uninit_xen_version },
 	{ XENSTAT_VBD, xenstat_collect_vbds,
-	  xenstat_free_vbds, xenstat_uninit_vbds }
+	  xenstat_free_vbds, xenstat_uninit_vbds },
+	{ XENSTAT_VMEXITS, xenstat_collect_vmexits,
+	  xenstat_free_vmexits, xenstat_uninit_vmexits }
 };
 
 #define NUM_COLLECTORS (sizeof(collectors)/sizeof(xenstat_collector))
@@ -124,6 +129,7 @@ void xenstat_uninit(xenstat_handle * handle)
 	if (handle) {
 		for (i = 0; i < NUM_COLLECTORS; i++)
 			collectors[i].uninit(handle);
+		xenstat_uninit_domstats(handle);
 		xc_interface_close(handle->xc_handle);
 		xs_daemon_close(handle->xshandle);
 		free(handle->priv);
@@ -131,13 +137,39 @@ void xenstat_uninit(xenstat_handle * handle)
 	}
 }
 
+/* Fill in domain from info, except for its name */
+void xenstat_init_domain(xenstat_handle * handle, xenstat_domain * domain,
+			 const xc_domaininfo_t * info)
+{
+	domain->id = info->domain;
+	domain->state = info->flags;
+	domain->cpu_ns = info->cpu_time;
+	domain->evtchn_sends = 0;
+	domain->num_vcpus = (info->max_vcpu_id+1);
+	domain->vcpus = NULL;
+	domain->cur_mem =
+	    ((unsigned long long)info->tot_pages)
+	    * handle->page_size;
+	domain->max_mem =
+	    info->max_pages == UINT_MAX
+	    ? (unsigned long long)-1
+	    : (unsigned long long)(info->max_pages
+				   * handle->page_size);
+	domain->ssid = info->ssidref;
+	domain->num_networks = 0;
+	domain->networks = NULL;
+	domain->num_vbds = 0;
+	domain->vbds = NULL;
+	domain->vmexits = NULL;
+}
+
 xenstat_node *xenstat_get_node(xenstat_handle * handle, unsigned int flags)
 {
 #define DOMAIN_CHUNK_SIZE 256
 	xenstat_node *node;
 	xc_physinfo_t physinfo = { 0 };
 	xc_domaininfo_t domaininfo[DOMAIN_CHUNK_SIZE];
-	int new_domains;
+	int new_domains, rc;
 	unsigned int i;
 
 	/* Create the node */
@@ -172,6 +204,12 @@ xenstat_node *xenstat_get_node(xenstat_handle * handle, unsigned int flags)
 	}
 
 	node->num_domains = 0;
+	rc = xenstat_domstats_get_domains(node, flags);
+	if (rc == 0)
+		goto err;
+	if (rc > 0)
+		goto collect;
+
 	do {
 		xenstat_domain *domain, *tmp;
 
@@ -213,30 +251,14 @@ xenstat_node *xenstat_get_node(xenstat_handle * handle, unsigned int flags)
 					continue;
 				}
 			}
-			domain->state = domaininfo[i].flags;
-			domain->cpu_ns = domaininfo[i].cpu_time;
-			domain->num_vcpus = (domaininfo[i].max_vcpu_id+1);
-			domain->vcpus = NULL;
-			domain->cur_mem =
-			    ((unsigned long long)domaininfo[i].tot_pages)
-			    * handle->page_size;
-			domain->max_mem =
-			    domaininfo[i].max_pages == UINT_MAX
-			    ? (unsigned long long)-1
-			    : (unsigned long long)(domaininfo[i].max_pages
-						   * handle->page_size);
-			domain->ssid = domaininfo[i].ssidref;
-			domain->num_networks = 0;
-			domain->networks = NULL;
-			domain->num_vbds = 0;
-			domain->vbds = NULL;
+			xenstat_init_domain(handle, domain, &domaininfo[i]);
 
 			domain++;
 			node->num_domains++;
 		}
 	} while (new_domains == DOMAIN_CHUNK_SIZE);
 
-
+collect:
 	/* Run all the extra data collectors requested */
 	node->flags = 0;
 	for (i = 0; i < NUM_COLLECTORS; i++) {
@@ -350,6 +372,12 @@ unsigned long long xenstat_domain_cpu_ns(xenstat_domain * domain)
 	return domain->cpu_ns;
 }
 
+/* Get the number of event channel notifications sent by the domain */
+unsigned long long xenstat_domain_evtchn_sends(xenstat_domain * domain)
+{
+	return domain->evtchn_sends;
+}
+
 /* Find the number of VCPUs for a domain */
 unsigned int xenstat_domain_num_vcpus(xenstat_domain * domain)
 {
@@ -458,6 +486,10 @@ static int xenstat_collect_vcpus(xenstat_node * node)
 	for (i = 0; i < node->num_domains; i+=inc_index) {
 		inc_index = 1; /* default is to increment to next domain */
 
+		/* Already read from the domain statistics region */
+		if (node->domains[i].vcpus)
+			continue;
+
 		node->domains[i].vcpus = malloc(node->domains[i].num_vcpus
 						* sizeof(xenstat_vcpu));
 		if (node->domains[i].vcpus == NULL)
@@ -517,6 +549,199 @@ unsigned long long xenstat_vcpu_ns(xenstat_vcpu * vcpu)
 	return vcpu->ns;
 }
 
+/*
+ * VM exit functions
+ */
+
+#if defined(__i386__) || defined(__x86_64__)
+static const char *vmx_exit_names[] = {
+	[0] = "EXCEPTION_NMI",		[1] = "EXTERNAL_INTERRUPT",
+	[2] = "TRIPLE_FAULT",		[3] = "INIT",
+	[4] = "SIPI",			[5] = "IO_SMI",
+	[6] = "OTHER_SMI",		[7] = "PENDING_VIRT_INTR",
+	[8] = "PENDING_VIRT_NMI",	[9] = "TASK_SWITCH",
+	[10] = "CPUID",			[11] = "GETSEC",
+	[12] = "HLT",			[13] = "INVD",
+	[14] = "INVLPG",		[15] = "RDPMC",
+	[16] = "RDTSC",			[17] = "RSM",
+	[18] = "VMCALL",		[19] = "VMCLEAR",
+	[20] = "VMLAUNCH",		[21] = "VMPTRLD",
+	[22] = "VMPTRST",		[23] = "VMREAD",
+	[24] = "VMRESUME",		[25] = "VMWRITE",
+	[26] = "VMXOFF",		[27] = "VMXON",
+	[28] = "CR_ACCESS",		[29] = "DR_ACCESS",
+	[30] = "IO_INSTRUCTION",	[31] = "MSR_READ",
+	[32] = "MSR_WRITE",		[33] = "INVALID_GUEST_STATE",
+	[34] = "MSR_LOADING",		[36] = "MWAIT",
+	[37] = "MONITOR_TRAP_FLAG",	[39] = "MONITOR",
+	[40] = "PAUSE",			[41] = "MCE_DURING_VMENTRY",
+	[43] = "TPR_BELOW_THRESHOLD",	[44] = "APIC_ACCESS",
+	[45] = "EOI_INDUCED",		[46] = "ACCESS_GDTR_OR_IDTR",
+	[47] = "ACCESS_LDTR_OR_TR",	[48] = "EPT_VIOLATION",
+	[49] = "EPT_MISCONFIG",		[50] = "INVEPT",
+	[51] = "RDTSCP",		[52] = "PREEMPTION_TIMER",
+	[53] = "INVVPID",		[54] = "WBINVD",
+	[55] = "XSETBV",		[56] = "APIC_WRITE",
+	[58] = "INVPCID",		[59] = "VMFUNC",
+	[62] = "PML_FULL",		[63] = "XSAVES",
+	[64] = "XRSTORS",
+};
+
+/* SVM exit codes from 0x60 on; the ones below are CR/DR/exception ranges */
+static const char *svm_exit_names[] = {
+	"INTR", "NMI", "SMI", "INIT", "VINTR", "CR0_SEL_WRITE",
+	"IDTR_READ", "GDTR_READ", "LDTR_READ", "TR_READ",
+	"IDTR_WRITE", "GDTR_WRITE", "LDTR_WRITE", "TR_WRITE",
+	"RDTSC", "RDPMC", "PUSHF", "POPF", "CPUID", "RSM", "IRET",
+	"SWINT", "INVD", "PAUSE", "HLT", "INVLPG", "INVLPGA", "IOIO",
+	"MSR", "TASK_SWITCH", "FERR_FREEZE", "SHUTDOWN", "VMRUN",
+	"VMMCALL", "VMLOAD", "VMSAVE", "STGI", "CLGI", "SKINIT",
+	"RDTSCP", "ICEBP", "WBINVD", "MONITOR", "MWAIT",
+	"MWAIT_CONDITIONAL", "XSETBV", "NPF", "OTHER",
+};
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+#endif
+
+/* Collect the VM exit counts of HVM domains */
+static int xenstat_collect_vmexits(xenstat_node * node)
+{
+#if defined(__i386__) || defined(__x86_64__)
+	xc_vmexit_reason_t *reasons;
+	unsigned int i, r;
+	uint32_t vendor;
+
+	reasons = malloc(NUM_VMEXIT_REASONS * sizeof(*reasons));
+	if (reasons == NULL)
+		return 0;
+
+	for (i = 0; i < node->num_domains; i++) {
+		xenstat_domain *domain = &node->domains[i];
+
+		if (xc_vmexit_stats_get(node->handle->xc_handle, domain->id,
+					XEN_SYSCTL_VMEXIT_STATS_all_vcpus,
+					&vendor, reasons) != 0) {
+			if (errno == ENOMEM) {
+				free(reasons);
+				return 0;
+			}
+			/* Not an HVM domain, gone, or not supported by
+			   Xen -- leave it without VM exit counts */
+			continue;
+		}
+
+		domain->vmexits = malloc(NUM_VMEXIT_REASONS
+					 * sizeof(xenstat_vmexit));
+		if (domain->vmexits == NULL) {
+			free(reasons);
+			return 0;
+		}
+
+		domain->vmexit_vendor = vendor;
+		for (r = 0; r < NUM_VMEXIT_REASONS; r++) {
+			domain->vmexits[r].count = reasons[r].count;
+			domain->vmexits[r].cycles = reasons[r].cycles;
+		}
+	}
+
+	free(reasons);
+#endif
+	return 1;
+}
+
+/* Free VM exit information */
+static void xenstat_free_vmexits(xenstat_node * node)
+{
+	unsigned int i;
+	for (i = 0; i < node->num_domains; i++)
+		free(node->domains[i].vmexits);
+}
+
+/* Free VM exit information in handle - nothing to do */
+static void xenstat_uninit_vmexits(xenstat_handle * handle)
+{
+}
+
+/* Get the number of VM exit reasons counted for a domain */
+unsigned int xenstat_domain_num_vmexit_reasons(xenstat_domain * domain)
+{
+	return domain->vmexits ? NUM_VMEXIT_REASONS : 0;
+}
+
+/* Get the total number of VM exits of a domain */
+unsigned long long xenstat_domain_vmexits(xenstat_domain * domain)
+{
+	unsigned long long count = 0;
+	unsigned int r;
+
+	for (r = 0; r < xenstat_domain_num_vmexit_reasons(domain); r++)
+		count += domain->vmexits[r].count;
+	return count;
+}
+
+/* Get the total cycles spent handling VM exits of a domain */
+unsigned long long xenstat_domain_vmexit_cycles(xenstat_domain * domain)
+{
+	unsigned long long cycles = 0;
+	unsigned int r;
+
+	for (r = 0; r < xenstat_domain_num_vmexit_reasons(domain); r++)
+		cycles += domain->vmexits[r].cycles;
+	return cycles;
+}
+
+/* Get the number of VM exits of a domain for one reason */
+unsigned long long xenstat_domain_vmexit_reason_count(xenstat_domain * domain,
+						      unsigned int reason)
+{
+	if (reason < xenstat_domain_num_vmexit_reasons(domain))
+		return domain->vmexits[reason].count;
+	return 0;
+}
+
+/* Get the cycles spent handling VM exits of a domain for one reason */
+unsigned long long xenstat_domain_vmexit_reason_cycles(xenstat_domain * domain,
+						       unsigned int reason)
+{
+	if (reason < xenstat_domain_num_vmexit_reasons(domain))
+		return domain->vmexits[reason].cycles;
+	return 0;
+}
+
+/* Get the name of a VM exit reason, "UNKNOWN" if it hasn't got one */
+const char *xenstat_domain_vmexit_reason_name(xenstat_domain * domain,
+					      unsigned int reason)
+{
+	const char *name = NULL;
+
+	if (reason >= xenstat_domain_num_vmexit_reasons(domain))
+		return "UNKNOWN";
+
+#if defined(__i386__) || defined(__x86_64__)
+	if (domain->vmexit_vendor == XEN_SYSCTL_VMEXIT_STATS_svm) {
+		if (reason < 0x10)
+			name = "CR_READ";
+		else if (reason < 0x20)
+			name = "CR_WRITE";
+		else if (reason < 0x30)
+			name = "DR_READ";
+		else if (reason < 0x40)
+			name = "DR_WRITE";
+		else if (reason < 0x60)
+			name = "EXCEPTION";
+		else if (reason - 0x60 < ARRAY_SIZE(svm_exit_names))
+			name = svm_exit_names[reason - 0x60];
+	} else {
+		if (reason < ARRAY_SIZE(vmx_exit_names))
+			name = vmx_exit_names[reason];
+		else if (reason == XEN_SYSCTL_VMEXIT_OTHER)
+			name = "OTHER";
+	}
+#endif
+
+	return name ? name : "UNKNOWN";
+}
+
 /*
  * Network functions
  */
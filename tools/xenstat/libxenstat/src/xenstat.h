@@ -42,7 +42,9 @@ void xenstat_uninit(xenstat_handle * handle);
 #define XENSTAT_NETWORK 0x2
 #define XENSTAT_XEN_VERSION 0x4
 #define XENSTAT_VBD 0x8
-#define XENSTAT_ALL (XENSTAT_VCPU|XENSTAT_NETWORK|XENSTAT_XEN_VERSION|XENSTAT_VBD)
+#define XENSTAT_VMEXITS 0x10
+#define XENSTAT_ALL (XENSTAT_VCPU|XENSTAT_NETWORK|XENSTAT_XEN_VERSION|XENSTAT_VBD|\
+		     XENSTAT_VMEXITS)
 
 /* Get all available information about a node */
 xenstat_node *xenstat_get_node(xenstat_handle * handle, unsigned int flags);
@@ -93,6 +95,10 @@ char *xenstat_domain_name(xenstat_domain * domain);
 /* Get information about how much CPU time has been used */
 unsigned long long xenstat_domain_cpu_ns(xenstat_domain * domain);
 
+/* Get the number of event channel notifications sent by the domain, when
+ * Xen maintains the domain statistics region (0 otherwise) */
+unsigned long long xenstat_domain_evtchn_sends(xenstat_domain * domain);
+
 /* Find the number of VCPUs allocated to a domain */
 unsigned int xenstat_domain_num_vcpus(xenstat_domain * domain);
 
@@ -131,6 +137,23 @@ unsigned int xenstat_domain_num_vbds(xenstat_domain *);
 xenstat_vbd *xenstat_domain_vbd(xenstat_domain * domain,
 				    unsigned int vbd);
 
+/* Get the number of VM exit reasons counted for a domain, 0 if its VM
+ * exits aren't counted (e.g. it isn't an HVM domain) */
+unsigned int xenstat_domain_num_vmexit_reasons(xenstat_domain * domain);
+
+/* Get the number of VM exits of a domain, and the TSC cycles Xen spent
+ * handling them, in total or for one reason */
+unsigned long long xenstat_domain_vmexits(xenstat_domain * domain);
+unsigned long long xenstat_domain_vmexit_cycles(xenstat_domain * domain);
+unsigned long long xenstat_domain_vmexit_reason_count(xenstat_domain * domain,
+						      unsigned int reason);
+unsigned long long xenstat_domain_vmexit_reason_cycles(xenstat_domain * domain,
+						       unsigned int reason);
+
+/* Get the name of a VM exit reason of a domain */
+const char *xenstat_domain_vmexit_reason_name(xenstat_domain * domain,
+					      unsigned int reason);
+
 /*
  * VCPU functions - extract information from a xenstat_vcpu
  */
@@ -0,0 +1,397 @@
+/* libxenstat: statistics-collection library for Xen
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ */
+
+/*
+ * Domain and VCPU information from the domain statistics region.
+ *
+ * Xen keeps what XEN_DOMCTL_getdomaininfo and XEN_DOMCTL_getvcpuinfo would
+ * return for every domain in pages dom0 can map read-only (see
+ * xen/include/public/domstats.h), so that a refresh doesn't cost hypercalls
+ * per domain and per VCPU.  Domain names are cached as well, so that they
+ * don't have to be read from xenstore every time.
+ *
+ * Hypervisors without the region, or booted with domstats-period=0, and
+ * XSM policies which don't allow mapping it make the first attempt fail;
+ * the hypercalls are used from then on.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <xenforeignmemory.h>
+#include <xen/domstats.h>
+
+#include "xenstat_priv.h"
+
+/* Domain frames are mapped this many at a time, the most one mapping can
+ * be acquired with */
+#define CHUNK_FRAMES 32
+
+/* Attempts at reading a consistent copy before giving up on this refresh */
+#define MAX_TRIES 10
+
+/* Refreshes a cached domain name is trusted for */
+#define NAME_REFRESHES 10
+
+struct domstats_chunk {
+	xenforeignmemory_resource_handle *res;
+	void *addr;
+	unsigned int nr_frames;
+};
+
+struct domstats_name {
+	xen_domain_handle_t uuid;
+	unsigned int uses;
+	char *name;
+};
+
+struct xenstat_domstats {
+	xenforeignmemory_handle *fmem;
+	xenforeignmemory_resource_handle *header_res;
+	xen_domstats_header_t *header;
+	struct domstats_chunk *chunks;
+	unsigned int nr_chunks;
+	xen_domain_handle_t *uuids;		/* Of node->domains[] */
+	struct domstats_name **names;		/* Indexed by domid */
+};
+
+static void domstats_close(struct xenstat_domstats *ds)
+{
+	unsigned int i;
+
+	for (i = 0; i < ds->nr_chunks; i++)
+		if (ds->chunks[i].res)
+			xenforeignmemory_unmap_resource(ds->fmem,
+							ds->chunks[i].res);
+	if (ds->header_res)
+		xenforeignmemory_unmap_resource(ds->fmem, ds->header_res);
+	if (ds->fmem)
+		xenforeignmemory_close(ds->fmem);
+
+	if (ds->names) {
+		for (i = 0; i < DOMID_FIRST_RESERVED; i++) {
+			if (ds->names[i])
+				free(ds->names[i]->name);
+			free(ds->names[i]);
+		}
+	}
+
+	free(ds->names);
+	free(ds->uuids);
+	free(ds->chunks);
+	free(ds);
+}
+
+static struct xenstat_domstats *domstats_open(void)
+{
+	struct xenstat_domstats *ds;
+	void *addr = NULL;
+
+	ds = calloc(1, sizeof(*ds));
+	if (ds == NULL)
+		return NULL;
+
+	ds->names = calloc(DOMID_FIRST_RESERVED, sizeof(*ds->names));
+	ds->fmem = xenforeignmemory_open(NULL, 0);
+	if (ds->names == NULL || ds->fmem == NULL)
+		goto err;
+
+	ds->header_res = xenforeignmemory_map_resource(ds->fmem, DOMID_XEN,
+						       XENMEM_resource_domstats,
+						       0, 0, 1, &addr,
+						       PROT_READ, 0);
+	if (ds->header_res == NULL)
+		goto err;
+
+	ds->header = addr;
+	if (ds->header->version != XEN_DOMSTATS_VERSION)
+		goto err;
+
+	return ds;
+err:
+	domstats_close(ds);
+	return NULL;
+}
+
+/* Make sure the domain frames below nr_frames are mapped */
+static int domstats_map(struct xenstat_domstats *ds, unsigned int nr_frames)
+{
+	unsigned int nr_chunks = (nr_frames - 1 + CHUNK_FRAMES - 1)
+				 / CHUNK_FRAMES;
+	unsigned int i;
+
+	if (nr_chunks > ds->nr_chunks) {
+		struct domstats_chunk *tmp;
+
+		tmp = realloc(ds->chunks, nr_chunks * sizeof(*tmp));
+		if (tmp == NULL)
+			return -1;
+		memset(tmp + ds->nr_chunks, 0,
+		       (nr_chunks - ds->nr_chunks) * sizeof(*tmp));
+		ds->chunks = tmp;
+		ds->nr_chunks = nr_chunks;
+	}
+
+	for (i = 0; i < nr_chunks; i++) {
+		struct domstats_chunk *chunk = &ds->chunks[i];
+		unsigned int nr = nr_frames - 1 - i * CHUNK_FRAMES;
+
+		if (nr > CHUNK_FRAMES)
+			nr = CHUNK_FRAMES;
+		if (chunk->nr_frames >= nr)
+			continue;
+
+		/* The last chunk was partial, and the region has grown */
+		if (chunk->res)
+			xenforeignmemory_unmap_resource(ds->fmem, chunk->res);
+
+		chunk->nr_frames = 0;
+		chunk->res = xenforeignmemory_map_resource(
+			ds->fmem, DOMID_XEN, XENMEM_resource_domstats, 0,
+			1 + i * CHUNK_FRAMES, nr, &chunk->addr, PROT_READ, 0);
+		if (chunk->res == NULL)
+			return -1;
+		chunk->nr_frames = nr;
+	}
+
+	return 0;
+}
+
+static const xen_domstats_domain_t *domstats_slot(struct xenstat_domstats *ds,
+						  unsigned int n)
+{
+	return (void *)((char *)ds->chunks[n / CHUNK_FRAMES].addr
+			+ (n % CHUNK_FRAMES) * XC_PAGE_SIZE);
+}
+
+static uint32_t domstats_seq(struct xenstat_domstats *ds)
+{
+	return *(volatile uint32_t *)&ds->header->seq;
+}
+
+static void free_vcpus(xenstat_node *node)
+{
+	unsigned int i;
+
+	for (i = 0; i < node->num_domains; i++) {
+		free(node->domains[i].vcpus);
+		node->domains[i].vcpus = NULL;
+	}
+}
+
+/* Copy the region into node->domains, until a copy is consistent.
+ * Returns 1 on success, 0 on fatal error, -1 if no consistent copy could be
+ * made this time, -2 if the region can't be mapped */
+static int domstats_copy(xenstat_node *node, struct xenstat_domstats *ds,
+			 unsigned int flags)
+{
+	unsigned int tries, i, nr, nr_frames;
+	uint32_t seq;
+
+	for (tries = 0; tries < MAX_TRIES; tries++) {
+		if (tries)
+			usleep(100);
+
+		seq = domstats_seq(ds);
+		if (seq & 1)
+			continue;
+		xen_rmb();
+
+		if (ds->header->flags & XEN_DOMSTATS_incomplete)
+			return -1;
+
+		nr = ds->header->nr_domains;
+		nr_frames = ds->header->nr_frames;
+		if (nr_frames == 0 || nr > nr_frames - 1)
+			continue;
+
+		if (domstats_map(ds, nr_frames))
+			return -2;
+
+		if (nr > 0) {
+			xenstat_domain *domains;
+			xen_domain_handle_t *uuids;
+
+			domains = realloc(node->domains, nr * sizeof(*domains));
+			if (domains == NULL)
+				return 0;
+			node->domains = domains;
+
+			uuids = realloc(ds->uuids, nr * sizeof(*uuids));
+			if (uuids == NULL)
+				return 0;
+			ds->uuids = uuids;
+		}
+
+		memset(node->domains, 0, nr * sizeof(xenstat_domain));
+		node->num_domains = nr;
+
+		for (i = 0; i < nr; i++) {
+			const xen_domstats_domain_t *slot = domstats_slot(ds, i);
+			xenstat_domain *domain = &node->domains[i];
+			xc_domaininfo_t info = slot->info;
+			unsigned int vcpu, nr_vcpus = slot->nr_vcpus;
+
+			xenstat_init_domain(node->handle, domain, &info);
+			domain->evtchn_sends = slot->evtchn_sends;
+			memcpy(ds->uuids[i], info.handle, sizeof(ds->uuids[i]));
+
+			/* Larger domains are left to xenstat_collect_vcpus */
+			if (!(flags & XENSTAT_VCPU) ||
+			    nr_vcpus != domain->num_vcpus ||
+			    nr_vcpus > XEN_DOMSTATS_MAX_VCPUS)
+				continue;
+
+			domain->vcpus = malloc(nr_vcpus * sizeof(xenstat_vcpu));
+			if (domain->vcpus == NULL) {
+				free_vcpus(node);
+				return 0;
+			}
+
+			for (vcpu = 0; vcpu < nr_vcpus; vcpu++) {
+				domain->vcpus[vcpu].online =
+					slot->vcpu[vcpu].online;
+				domain->vcpus[vcpu].ns =
+					slot->vcpu[vcpu].cpu_time;
+			}
+		}
+
+		xen_rmb();
+		if (domstats_seq(ds) == seq)
+			return 1;
+
+		free_vcpus(node);
+	}
+
+	return -1;
+}
+
+/* Get the name of a domain, from the cache if it was looked up recently
+ * for the same domain */
+static char *domstats_name(xenstat_handle *handle,
+			   struct xenstat_domstats *ds, unsigned int domid,
+			   const xen_domain_handle_t uuid)
+{
+	struct domstats_name *cached;
+	char path[80];
+	char *name, *copy;
+
+	if (domid >= DOMID_FIRST_RESERVED) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	cached = ds->names[domid];
+	if (cached && cached->uses < NAME_REFRESHES &&
+	    memcmp(cached->uuid, uuid, sizeof(cached->uuid)) == 0) {
+		cached->uses++;
+		return strdup(cached->name);
+	}
+
+	snprintf(path, sizeof(path), "/local/domain/%u/name", domid);
+	name = xs_read(handle->xshandle, XBT_NULL, path, NULL);
+	if (name == NULL)
+		return NULL;
+
+	/* Failing to cache the name doesn't matter */
+	copy = strdup(name);
+	if (copy == NULL)
+		return name;
+	if (cached == NULL) {
+		cached = ds->names[domid] = malloc(sizeof(*cached));
+		if (cached == NULL) {
+			free(copy);
+			return name;
+		}
+	} else
+		free(cached->name);
+
+	memcpy(cached->uuid, uuid, sizeof(cached->uuid));
+	cached->uses = 0;
+	cached->name = copy;
+
+	return name;
+}
+
+/* Fill node->domains in from the region, with their VCPUs if XENSTAT_VCPU
+ * is set in flags and they fit in the region.
+ * Returns 1 on success, 0 on fatal error, -1 if the hypercalls have to be
+ * used instead */
+int xenstat_domstats_get_domains(xenstat_node *node, unsigned int flags)
+{
+	xenstat_handle *handle = node->handle;
+	struct xenstat_domstats *ds = handle->domstats;
+	unsigned int i;
+	int rc;
+
+	if (handle->domstats_failed)
+		return -1;
+
+	if (ds == NULL) {
+		ds = handle->domstats = domstats_open();
+		if (ds == NULL) {
+			handle->domstats_failed = 1;
+			return -1;
+		}
+	}
+
+	rc = domstats_copy(node, ds, flags);
+	if (rc < -1) {
+		xenstat_uninit_domstats(handle);
+		handle->domstats_failed = 1;
+	}
+	if (rc <= 0) {
+		node->num_domains = 0;
+		return rc < 0 ? -1 : 0;
+	}
+
+	for (i = 0; i < node->num_domains; ) {
+		xenstat_domain *domain = &node->domains[i];
+
+		domain->name = domstats_name(handle, ds, domain->id,
+					     ds->uuids[i]);
+		if (domain->name == NULL) {
+			if (errno == ENOMEM) {
+				/* fatal error */
+				free_vcpus(node);
+				for (i = 0; i < node->num_domains; i++)
+					free(node->domains[i].name);
+				node->num_domains = 0;
+				return 0;
+			}
+
+			/* failed to get name -- this means the domain is
+			   being destroyed so simply ignore this entry */
+			free(domain->vcpus);
+			node->num_domains--;
+			memmove(domain, domain + 1,
+				(node->num_domains - i) * sizeof(*domain));
+			memmove(ds->uuids[i], ds->uuids[i + 1],
+				(node->num_domains - i) * sizeof(ds->uuids[i]));
+			continue;
+		}
+		i++;
+	}
+
+	return 1;
+}
+
+void xenstat_uninit_domstats(xenstat_handle *handle)
+{
+	if (handle->domstats)
+		domstats_close(handle->domstats);
+	handle->domstats = NULL;
+}
@@ -32,11 +32,23 @@
 #define SHORT_ASC_LEN 5                 /* length of 65535 */
 #define VERSION_SIZE (2 * SHORT_ASC_LEN + 1 + sizeof(xen_extraversion_t) + 1)
 
+#if defined(__i386__) || defined(__x86_64__)
+#define NUM_VMEXIT_REASONS XEN_SYSCTL_VMEXIT_REASONS
+#else
+#define NUM_VMEXIT_REASONS 0
+#endif
+
+typedef struct xenstat_vmexit xenstat_vmexit;
+
+struct xenstat_domstats;
+
 struct xenstat_handle {
 	xc_interface *xc_handle;
 	struct xs_handle *xshandle; /* xenstore handle */
 	int page_size;
 	void *priv;
+	struct xenstat_domstats *domstats; /* domain statistics region */
+	int domstats_failed;		/* region unavailable, use hypercalls */
 	char xen_version[VERSION_SIZE]; /* xen version running on this node */
 };
 
@@ -57,6 +69,7 @@ struct xenstat_domain {
 	char *name;
 	unsigned int state;
 	unsigned long long cpu_ns;
+	unsigned long long evtchn_sends; /* 0 if not read from the region */
 	unsigned int num_vcpus;		/* No. vcpus configured for domain */
 	xenstat_vcpu *vcpus;		/* Array of length num_vcpus */
 	unsigned long long cur_mem;	/* Current memory reservation */
@@ -66,6 +79,9 @@ struct xenstat_domain {
 	xenstat_network *networks;	/* Array of length num_networks */
 	unsigned int num_vbds;
 	xenstat_vbd *vbds;
+	unsigned int vmexit_vendor;	/* XEN_SYSCTL_VMEXIT_STATS_{vmx,svm} */
+	xenstat_vmexit *vmexits;	/* Array of length NUM_VMEXIT_REASONS,
+					   NULL if not counted */
 };
 
 struct xenstat_vcpu {
@@ -73,6 +89,11 @@ struct xenstat_vcpu {
 	unsigned long long ns;
 };
 
+struct xenstat_vmexit {
+	unsigned long long count;
+	unsigned long long cycles;
+};
+
 struct xenstat_network {
 	unsigned int id;
 	/* Received */
@@ -98,6 +119,12 @@ struct xenstat_vbd {
 	unsigned long long wr_sects;
 };
 
+extern void xenstat_init_domain(xenstat_handle * handle,
+				xenstat_domain * domain,
+				const xc_domaininfo_t * info);
+extern int xenstat_domstats_get_domains(xenstat_node * node,
+					unsigned int flags);
+extern void xenstat_uninit_domstats(xenstat_handle * handle);
 extern int xenstat_collect_networks(xenstat_node * node);
 extern void xenstat_uninit_networks(xenstat_handle * handle);
 extern int xenstat_collect_vbds(xenstat_node * node);
@@ -126,6 +126,10 @@ static int compare_vbd_rsect(xenstat_domain *domain1, xenstat_domain *domain2);
 static void print_vbd_rsect(xenstat_domain *domain);
 static int compare_vbd_wsect(xenstat_domain *domain1, xenstat_domain *domain2);
 static void print_vbd_wsect(xenstat_domain *domain);
+static int compare_vmexits(xenstat_domain *domain1, xenstat_domain *domain2);
+static void print_vmexits(xenstat_domain *domain);
+static int compare_vmexit_pct(xenstat_domain *domain1, xenstat_domain *domain2);
+static void print_vmexit_pct(xenstat_domain *domain);
 static void reset_field_widths(void);
 static void adjust_field_widths(xenstat_domain *domain);
 
@@ -137,6 +141,7 @@ static void do_domain(xenstat_domain *);
 static void do_vcpu(xenstat_domain *);
 static void do_network(xenstat_domain *);
 static void do_vbd(xenstat_domain *);
+static void do_vmexits(xenstat_domain *);
 static void top(void);
 
 /* Field types */
@@ -160,7 +165,9 @@ typedef enum field_id {
 	FIELD_VBD_WR,
 	FIELD_VBD_RSECT,
 	FIELD_VBD_WSECT,
-	FIELD_SSID
+	FIELD_SSID,
+	FIELD_VMEXITS,
+	FIELD_VMEXIT_PCT
 } field_id;
 
 typedef struct field {
@@ -190,7 +197,9 @@ field fields[] = {
 	{ FIELD_VBD_WR,    "VBD_WR",     8, compare_vbd_wr,    print_vbd_wr  },
 	{ FIELD_VBD_RSECT, "VBD_RSECT", 10, compare_vbd_rsect, print_vbd_rsect  },
 	{ FIELD_VBD_WSECT, "VBD_WSECT", 10, compare_vbd_wsect, print_vbd_wsect  },
-	{ FIELD_SSID,      "SSID",       4, compare_ssid,      print_ssid    }
+	{ FIELD_SSID,      "SSID",       4, compare_ssid,      print_ssid    },
+	{ FIELD_VMEXITS,   "VMEXIT/s",   8, compare_vmexits,   print_vmexits },
+	{ FIELD_VMEXIT_PCT, "EXIT(%)",   7, compare_vmexit_pct, print_vmexit_pct }
 };
 
 const unsigned int NUM_FIELDS = sizeof(fields)/sizeof(field);
@@ -209,6 +218,7 @@ unsigned int iterations = 0;
 int show_vcpus = 0;
 int show_networks = 0;
 int show_vbds = 0;
+int show_vmexits = 0;
 int repeat_header = 0;
 int show_full_name = 0;
 #define PROMPT_VAL_LEN 80
@@ -237,6 +247,7 @@ static void usage(const char *program)
 	       "-x, --vbds           output vbd block device data\n"
 	       "-r, --repeat-header  repeat table header before each domain\n"
 	       "-v, --vcpus          output vcpu data\n"
+	       "-e, --vmexits        output the most frequent vm exit reasons\n"
 	       "-b, --batch	     output in batch mode, no user input accepted\n"
 	       "-i, --iterations     number of iterations before exiting\n"
 	       "-f, --full-name      output the full domain name (not truncated)\n"
@@ -370,6 +381,9 @@ static int handle_key(int ch)
 		case 'v': case 'V':
 			show_vcpus ^= 1;
 			break;
+		case 'e': case 'E':
+			show_vmexits ^= 1;
+			break;
 		case KEY_DOWN:
 			first_domain_index++;
 			break;
@@ -878,6 +892,86 @@ static void print_ssid(xenstat_domain *domain)
 	print("%4u", xenstat_domain_ssid(domain));
 }
 
+/* Returns the previous sample of a domain, if both have VM exit counts */
+static xenstat_domain *vmexit_old_domain(xenstat_domain *domain)
+{
+	xenstat_domain *old_domain;
+
+	if (prev_node == NULL || !xenstat_domain_num_vmexit_reasons(domain))
+		return NULL;
+
+	old_domain = xenstat_node_domain(prev_node, xenstat_domain_id(domain));
+	if (old_domain == NULL || !xenstat_domain_num_vmexit_reasons(old_domain))
+		return NULL;
+
+	return old_domain;
+}
+
+/* Returns the time elapsed between the two samples in microseconds */
+static double us_elapsed(void)
+{
+	return ((curtime.tv_sec-oldtime.tv_sec)*1000000.0
+		+(curtime.tv_usec - oldtime.tv_usec));
+}
+
+/* Computes the VM exits per second of a domain */
+static double get_vmexit_rate(xenstat_domain *domain)
+{
+	xenstat_domain *old_domain = vmexit_old_domain(domain);
+
+	if (old_domain == NULL)
+		return 0.0;
+
+	return (xenstat_domain_vmexits(domain)
+		- xenstat_domain_vmexits(old_domain)) * 1000000.0
+		/ us_elapsed();
+}
+
+/* Computes the percentage of a CPU spent in Xen handling VM exits of a
+ * domain.  Like CPU(%), this can exceed 100 for domains with several vcpus. */
+static double get_vmexit_pct(xenstat_domain *domain)
+{
+	xenstat_domain *old_domain = vmexit_old_domain(domain);
+	unsigned long long hz = xenstat_node_cpu_hz(cur_node);
+
+	if (old_domain == NULL || hz == 0)
+		return 0.0;
+
+	/* cycles / (hz * us / 1000000) * 100 */
+	return (xenstat_domain_vmexit_cycles(domain)
+		- xenstat_domain_vmexit_cycles(old_domain)) * 100000000.0
+		/ hz / us_elapsed();
+}
+
+/* Compares VM exit rates of two domains, returning -1,0,1 for <,=,> */
+static int compare_vmexits(xenstat_domain *domain1, xenstat_domain *domain2)
+{
+	return -compare(get_vmexit_rate(domain1), get_vmexit_rate(domain2));
+}
+
+/* Prints VM exits per second, or '-' for domains without VM exit counts */
+static void print_vmexits(xenstat_domain *domain)
+{
+	if (xenstat_domain_num_vmexit_reasons(domain))
+		print("%8.0f", get_vmexit_rate(domain));
+	else
+		print("%8c", '-');
+}
+
+static int compare_vmexit_pct(xenstat_domain *domain1, xenstat_domain *domain2)
+{
+	return -compare(get_vmexit_pct(domain1), get_vmexit_pct(domain2));
+}
+
+/* Prints the percentage of a CPU spent handling VM exits */
+static void print_vmexit_pct(xenstat_domain *domain)
+{
+	if (xenstat_domain_num_vmexit_reasons(domain))
+		print("%7.1f", get_vmexit_pct(domain));
+	else
+		print("%7c", '-');
+}
+
 /* Resets default_width for fields with potentially large numbers */
 void reset_field_widths(void)
 {
@@ -1033,6 +1127,12 @@ void do_bottom_line(void)
 		attr_addstr(show_vcpus ? COLOR_PAIR(1) : 0, "CPUs");
 		addstr("  ");
 
+		/* vm exits */
+		attr_addstr(show_vmexits ? COLOR_PAIR(1) : 0, "VM");
+		addch(A_REVERSE | 'E');
+		attr_addstr(show_vmexits ? COLOR_PAIR(1) : 0, "xits");
+		addstr("  ");
+
 		/* repeat */
 		addch(A_REVERSE | 'R');
 		attr_addstr(repeat_header ? COLOR_PAIR(1) : 0, "epeat header");
@@ -1165,6 +1265,53 @@ void do_vbd(xenstat_domain *domain)
 	}
 }
 
+/* Output the VM exit reasons of a domain most frequent since the last
+ * sample, with how long Xen took to handle them on average */
+#define VMEXIT_TOP 5
+void do_vmexits(xenstat_domain *domain)
+{
+	xenstat_domain *old_domain = vmexit_old_domain(domain);
+	unsigned int top[VMEXIT_TOP], num_top = 0;
+	unsigned long long delta[VMEXIT_TOP];
+	unsigned long long hz = xenstat_node_cpu_hz(cur_node);
+	unsigned int i, j, r;
+
+	if (old_domain == NULL)
+		return;
+
+	/* Insertion sort of the reasons with the largest deltas */
+	for (r = 0; r < xenstat_domain_num_vmexit_reasons(domain); r++) {
+		unsigned long long d =
+			xenstat_domain_vmexit_reason_count(domain, r)
+			- xenstat_domain_vmexit_reason_count(old_domain, r);
+
+		if (d == 0 || (num_top == VMEXIT_TOP && d <= delta[num_top-1]))
+			continue;
+
+		if (num_top < VMEXIT_TOP)
+			num_top++;
+		for (j = num_top - 1; j > 0 && delta[j-1] < d; j--) {
+			top[j] = top[j-1];
+			delta[j] = delta[j-1];
+		}
+		top[j] = r;
+		delta[j] = d;
+	}
+
+	print("VM exits(/s, avg us):");
+	for (i = 0; i < num_top; i++) {
+		unsigned long long cycles =
+			xenstat_domain_vmexit_reason_cycles(domain, top[i])
+			- xenstat_domain_vmexit_reason_cycles(old_domain, top[i]);
+
+		print(" %s[%u]: %.0f, %.2f",
+		      xenstat_domain_vmexit_reason_name(domain, top[i]), top[i],
+		      delta[i] * 1000000.0 / us_elapsed(),
+		      hz ? cycles * 1000000.0 / hz / delta[i] : 0.0);
+	}
+	print("\n");
+}
+
 static void top(void)
 {
 	xenstat_domain **domains;
@@ -1217,6 +1364,8 @@ static void top(void)
 			do_network(domains[i]);
 		if (show_vbds)
 			do_vbd(domains[i]);
+		if (show_vmexits)
+			do_vmexits(domains[i]);
 	}
 
 	if (!batch)
@@ -1244,13 +1393,14 @@ int main(int argc, char **argv)
 		{ "vbds",          no_argument,       NULL, 'x' },
 		{ "repeat-header", no_argument,       NULL, 'r' },
 		{ "vcpus",         no_argument,       NULL, 'v' },
+		{ "vmexits",       no_argument,       NULL, 'e' },
 		{ "delay",         required_argument, NULL, 'd' },
 		{ "batch",	   no_argument,	      NULL, 'b' },
 		{ "iterations",	   required_argument, NULL, 'i' },
 		{ "full-name",     no_argument,       NULL, 'f' },
 		{ 0, 0, 0, 0 },
 	};
-	const char *sopts = "hVnxrvd:bi:f";
+	const char *sopts = "hVnxrved:bi:f";
 
 	if (atexit(cleanup) != 0)
 		fail("Failed to install cleanup handler.\n");
@@ -1279,6 +1429,9 @@ int main(int argc, char **argv)
 		case 'v':
 			show_vcpus = 1;
 			break;
+		case 'e':
+			show_vmexits = 1;
+			break;
 		case 'd':
 			delay = atoi(optarg);
 			break;
@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <strings.h>
+#include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
@@ -30,6 +32,136 @@ mread_handle_t mread_init(int fd)
     return h;
 }
 
+mread_handle_t mread_init_stream(int fd)
+{
+    mread_handle_t h = mread_init(fd);
+
+    h->stream = calloc(1, sizeof(*h->stream));
+    if (!h->stream)
+    {
+        perror("malloc");
+        exit(1);
+    }
+
+    return h;
+}
+
+/*
+ * Read some more data from a stream, blocking until there is some.
+ * Returns the number of bytes read, 0 at end of file.
+ */
+ssize_t mread_stream_fill(mread_handle_t h)
+{
+    struct mread_stream *s = h->stream;
+    off_t o = s->end - s->base;
+    unsigned int i = o / MREAD_BUF_SIZE;
+    size_t boffset = o % MREAD_BUF_SIZE;
+    ssize_t r;
+
+    if ( s->eof )
+        return 0;
+
+    if ( i == s->nr_chunks )
+    {
+        if ( s->nr_chunks == s->max_chunks )
+        {
+            unsigned int max = s->max_chunks ? s->max_chunks * 2 : 16;
+            char **chunk = realloc(s->chunk, max * sizeof(*chunk));
+
+            if ( !chunk )
+            {
+                perror("realloc");
+                exit(1);
+            }
+            s->chunk = chunk;
+            s->max_chunks = max;
+        }
+
+        s->chunk[i] = malloc(MREAD_BUF_SIZE);
+        if ( !s->chunk[i] )
+        {
+            perror("malloc");
+            exit(1);
+        }
+        s->nr_chunks++;
+    }
+
+    do {
+        r = read(h->fd, s->chunk[i] + boffset, MREAD_BUF_SIZE - boffset);
+    } while ( r < 0 && errno == EINTR );
+
+    if ( r < 0 )
+    {
+        perror("read");
+        exit(1);
+    }
+
+    if ( r == 0 )
+        s->eof = 1;
+    s->end += r;
+
+    return r;
+}
+
+/* Free the chunks of a stream which only hold data below offset. */
+void mread_stream_release(mread_handle_t h, off_t offset)
+{
+    struct mread_stream *s = h->stream;
+    unsigned int n = 0;
+
+    /* Chunks still being filled are kept, whatever the offset. */
+    if ( offset > s->end )
+        offset = s->end;
+
+    while ( n < s->nr_chunks && s->base + MREAD_BUF_SIZE <= offset )
+    {
+        free(s->chunk[n++]);
+        s->base += MREAD_BUF_SIZE;
+    }
+
+    if ( n )
+    {
+        s->nr_chunks -= n;
+        memmove(s->chunk, s->chunk + n, s->nr_chunks * sizeof(*s->chunk));
+    }
+}
+
+static ssize_t mread_stream(mread_handle_t h, char *rec, ssize_t len,
+                            off_t offset)
+{
+    struct mread_stream *s = h->stream;
+    ssize_t done, n;
+
+    if ( offset < s->base )
+    {
+        fprintf(stderr, "%s: offset %llx already released (base %llx)\n",
+                __func__, (unsigned long long)offset,
+                (unsigned long long)s->base);
+        exit(1);
+    }
+
+    while ( s->end < offset + len && mread_stream_fill(h) > 0 )
+        ;
+
+    if ( offset >= s->end )
+        return 0;
+    if ( offset + len > s->end )
+        len = s->end - offset;
+
+    for ( done = 0; done < len; done += n )
+    {
+        off_t o = offset + done - s->base;
+        size_t boffset = o % MREAD_BUF_SIZE;
+
+        n = MREAD_BUF_SIZE - boffset;
+        if ( n > len - done )
+            n = len - done;
+        memcpy(rec + done, s->chunk[o / MREAD_BUF_SIZE] + boffset, n);
+    }
+
+    return len;
+}
+
 ssize_t mread64(mread_handle_t h, void *rec, ssize_t len, off_t offset)
 {
     /* Idea: have a "cache" of N mmaped regions.  If the offset is
@@ -48,6 +180,9 @@ ssize_t mread64(mread_handle_t h, void *rec, ssize_t len, off_t offset)
     off_t boffset=0;
     ssize_t bsize;
 
+    if ( h->stream )
+        return mread_stream(h, rec, len, offset);
+
 #define dprintf(x...)
 //#define dprintf fprintf
 
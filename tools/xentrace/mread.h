@@ -12,7 +12,20 @@ typedef struct mread_ctrl {
         int accessed;
     } map[MREAD_MAPS];
     int clock, last;
+    /*
+     * Streaming input (e.g. a pipe from xentrace): data is read as it's
+     * needed, and kept in MREAD_BUF_SIZE chunks until released.
+     */
+    struct mread_stream {
+        char **chunk;           /* chunk[i] holds base + i * MREAD_BUF_SIZE */
+        unsigned int nr_chunks, max_chunks;
+        off_t base, end;        /* Data held is [base, end) */
+        int eof;
+    } *stream;
 } *mread_handle_t;
 
 mread_handle_t mread_init(int fd);
+mread_handle_t mread_init_stream(int fd);
 ssize_t mread64(mread_handle_t h, void *dst, ssize_t len, off_t offset);
+ssize_t mread_stream_fill(mread_handle_t h);
+void mread_stream_release(mread_handle_t h, off_t offset);
@@ -29,6 +29,7 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <pthread.h>
 #include <xen/trace.h>
 #include "analyze.h"
 #include "mread.h"
@@ -48,6 +49,8 @@ struct mread_ctrl;
 #define DEFAULT_SAMPLE_SIZE 1024
 #define DEFAULT_SAMPLE_MAX  1024*1024*32
 #define DEFAULT_INTERVAL_LENGTH 1000
+#define DEFAULT_STREAM_BUFFER_MB 64
+#define DEFAULT_STREAM_SAMPLE_MAX (1024*64)
 
 struct array_struct {
     unsigned long long *values;
@@ -71,6 +74,7 @@ struct {
     char * symbol_file;
     char * trace_file;
     int output_defined;
+    int stream; /* Reading front to back, e.g. from a pipe as it is taken */
     off_t file_size;
     struct {
         off_t update_offset;
@@ -84,6 +88,7 @@ struct {
     .symbol_file = NULL,
     .trace_file = NULL,
     .output_defined = 0,
+    .stream = 0,
     .file_size = 0,
     .progress = { .update_offset = 0 },
 };
@@ -180,6 +185,7 @@ struct {
         summary:1,
         report_pcpu:1,
         tsc_loop_fatal:1,
+        sample_max_set:1,
         summary_info;
     long long cpu_qhz, cpu_hz;
     int scatterplot_interrupt_vector;
@@ -190,6 +196,8 @@ struct {
     int interrupt_eip_enumeration_vector;
     int default_guest_paging_levels;
     int sample_size, sample_max;
+    int stream_buffer_mb;
+    int parallel; /* Number of reader threads, 0 for none */
     enum error_level tolerance; /* Tolerate up to this level of error */
     struct {
         tsc_t cycles;
@@ -204,7 +212,8 @@ struct {
             INTERVAL_DOMAIN_TOTAL_TIME,
             INTERVAL_DOMAIN_SHORT_SUMMARY,
             INTERVAL_DOMAIN_GUEST_INTERRUPT,
-            INTERVAL_DOMAIN_GRANT_MAPS
+            INTERVAL_DOMAIN_GRANT_MAPS,
+            INTERVAL_SUMMARY
         } output;
         enum {
             INTERVAL_MODE_CUSTOM,
@@ -260,6 +269,7 @@ struct {
     .default_guest_paging_levels = 2,
     .sample_size = DEFAULT_SAMPLE_SIZE,
     .sample_max = DEFAULT_SAMPLE_MAX,
+    .stream_buffer_mb = DEFAULT_STREAM_BUFFER_MB,
     .tolerance = ERR_SANITY,
     .interval = { .msec = DEFAULT_INTERVAL_LENGTH },
 };
@@ -1657,6 +1667,11 @@ struct vcpu_data {
     struct cycle_framework f;
     struct cycle_summary runstates[RUNSTATE_MAX];
     struct cycle_summary runnable_states[RUNNABLE_STATE_MAX];
+    /* Runstate time within the current interval, for interval-summary */
+    struct {
+        tsc_t tsc; /* Accounted up to here */
+        tsc_t cycles[RUNSTATE_MAX];
+    } interval_runstate;
     struct cycle_summary cpu_affinity_all,
         cpu_affinity_pcpu[MAX_CPUS];
     enum {
@@ -1811,7 +1826,8 @@ void volume_summary(struct trace_volume *vol)
 
 struct pcpu_info {
     /* Information about this pcpu */
-    unsigned active:1, summary:1;
+    unsigned active:1, summary:1,
+        stream_parked:1; /* Waiting for more of the stream to arrive */
     int pid;
 
     /* Information related to scanning thru the file */
@@ -1869,6 +1885,12 @@ struct {
     tsc_t buffer_trace_virq_tsc;
     struct pcpu_info pcpu[MAX_CPUS];
 
+    /* Streaming: pcpus parked, and the end of the stream when they were */
+    struct {
+        int parked;
+        off_t parked_end;
+    } stream;
+
     struct {
         int id;
         /* Invariant: head null => tail null; head !null => tail valid */
@@ -1892,6 +1914,11 @@ struct {
                 int guest_vector[INTERVAL_DOMAIN_GUEST_INTERRUPT_MAX];
             } domain;
         };
+        /* Latencies for interval-summary */
+        struct interval_latency {
+            int count;
+            long long cycles, max;
+        } irq, ipi;
     } interval;
 } P = { 0 };
 
@@ -2738,6 +2765,135 @@ void interval_domain_grant_maps_output(void) {
     }
 }
 
+/*
+ * interval-summary: for every domain, runstate time and the most frequent
+ * vmexits; host wide, irq handling time and IPI delivery latency.
+ * Runstate times add up over vcpus, as in top: 100% is one cpu's worth.
+ */
+#define INTERVAL_SUMMARY_EXITS 5
+
+static double cycles_to_us(long long c) {
+    return (double)c * 1000000 / opt.cpu_hz;
+}
+
+void interval_latency_update(struct interval_latency *l, long long c) {
+    l->count++;
+    l->cycles += c;
+    if ( c > l->max )
+        l->max = c;
+}
+
+static void interval_latency_output(const char *name,
+                                    struct interval_latency *l) {
+    printf(" %s %d", name, l->count);
+    if ( l->count )
+        printf(" avg %.2lfus max %.2lfus",
+               cycles_to_us(l->cycles / l->count), cycles_to_us(l->max));
+    memset(l, 0, sizeof(*l));
+}
+
+/* Account a vcpu's time in its current runstate, up to tsc */
+void interval_runstate_update(struct vcpu_data *v, tsc_t tsc) {
+    tsc_t start = v->interval_runstate.tsc;
+
+    if ( v->runstate.tsc > start )
+        start = v->runstate.tsc;
+    if ( P.interval.start_tsc > start )
+        start = P.interval.start_tsc;
+
+    if ( !v->runstate.tsc || tsc <= start )
+        return;
+
+    v->interval_runstate.cycles[v->runstate.state] += tsc - start;
+    v->interval_runstate.tsc = tsc;
+}
+
+void interval_summary_output(void) {
+    tsc_t end = P.interval.start_tsc + opt.interval.cycles;
+    char **exit_name = opt.svm_mode ? hvm_svm_exit_reason_name
+                                    : hvm_vmx_exit_reason_name;
+    int exit_max = opt.svm_mode ? HVM_SVM_EXIT_REASON_MAX
+                                : HVM_VMX_EXIT_REASON_MAX;
+    struct domain_data *d;
+
+    printf("-- ");
+    interval_time_output();
+    printf(" --\n");
+
+    for ( d = domain_list; d; d = d->next ) {
+        struct interval_element exits[HVM_EXIT_REASON_MAX] = { { 0 } };
+        tsc_t runstates[RUNSTATE_MAX] = { 0 };
+        int i, j, total = 0, shown;
+
+        for ( i = 0; i <= d->max_vid; i++ ) {
+            struct vcpu_data *v = d->vcpu[i];
+
+            if ( !v )
+                continue;
+
+            interval_runstate_update(v, end);
+            for ( j = 0; j < RUNSTATE_MAX; j++ ) {
+                runstates[j] += v->interval_runstate.cycles[j];
+                v->interval_runstate.cycles[j] = 0;
+            }
+
+            if ( v->data_type != VCPU_DATA_HVM )
+                continue;
+            for ( j = 0; j < exit_max; j++ ) {
+                struct interval_element *e =
+                    &v->hvm.summary.exit_reason[j].interval;
+
+                exits[j].count += e->count;
+                exits[j].cycles += e->cycles;
+                total += e->count;
+                clear_interval_cycles(e);
+            }
+        }
+
+        if ( d->did == IDLE_DOMAIN || d->did == DEFAULT_DOMAIN )
+            continue;
+
+        printf(" d%-5d", d->did);
+        for ( j = RUNSTATE_RUNNING; j <= RUNSTATE_OFFLINE; j++ )
+            printf(" %s %6.2lf%%", runstate_name[j],
+                   __cycles_percent(runstates[j], opt.interval.cycles));
+
+        if ( total ) {
+            printf(" | vmexits %d:", total);
+            /* Most frequent first */
+            for ( shown = 0; shown < INTERVAL_SUMMARY_EXITS; shown++ ) {
+                int max = -1;
+
+                for ( j = 0; j < exit_max; j++ )
+                    if ( exits[j].count
+                         && (max < 0 || exits[j].count > exits[max].count) )
+                        max = j;
+                if ( max < 0 )
+                    break;
+
+                if ( exit_name[max] )
+                    printf(" %s", exit_name[max]);
+                else
+                    printf(" %d", max);
+                printf(" %d (%.2lfus)", exits[max].count,
+                       cycles_to_us(exits[max].cycles / exits[max].count));
+                exits[max].count = 0;
+            }
+        }
+        printf("\n");
+    }
+
+    printf(" host:");
+    interval_latency_output("irqs handled", &P.interval.irq);
+    printf(" |");
+    interval_latency_output("ipis delivered", &P.interval.ipi);
+    printf("\n");
+
+    /* Someone may be watching */
+    if ( G.stream )
+        fflush(stdout);
+}
+
 /* General interval gateways */
 
 void interval_callback(void) {
@@ -2767,6 +2923,9 @@ void interval_callback(void) {
     case INTERVAL_DOMAIN_GRANT_MAPS:
         interval_domain_grant_maps_output();
         break;
+    case INTERVAL_SUMMARY:
+        interval_summary_output();
+        break;
     default:
         break;
     }
@@ -3370,9 +3529,12 @@ void hvm_vlapic_vmentry_cleanup(struct vcpu_data *v, tsc_t tsc)
         if(!(o->valid && o->injected))
             continue;
 
-        if(tsc >= o->first_tsc)
+        if(tsc >= o->first_tsc) {
             lat = tsc - o->first_tsc;
-        else
+            if ( opt.interval_mode
+                 && opt.interval.output == INTERVAL_SUMMARY )
+                interval_latency_update(&P.interval.ipi, lat);
+        } else
             fprintf(warn, "Strange, vec %d first_tsc %lld > ri->tsc %lld!\n",
                     o->vec, o->first_tsc, tsc);
 
@@ -4954,6 +5116,9 @@ static inline void runstate_update(struct vcpu_data *v, int new_runstate,
     if(v->runstate.tsc > 0 && v->runstate.tsc < tsc) {
         update_cycles(v->runstates + v->runstate.state, tsc - v->runstate.tsc);
 
+        if ( opt.interval_mode && opt.interval.output == INTERVAL_SUMMARY )
+            interval_runstate_update(v, tsc);
+
         if ( opt.scatterplot_runstate_time )
         {
             struct time_struct t, dt;
@@ -8457,6 +8622,9 @@ void irq_process(struct pcpu_info *p) {
         int arctime;
 
         arctime = r->end_tsc - r->start_tsc;
+        if ( opt.interval_mode && opt.interval.output == INTERVAL_SUMMARY
+             && arctime >= 0 )
+            interval_latency_update(&P.interval.irq, arctime);
         if ( opt.dump_all )
         {
             printf(" %s irq_handled irq %x %d (%d,%d)\n",
@@ -9122,9 +9290,13 @@ void process_record_tsc(tsc_t order_tsc, struct record_info *ri)
         } else {
             if ( opt.interval_mode ) {
                 if(P.interval.start_tsc > tsc) {
-                    fprintf(warn, "FATAL: order_tsc %lld < interval.start_tsc %lld!\n",
-                            tsc, P.interval.start_tsc);
-                    error(ERR_FILE, NULL);
+                    /* Pcpus parked waiting for more of a stream catch up
+                     * late; count what they have in the current interval. */
+                    if ( !G.stream ) {
+                        fprintf(warn, "FATAL: order_tsc %lld < interval.start_tsc %lld!\n",
+                                tsc, P.interval.start_tsc);
+                        error(ERR_FILE, NULL);
+                    }
                 } else {
                     while ( tsc - P.interval.start_tsc > opt.interval.cycles ) {
                         interval_callback();
@@ -9134,6 +9306,9 @@ void process_record_tsc(tsc_t order_tsc, struct record_info *ri)
             }
         }
 
+        if ( G.stream && tsc < P.f.last_tsc )
+            return;
+
         P.f.last_tsc=tsc;
 
         P.f.total_cycles = P.f.last_tsc - P.f.first_tsc;
@@ -9650,6 +9825,276 @@ void __fill_in_record_info(struct pcpu_info *p)
     ri->cpu = p->pid;
 }
 
+/*
+ * Parallel mode: reader threads, each looking after a group of pcpus, read
+ * the records of those pcpus ahead of the analysis, which stays single
+ * threaded.  Records are queued with the offset they were read from: if
+ * the analysis takes a different path through the file than the one the
+ * reader guessed (e.g. after an early eof), the reader is restarted.
+ */
+#define PREFETCH_RECORDS 1024
+#define PREFETCH_BATCH   256
+
+struct prefetch_record {
+    off_t offset;
+    ssize_t size; /* 0 at the end of the file */
+    struct trace_record rec;
+};
+
+struct prefetch_queue {
+    struct prefetch_record *ring;
+    unsigned int prod, cons, gen;
+    off_t next;   /* Offset for the reader to carry on from */
+    int started, eof;
+    /* The analysis' own view, to only take the lock once per batch */
+    unsigned int local_prod, local_cons;
+};
+
+struct prefetch_group {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int first;    /* Looks after pcpus first, first + opt.parallel, ... */
+};
+
+static struct {
+    struct prefetch_group *group;
+    struct prefetch_queue queue[MAX_CPUS];
+} prefetch;
+
+/* Quietly treat anything short as the end of the file: the analysis
+ * re-reads it with __read_record(), to report it in the usual way. */
+static ssize_t prefetch_read(mread_handle_t mh, struct trace_record *rec,
+                             off_t offset)
+{
+    ssize_t r, rsize;
+
+    r = mread64(mh, rec, sizeof(*rec), offset);
+    if ( r < (ssize_t)sizeof(uint32_t) )
+        return 0;
+
+    rsize = get_rec_size(rec);
+
+    return r < rsize ? 0 : rsize;
+}
+
+/* Where the next record of pcpu pid is, skipping other pcpus' windows
+ * as process_cpu_change() does. */
+static off_t prefetch_next_offset(int pid, const struct prefetch_record *r)
+{
+    const struct cpu_change_data *cd = (const void *)
+        (r->rec.cycle_flag ? r->rec.u.tsc.data : r->rec.u.notsc.data);
+
+    if ( r->rec.event == TRC_TRACE_CPU_CHANGE && cd->cpu != pid )
+        return r->offset + r->size + cd->window_size;
+
+    return r->offset + r->size;
+}
+
+static void *prefetch_thread(void *arg)
+{
+    struct prefetch_group *g = arg;
+    struct prefetch_record batch[PREFETCH_BATCH];
+    mread_handle_t mh;
+    int i, j, n, idle;
+
+    if ( (mh = mread_init(G.fd)) == NULL )
+    {
+        perror("mread");
+        exit(1);
+    }
+
+    pthread_mutex_lock(&g->lock);
+    for ( ; ; )
+    {
+        idle = 1;
+
+        for ( i = g->first; i < MAX_CPUS; i += opt.parallel )
+        {
+            struct prefetch_queue *q = prefetch.queue + i;
+            unsigned int gen, space;
+            off_t offset;
+
+            if ( !q->started || q->eof )
+                continue;
+
+            space = PREFETCH_RECORDS - (q->prod - q->cons);
+            if ( !space )
+                continue;
+            if ( space > PREFETCH_BATCH )
+                space = PREFETCH_BATCH;
+
+            gen = q->gen;
+            offset = q->next;
+            pthread_mutex_unlock(&g->lock);
+
+            for ( n = 0; n < space; )
+            {
+                struct prefetch_record *r = batch + n++;
+
+                r->offset = offset;
+                r->size = prefetch_read(mh, &r->rec, offset);
+                if ( !r->size )
+                    break;
+                offset = prefetch_next_offset(i, r);
+            }
+
+            pthread_mutex_lock(&g->lock);
+            idle = 0;
+
+            /* Restarted somewhere else in the meantime */
+            if ( gen != q->gen )
+                continue;
+
+            if ( q->prod == q->cons )
+                pthread_cond_broadcast(&g->cond);
+            for ( j = 0; j < n; j++ )
+                q->ring[q->prod++ % PREFETCH_RECORDS] = batch[j];
+            q->next = offset;
+            q->eof = !batch[n - 1].size;
+        }
+
+        if ( idle )
+            pthread_cond_wait(&g->cond, &g->lock);
+    }
+
+    return NULL;
+}
+
+static void prefetch_init(void)
+{
+    int i;
+
+    prefetch.group = calloc(opt.parallel, sizeof(*prefetch.group));
+    if ( !prefetch.group )
+    {
+        fprintf(stderr, "%s: malloc failed!\n", __func__);
+        error(ERR_SYSTEM, NULL);
+    }
+
+    for ( i = 0; i < opt.parallel; i++ )
+    {
+        struct prefetch_group *g = prefetch.group + i;
+
+        g->first = i;
+        pthread_mutex_init(&g->lock, NULL);
+        pthread_cond_init(&g->cond, NULL);
+        if ( pthread_create(&g->thread, NULL, prefetch_thread, g) )
+        {
+            fprintf(stderr, "%s: pthread_create failed!\n", __func__);
+            error(ERR_SYSTEM, NULL);
+        }
+    }
+}
+
+static ssize_t prefetch_get(struct pcpu_info *p, struct trace_record *rec)
+{
+    struct prefetch_queue *q = prefetch.queue + p->pid;
+    struct prefetch_group *g = prefetch.group + p->pid % opt.parallel;
+    struct prefetch_record *r = NULL;
+    ssize_t size;
+
+    if ( q->local_cons != q->local_prod )
+        r = q->ring + q->local_cons % PREFETCH_RECORDS;
+
+    if ( !r || r->offset != p->file_offset )
+    {
+        pthread_mutex_lock(&g->lock);
+        for ( ; ; )
+        {
+            /* Hand back what's been used, and see what's new */
+            if ( q->cons != q->local_cons )
+            {
+                if ( q->prod - q->cons >= PREFETCH_RECORDS / 2 &&
+                     q->prod - q->local_cons < PREFETCH_RECORDS / 2 )
+                    pthread_cond_broadcast(&g->cond);
+                q->cons = q->local_cons;
+            }
+            q->local_prod = q->prod;
+
+            if ( q->local_cons != q->local_prod )
+            {
+                r = q->ring + q->local_cons % PREFETCH_RECORDS;
+                if ( r->offset == p->file_offset )
+                    break;
+            }
+            else if ( q->started && !q->eof && q->next == p->file_offset )
+            {
+                pthread_cond_wait(&g->cond, &g->lock);
+                continue;
+            }
+
+            /* Not where the reader thought we'd be: restart it from here */
+            if ( !q->ring &&
+                 !(q->ring = malloc(PREFETCH_RECORDS * sizeof(*q->ring))) )
+            {
+                fprintf(stderr, "%s: malloc failed!\n", __func__);
+                error(ERR_SYSTEM, NULL);
+            }
+            q->gen++;
+            q->prod = q->cons = q->local_prod = q->local_cons = 0;
+            q->next = p->file_offset;
+            q->started = 1;
+            q->eof = 0;
+            pthread_cond_broadcast(&g->cond);
+        }
+        pthread_mutex_unlock(&g->lock);
+    }
+
+    q->local_cons++;
+    *rec = r->rec;
+    size = r->size;
+
+    if ( !size )
+        size = __read_record(rec, p->file_offset);
+
+    return size;
+}
+
+/*
+ * Stream mode: data is kept from the lowest offset any active pcpu is at.
+ * A pcpu whose next record hasn't arrived yet, when reading more would
+ * take the data held beyond opt.stream_buffer_mb, is parked: taken out of
+ * the processing order until the others have needed more of the stream
+ * anyway.  Its records may then be processed slightly out of order.
+ */
+static void stream_release(void)
+{
+    off_t low = G.mh->stream->end;
+    int i;
+
+    for ( i = 0; i <= P.max_active_pcpu; i++ )
+        if ( P.pcpu[i].active && P.pcpu[i].file_offset < low )
+            low = P.pcpu[i].file_offset;
+
+    mread_stream_release(G.mh, low);
+}
+
+static int stream_wait(struct pcpu_info *p)
+{
+    struct mread_stream *s = G.mh->stream;
+    off_t need = p->file_offset + sizeof(struct trace_record);
+
+    while ( s->end < need && !s->eof )
+    {
+        if ( s->end - s->base >= (off_t)opt.stream_buffer_mb << 20 )
+        {
+            stream_release();
+            if ( s->end - s->base >= (off_t)opt.stream_buffer_mb << 20 )
+            {
+                p->stream_parked = 1;
+                P.stream.parked++;
+                P.stream.parked_end = s->end;
+                record_order_remove(p);
+                return 1;
+            }
+        }
+        mread_stream_fill(G.mh);
+    }
+
+    return 0;
+}
+
 ssize_t read_record(struct pcpu_info * p) {
     off_t * offset;
     struct record_info *ri;
@@ -9657,7 +10102,13 @@ ssize_t read_record(struct pcpu_info * p) {
     offset = &p->file_offset;
     ri = &p->ri;
 
-    ri->size = __read_record(&ri->rec, *offset);
+    if ( G.stream && stream_wait(p) )
+        return 0;
+
+    if ( opt.parallel )
+        ri->size = prefetch_get(p, &ri->rec);
+    else
+        ri->size = __read_record(&ri->rec, *offset);
     if(ri->size)
     {
         __fill_in_record_info(p);
@@ -9836,10 +10287,46 @@ struct pcpu_info * choose_next_record(void)
     return min_p;
 }
 
+/* Put parked pcpus back into the processing order, once there's more of
+ * the stream, or when there's nothing else left to process. */
+static void stream_unpark(void)
+{
+    struct mread_stream *s = G.mh->stream;
+    int i;
+
+    do {
+        if ( !record_order[0] )
+        {
+            stream_release();
+            if ( !s->eof )
+                mread_stream_fill(G.mh);
+        }
+        else if ( s->end <= P.stream.parked_end && !s->eof )
+            return;
+
+        for ( i = 0; i <= P.max_active_pcpu; i++ )
+        {
+            struct pcpu_info *p = P.pcpu + i;
+
+            if ( !p->stream_parked )
+                continue;
+
+            p->stream_parked = 0;
+            P.stream.parked--;
+            record_order_insert(p);
+            if ( read_record(p) && p->active && !p->stream_parked )
+                record_order_bubble(p);
+        }
+    } while ( P.stream.parked && !record_order[0] );
+}
+
 void process_records(void) {
     while(1) {
         struct pcpu_info *p = NULL;
 
+        if ( P.stream.parked )
+            stream_unpark();
+
         if(!(p=choose_next_record()))
             return;
 
@@ -9860,7 +10347,7 @@ void process_records(void) {
             read_record(p);
 
         /* Update this pcpu in the processing order */
-        if ( p->active )
+        if ( p->active && !p->stream_parked )
             record_order_bubble(p);
     }
 }
@@ -10030,6 +10517,7 @@ enum {
     OPT_INTERVAL_DOMAIN_SHORT_SUMMARY,
     OPT_INTERVAL_DOMAIN_GUEST_INTERRUPT,
     OPT_INTERVAL_DOMAIN_GRANT_MAPS,
+    OPT_INTERVAL_SUMMARY,
     /* Summary info */
     OPT_SHOW_DEFAULT_DOMAIN_SUMMARY,
     OPT_MMIO_ENUMERATION_SKIP_VGA,
@@ -10046,6 +10534,9 @@ enum {
     OPT_PROGRESS,
     OPT_TOLERANCE,
     OPT_TSC_LOOP_FATAL,
+    OPT_STREAM,
+    OPT_STREAM_BUFFER,
+    OPT_PARALLEL,
     /* Specific letters */
     OPT_DUMP_ALL='a',
     OPT_INTERVAL_LENGTH='i',
@@ -10223,6 +10714,7 @@ error_t cmd_parser(int key, char *arg, struct argp_state *state)
         opt.sample_max = (int)strtol(arg, &inval, 0);
         if( inval == arg )
             argp_usage(state);
+        opt.sample_max_set = 1;
         break;
     }
     case OPT_MMIO_ENUMERATION_SKIP_VGA:
@@ -10436,6 +10928,14 @@ error_t cmd_parser(int key, char *arg, struct argp_state *state)
         break;
     }
 
+    case OPT_INTERVAL_SUMMARY:
+        opt.interval.output = INTERVAL_SUMMARY;
+        opt.interval.check = INTERVAL_CHECK_NONE;
+        opt.interval_mode = 1;
+        opt.summary_info = 1;
+        G.output_defined = 1;
+        break;
+
     case OPT_INTERVAL_DOMAIN_GUEST_INTERRUPT:
     {
         if((parse_array(arg, &opt.interval.array) < 0)
@@ -10526,6 +11026,28 @@ error_t cmd_parser(int key, char *arg, struct argp_state *state)
         opt.tsc_loop_fatal = 1;
         break;
 
+    case OPT_STREAM:
+        G.stream = 1;
+        break;
+
+    case OPT_STREAM_BUFFER:
+    {
+        char * inval;
+        opt.stream_buffer_mb = (int)strtol(arg, &inval, 0);
+        if( inval == arg || opt.stream_buffer_mb <= 0 )
+            argp_usage(state);
+        break;
+    }
+
+    case OPT_PARALLEL:
+    {
+        char * inval;
+        opt.parallel = (int)strtol(arg, &inval, 0);
+        if( inval == arg || opt.parallel < 0 || opt.parallel > MAX_CPUS )
+            argp_usage(state);
+        break;
+    }
+
     case ARGP_KEY_ARG:
     {
         /* FIXME - strcpy */
@@ -10746,6 +11268,11 @@ const struct argp_option cmd_opts[] =  {
       .group = OPT_GROUP_INTERVAL,
       .doc = "Print a csv with the grant maps done on behalf of a given domain every interval.", },
 
+    { .name = "interval-summary",
+      .key = OPT_INTERVAL_SUMMARY,
+      .group = OPT_GROUP_INTERVAL,
+      .doc = "Print the time each domain spent in each runstate (100% being one cpu's worth), its most frequent vmexits, and irq and IPI latencies every interval.", },
+
     /* Summary group */
     { .name = "show-default-domain-summary",
       .key = OPT_SHOW_DEFAULT_DOMAIN_SUMMARY,
@@ -10820,6 +11347,20 @@ const struct argp_option cmd_opts[] =  {
       .arg = "errlevel",
       .doc = "Sets tolerance for errors found in the file.  Default is 3; max is 6.", },
 
+    { .name = "stream",
+      .key = OPT_STREAM,
+      .doc = "Read the trace once, front to back, keeping only part of it in memory; e.g. \"xentrace /dev/stdout | xenalyze --interval-summary -\".  Default if the trace file isn't a regular file; \"-\" is stdin.", },
+
+    { .name = "stream-buffer",
+      .key = OPT_STREAM_BUFFER,
+      .arg = "MB",
+      .doc = "Trace data to keep in memory in stream mode, before records may be processed out of order.  Default 64.", },
+
+    { .name = "parallel",
+      .key = OPT_PARALLEL,
+      .arg = "threads",
+      .doc = "Read records ahead of the analysis with this many threads, each looking after a share of the pcpus.", },
+
 
     { 0 },
 };
@@ -10843,18 +11384,43 @@ int main(int argc, char *argv[]) {
     if (G.trace_file == NULL)
         exit(1);
 
-    if ( (G.fd = open(G.trace_file, O_RDONLY)) < 0) {
+    if ( !strcmp(G.trace_file, "-") )
+        G.fd = STDIN_FILENO;
+    else if ( (G.fd = open(G.trace_file, O_RDONLY)) < 0) {
         perror("open");
         error(ERR_SYSTEM, NULL);
-    } else {
+    }
+
+    {
         struct stat s;
         fstat(G.fd, &s);
         G.file_size = s.st_size;
+        if ( !S_ISREG(s.st_mode) )
+            G.stream = 1;
     }
 
-    if ( (G.mh = mread_init(G.fd)) == NULL )
+    if ( G.stream ) {
+        if ( opt.parallel ) {
+            fprintf(stderr, "--parallel needs a trace file to read ahead in\n");
+            exit(1);
+        }
+
+        /* No end known in advance, and no way back */
+        G.file_size = (off_t)(~0ULL >> (65 - sizeof(off_t) * 8));
+        opt.progress = 0;
+        if ( !opt.sample_max_set )
+            opt.sample_max = DEFAULT_STREAM_SAMPLE_MAX;
+
+        if ( (G.mh = mread_init_stream(G.fd)) == NULL ) {
+            perror("mread");
+            error(ERR_SYSTEM, NULL);
+        }
+    } else if ( (G.mh = mread_init(G.fd)) == NULL )
         perror("mread");
 
+    if ( opt.parallel )
+        prefetch_init();
+
     if (G.symbol_file != NULL)
         parse_symbol_file(G.symbol_file);
 
@@ -25,7 +25,9 @@
 #include <assert.h>
 #include <ctype.h>
 #include <poll.h>
+#include <pthread.h>
 #include <sys/statvfs.h>
+#include <sys/uio.h>
 
 #include <xen/xen.h>
 #include <xen/trace.h>
@@ -43,6 +45,11 @@ do {                                                            \
 } while (0)
 
 
+/* *BSD has no O_LARGEFILE */
+#ifndef O_LARGEFILE
+#define O_LARGEFILE	0
+#endif
+
 /***** Compile time configuration of defaults ********************************/
 
 /* sleep for this long (milliseconds) between checking the trace buffers */
@@ -60,9 +67,11 @@ typedef struct settings_st {
     unsigned long disk_rsvd;
     unsigned long timeout;
     unsigned long memory_buffer;
+    unsigned int threads;
     uint8_t discard:1,
         disable_tracing:1,
-        start_disabled:1;
+        start_disabled:1,
+        per_cpu_files:1;
 } settings_t;
 
 struct t_struct {
@@ -79,10 +88,21 @@ static xc_interface *xc_handle;
 static xenevtchn_handle *xce_handle = NULL;
 static int virq_port = -1;
 static int outfd = 1;
+static int *cpu_fds;       /* Per-CPU output files, if requested */
+static pthread_mutex_t output_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Written to by the signal handler, to wake up the event loop */
+static int signal_pipe[2] = { -1, -1 };
 
 static void close_handler(int signal)
 {
+    int saved_errno = errno;
+    ssize_t ret __attribute__((unused));
+
     interrupted = 1;
+    /* Can only fail if the pipe is full, i.e. a wakeup is pending already */
+    ret = write(signal_pipe[1], "", 1);
+    errno = saved_errno;
 }
 
 static struct {
@@ -332,97 +352,114 @@ fail:
     return;
 }
 
-/**
- * write_buffer - write a section of the trace buffer
- * @cpu      - source buffer CPU ID
- * @start
- * @size     - size of write (may be less than total window size)
- * @total_size - total size of the window (0 on 2nd write of wrapped windows)
- * @out      - output stream
- *
- * Outputs the trace buffer to a filestream, prepending the CPU and size
- * of the buffer write.
- */
-static void write_buffer(unsigned int cpu, unsigned char *start, int size,
-                         int total_size)
+static void check_disk_space(int fd, unsigned long size)
 {
     struct statvfs stat;
-    size_t written = 0;
-    
-    if ( opts.memory_buffer == 0 && opts.disk_rsvd != 0 )
-    {
-        unsigned long long freespace;
+    unsigned long long freespace;
 
-        /* Check that filesystem has enough space. */
-        if ( fstatvfs (outfd, &stat) )
-        {
-            fprintf(stderr, "Statfs failed!\n");
-            goto fail;
-        }
+    /* Check that filesystem has enough space. */
+    if ( fstatvfs (fd, &stat) )
+    {
+        fprintf(stderr, "Statfs failed!\n");
+        PERROR("Failed to write trace data");
+        exit(EXIT_FAILURE);
+    }
 
-        freespace = stat.f_frsize * (unsigned long long)stat.f_bfree;
+    freespace = stat.f_frsize * (unsigned long long)stat.f_bfree;
+    freespace -= size;
+    freespace >>= 20; /* Convert to MB */
 
-        if ( total_size )
-            freespace -= total_size;
-        else
-            freespace -= size;
+    if ( freespace <= opts.disk_rsvd )
+    {
+        fprintf(stderr, "Disk space limit reached (free space: %lluMB, limit: %luMB).\n", freespace, opts.disk_rsvd);
+        exit (EXIT_FAILURE);
+    }
+}
 
-        freespace >>= 20; /* Convert to MB */
+static void write_all(int fd, struct iovec *iov, int iovcnt)
+{
+    ssize_t written;
 
-        if ( freespace <= opts.disk_rsvd )
+    for ( ; ; )
+    {
+        while ( iovcnt && !iov->iov_len )
         {
-            fprintf(stderr, "Disk space limit reached (free space: %lluMB, limit: %luMB).\n", freespace, opts.disk_rsvd);
-            exit (EXIT_FAILURE);
+            iov++;
+            iovcnt--;
         }
-    }
+        if ( !iovcnt )
+            break;
 
-    /* Write a CPU_BUF record on each buffer "window" written.  Wrapped
-     * windows may involve two writes, so only write the record on the
-     * first write. */
-    if ( total_size != 0 )
-    {
-        if ( opts.memory_buffer )
+        written = writev(fd, iov, iovcnt);
+        if ( written < 0 && errno == EINTR )
+            continue;
+        if ( written <= 0 )
         {
-            membuf_reserve_window(cpu, total_size);
+            fprintf(stderr, "Write failed! (size %zu, returned %zd)\n",
+                    iov->iov_len, written);
+            PERROR("Failed to write trace data");
+            exit(EXIT_FAILURE);
         }
-        else
-        {
-            struct cpu_change_record rec;
-
-            rec.header = CPU_CHANGE_HEADER;
-            rec.data.cpu = cpu;
-            rec.data.window_size = total_size;
 
-            written = write(outfd, &rec, sizeof(rec));
-            if ( written != sizeof(rec) )
-            {
-                fprintf(stderr, "Cannot write cpu change (write returned %zd)\n",
-                        written);
-                goto fail;
-            }
+        for ( ; iovcnt && written >= iov->iov_len; iov++, iovcnt-- )
+            written -= iov->iov_len;
+        if ( iovcnt )
+        {
+            iov->iov_base = (char *)iov->iov_base + written;
+            iov->iov_len -= written;
         }
     }
+}
+
+/**
+ * write_window - write a window of a trace buffer
+ * @cpu      - source buffer CPU ID
+ * @data     - the window, in one or (if it wraps) two pieces
+ * @nr       - number of pieces
+ * @size     - total size of the window
+ *
+ * Outputs the window, prepended by a record with the CPU and size of the
+ * window, to the output file of that CPU.  The data is written straight
+ * from the trace buffer mapping, with a single system call when possible.
+ * Windows are written whole, so that consumer threads sharing an output
+ * file (or the memory buffer) don't interleave within them.
+ */
+static void write_window(unsigned int cpu, const struct iovec *data, int nr,
+                         unsigned long size)
+{
+    struct cpu_change_record rec;
+    struct iovec iov[3];
+    int i, fd = cpu_fds ? cpu_fds[cpu] : outfd;
+    int shared = !cpu_fds && opts.threads > 1;
+
+    if ( shared )
+        pthread_mutex_lock(&output_lock);
 
     if ( opts.memory_buffer )
     {
-        membuf_write(start, size);
+        membuf_reserve_window(cpu, size);
+        for ( i = 0; i < nr; i++ )
+            membuf_write(data[i].iov_base, data[i].iov_len);
     }
     else
     {
-        written = write(outfd, start, size);
-        if ( written != size )
-        {
-            fprintf(stderr, "Write failed! (size %d, returned %zd)\n",
-                    size, written);
-            goto fail;
-        }
-    }
+        if ( opts.disk_rsvd != 0 )
+            check_disk_space(fd, size);
 
-    return;
+        rec.header = CPU_CHANGE_HEADER;
+        rec.data.cpu = cpu;
+        rec.data.window_size = size;
 
-fail:
-    PERROR("Failed to write trace data");
-    exit(EXIT_FAILURE);
+        iov[0].iov_base = &rec;
+        iov[0].iov_len = sizeof(rec);
+        for ( i = 0; i < nr; i++ )
+            iov[i + 1] = data[i];
+
+        write_all(fd, iov, nr + 1);
+    }
+
+    if ( shared )
+        pthread_mutex_unlock(&output_lock);
 }
 
 static void disable_tbufs(void)
@@ -626,16 +663,20 @@ static void event_init(void)
 
 /**
  * wait_for_event_or_timeout - sleep for the specified number of milliseconds,
- *                             or until an VIRQ_TBUF event occurs
+ *                             or until an VIRQ_TBUF event or a signal occurs.
+ *                             0 milliseconds means no timeout.
  */
 static void wait_for_event_or_timeout(unsigned long milliseconds)
 {
     int rc;
-    struct pollfd fd = { .fd = xenevtchn_fd(xce_handle),
-                         .events = POLLIN | POLLERR };
+    struct pollfd fd[] = {
+        { .fd = xenevtchn_fd(xce_handle), .events = POLLIN | POLLERR },
+        { .fd = signal_pipe[0], .events = POLLIN },
+    };
     int port;
+    char c;
 
-    rc = poll(&fd, 1, milliseconds);
+    rc = poll(fd, 2, milliseconds ? milliseconds : -1);
     if (rc == -1) {
         if (errno == EINTR)
             return;
@@ -643,7 +684,12 @@ static void wait_for_event_or_timeout(unsigned long milliseconds)
         exit(EXIT_FAILURE);
     }
 
-    if (rc == 1) {
+    if (fd[1].revents & POLLIN) {
+        while (read(signal_pipe[0], &c, 1) == 1)
+            ;
+    }
+
+    if (fd[0].revents) {
         port = xenevtchn_pending(xce_handle);
         if (port == -1) {
             PERROR("failed to read port from evtchn");
@@ -664,26 +710,178 @@ static void wait_for_event_or_timeout(unsigned long milliseconds)
 }
 
 
+/*
+ * Trace buffers are drained by consumer threads, each looking after a
+ * contiguous group of CPUs.  The main thread only waits for VIRQ_TBUF (or
+ * the poll timeout) and wakes them all up.
+ */
+struct consumer {
+    pthread_t thread;
+    unsigned int first_cpu, end_cpu;    /* CPUs [first_cpu, end_cpu) */
+};
+
+static struct t_struct *tbufs;  /* Pointer to hypervisor maps */
+static unsigned long data_size; /* size of a trace buffer's data area */
+
+static pthread_mutex_t wakeup_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wakeup_cond = PTHREAD_COND_INITIALIZER;
+static unsigned long wakeup_gen;
+static int stopping;
+
+static unsigned long unconsumed(unsigned long cons, unsigned long prod)
+{
+    // NB: if (prod<cons), then (prod-cons)%data_size will not yield
+    // the correct answer because data_size is not a power of 2.
+    return prod < cons ? (prod + 2*data_size) - cons : prod - cons;
+}
+
+/**
+ * consume_buffer - write out the new records in the trace buffer of a CPU
+ *
+ * Returns non-zero if the buffer has filled up past the high water mark
+ * again by the time this is done.  Xen only sends VIRQ_TBUF when a buffer
+ * crosses the mark, so such a buffer has to be drained again without
+ * waiting for one.
+ */
+static int consume_buffer(unsigned int cpu)
+{
+    struct t_buf *meta = tbufs->meta[cpu];
+    unsigned char *data = tbufs->data[cpu];
+    unsigned long start_offset, end_offset, window_size, cons, prod;
+    struct iovec iov[2];
+
+    /* Read window information only once. */
+    cons = meta->cons;
+    prod = meta->prod;
+    xen_rmb(); /* read prod, then read item. */
+
+    if ( cons == prod )
+        return 0;
+
+    assert(cons < 2*data_size);
+    assert(prod < 2*data_size);
+
+    window_size = unconsumed(cons, prod);
+    assert(window_size > 0);
+    assert(window_size <= data_size);
+
+    start_offset = cons % data_size;
+    end_offset = prod % data_size;
+
+    iov[0].iov_base = data + start_offset;
+    if ( end_offset > start_offset )
+    {
+        /* If window does not wrap, write in one big chunk */
+        iov[0].iov_len = window_size;
+        write_window(cpu, iov, 1, window_size);
+    }
+    else
+    {
+        /* If wrapped, write in two chunks:
+         * - first, start to the end of the buffer
+         * - second, start of buffer to end of window
+         */
+        iov[0].iov_len = data_size - start_offset;
+        iov[1].iov_base = data;
+        iov[1].iov_len = end_offset;
+        write_window(cpu, iov, 2, window_size);
+    }
+
+    xen_mb(); /* read buffer, then update cons. */
+    meta->cons = prod;
+
+    return unconsumed(prod, meta->prod) >= data_size / 2;
+}
+
+static void *consumer_thread(void *arg)
+{
+    const struct consumer *c = arg;
+    unsigned long seen = 0;
+    unsigned int i;
+    int again, last = 0;
+
+    for ( ; ; )
+    {
+        do {
+            again = 0;
+            for ( i = c->first_cpu; i < c->end_cpu; i++ )
+                if ( tbufs->meta[i] )
+                    again |= consume_buffer(i);
+        } while ( again && !last && !interrupted );
+
+        if ( last )
+            break;
+
+        pthread_mutex_lock(&wakeup_lock);
+        while ( wakeup_gen == seen && !stopping )
+            pthread_cond_wait(&wakeup_cond, &wakeup_lock);
+        seen = wakeup_gen;
+        /* Have one more go at the buffers after being told to stop */
+        last = stopping;
+        pthread_mutex_unlock(&wakeup_lock);
+    }
+
+    return NULL;
+}
+
+static void wake_consumers(int stop)
+{
+    pthread_mutex_lock(&wakeup_lock);
+    wakeup_gen++;
+    stopping |= stop;
+    pthread_cond_broadcast(&wakeup_cond);
+    pthread_mutex_unlock(&wakeup_lock);
+}
+
+/**
+ * open_cpu_files - open an output file per CPU, <outfile>.<cpu>
+ */
+static void open_cpu_files(unsigned int num)
+{
+    unsigned int i;
+    size_t len = strlen(opts.outfile) + 12;
+    char name[len];
+
+    cpu_fds = calloc(num, sizeof(*cpu_fds));
+    if ( cpu_fds == NULL )
+    {
+        PERROR("Failed to allocate memory for output files");
+        exit(EXIT_FAILURE);
+    }
+
+    for ( i = 0; i < num; i++ )
+    {
+        cpu_fds[i] = -1;
+        if ( !tbufs->meta[i] )
+            continue;
+
+        snprintf(name, len, "%s.%u", opts.outfile, i);
+        cpu_fds[i] = open(name, O_WRONLY | O_CREAT | O_TRUNC | O_LARGEFILE,
+                          0644);
+        if ( cpu_fds[i] < 0 )
+        {
+            PERROR("Could not open output file %s", name);
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
 /**
  * monitor_tbufs - monitor the contents of tbufs and output to a file
  * @logfile:       the FILE * representing the file to log to
  */
 static int monitor_tbufs(void)
 {
-    int i;
+    unsigned int i;
 
-    struct t_struct *tbufs;      /* Pointer to hypervisor maps */
-    struct t_buf **meta;         /* pointers to the trace buffer metadata    */
-    unsigned char **data;        /* pointers to the trace buffer data areas
-                                  * where they are mapped into user space.   */
+    struct consumer *consumers;  /* consumer threads                         */
     unsigned long tbufs_mfn;     /* mfn of the tbufs                         */
     unsigned int  num;           /* number of trace buffers / logical CPUS   */
+    unsigned int  per_thread;    /* number of CPUs per consumer thread       */
     unsigned long tinfo_size;    /* size of t_info metadata map */
     unsigned long size;          /* size of a single trace buffer            */
-
-    unsigned long data_size;
-
-    int last_read = 1;
+    sigset_t sigs, oldsigs;
+    int rc;
 
     /* prepare to listen for VIRQ_TBUF */
     event_init();
@@ -703,98 +901,85 @@ static int monitor_tbufs(void)
 
     data_size = size - sizeof(struct t_buf);
 
-    meta = tbufs->meta;
-    data = tbufs->data;
+    if ( opts.per_cpu_files )
+        open_cpu_files(num);
 
     if ( opts.discard )
         for ( i = 0; i < num; i++ )
-            if ( meta[i] )
-                meta[i]->cons = meta[i]->prod;
-
-    /* now, scan buffers for events */
-    while ( 1 )
-    {
-        for ( i = 0; i < num; i++ )
-        {
-            unsigned long start_offset, end_offset, window_size, cons, prod;
-
-            if ( !meta[i] )
-                continue;
+            if ( tbufs->meta[i] )
+                tbufs->meta[i]->cons = tbufs->meta[i]->prod;
 
-            /* Read window information only once. */
-            cons = meta[i]->cons;
-            prod = meta[i]->prod;
-            xen_rmb(); /* read prod, then read item. */
+    if ( opts.threads > num )
+        opts.threads = num;
+    per_thread = (num + opts.threads - 1) / opts.threads;
+    opts.threads = (num + per_thread - 1) / per_thread;
 
-            if ( cons == prod )
-                continue;
-           
-            assert(cons < 2*data_size);
-            assert(prod < 2*data_size);
-
-            // NB: if (prod<cons), then (prod-cons)%data_size will not yield
-            // the correct answer because data_size is not a power of 2.
-            if ( prod < cons )
-                window_size = (prod + 2*data_size) - cons;
-            else
-                window_size = prod - cons;
-            assert(window_size > 0);
-            assert(window_size <= data_size);
-
-            start_offset = cons % data_size;
-            end_offset = prod % data_size;
-
-            if ( end_offset > start_offset )
-            {
-                /* If window does not wrap, write in one big chunk */
-                write_buffer(i, data[i]+start_offset,
-                             window_size,
-                             window_size);
-            }
-            else
-            {
-                /* If wrapped, write in two chunks:
-                 * - first, start to the end of the buffer
-                 * - second, start of buffer to end of window
-                 */
-                write_buffer(i, data[i] + start_offset,
-                             data_size - start_offset,
-                             window_size);
-                write_buffer(i, data[i],
-                             end_offset,
-                             0);
-            }
+    consumers = calloc(opts.threads, sizeof(*consumers));
+    if ( consumers == NULL )
+    {
+        PERROR("Failed to allocate memory for consumer threads");
+        exit(EXIT_FAILURE);
+    }
 
-            xen_mb(); /* read buffer, then update cons. */
-            meta[i]->cons = prod;
+    /* Signals are to be taken by this thread only */
+    sigemptyset(&sigs);
+    sigaddset(&sigs, SIGHUP);
+    sigaddset(&sigs, SIGTERM);
+    sigaddset(&sigs, SIGINT);
+    sigaddset(&sigs, SIGALRM);
+    pthread_sigmask(SIG_BLOCK, &sigs, &oldsigs);
 
-        }
-
-        if ( interrupted )
+    /* now, start scanning buffers for events */
+    for ( i = 0; i < opts.threads; i++ )
+    {
+        consumers[i].first_cpu = i * per_thread;
+        consumers[i].end_cpu = consumers[i].first_cpu + per_thread;
+        if ( consumers[i].end_cpu > num )
+            consumers[i].end_cpu = num;
+
+        rc = pthread_create(&consumers[i].thread, NULL, consumer_thread,
+                            &consumers[i]);
+        if ( rc )
         {
-            if ( last_read )
-            {
-                /* Disable tracing, then read through all the buffers one last time */
-                if ( opts.disable_tracing )
-                    disable_tbufs();
-                last_read = 0;
-                continue;
-            }
-            else
-                break;
+            errno = rc;
+            PERROR("Failed to create consumer thread");
+            exit(EXIT_FAILURE);
         }
+    }
+
+    pthread_sigmask(SIG_SETMASK, &oldsigs, NULL);
 
+    while ( !interrupted )
+    {
         wait_for_event_or_timeout(opts.poll_sleep);
+        wake_consumers(0);
     }
 
+    /* Disable tracing, then read through all the buffers one last time */
+    if ( opts.disable_tracing )
+        disable_tbufs();
+    wake_consumers(1);
+
+    for ( i = 0; i < opts.threads; i++ )
+        pthread_join(consumers[i].thread, NULL);
+
     if ( opts.memory_buffer )
         membuf_dump();
 
     /* cleanup */
-    free(meta);
-    free(data);
+    free(consumers);
+    free(tbufs->meta);
+    free(tbufs->data);
     /* don't need to munmap - cleanup is automatic */
-    close(outfd);
+    if ( cpu_fds )
+    {
+        for ( i = 0; i < num; i++ )
+            if ( cpu_fds[i] >= 0 )
+                close(cpu_fds[i]);
+        free(cpu_fds);
+    }
+    else
+        close(outfd);
 
     return 0;
 }
@@ -821,7 +1006,9 @@ static void usage(void)
 "  -e, --evt-mask=e        Set evt-mask\n" \
 "  -s, --poll-sleep=p      Set sleep time, p, in milliseconds between\n" \
 "                          polling the trace buffer for new data\n" \
-"                          (default " xstr(POLL_SLEEP_MILLIS) ").\n" \
+"                          (default " xstr(POLL_SLEEP_MILLIS) ").  With 0, the\n" \
+"                          buffers are only read when Xen signals that\n" \
+"                          one of them is half full.\n" \
 "  -S, --trace-buf-size=N  Set trace buffer size in pages (default " \
                            xstr(DEFAULT_TBUF_SIZE) ").\n" \
 "                          N.B. that the trace buffer cannot be resized.\n" \
@@ -845,6 +1032,11 @@ static void usage(void)
 "  -r  --reserve-disk-space=n Before writing trace records to disk, check to see\n" \
 "                          that after the write there will be at least n space\n" \
 "                          left on the disk.\n" \
+"  -j  --threads=n         Read the trace buffers with n threads, each\n" \
+"                          looking after a group of CPUs (default 1).\n" \
+"  -P  --per-cpu-files     Write the records of each CPU to a file of its\n" \
+"                          own, named after the output file with .<cpu>\n" \
+"                          appended.\n" \
 "\n" \
 "This tool is used to capture trace buffer data from Xen. The\n" \
 "data is output in a binary format, in the following order:\n" \
@@ -1093,12 +1285,14 @@ static void parse_args(int argc, char **argv)
         { "discard-buffers", no_argument,      0, 'D' },
         { "dont-disable-tracing", no_argument, 0, 'x' },
         { "start-disabled", no_argument,       0, 'X' },
+        { "threads",        required_argument, 0, 'j' },
+        { "per-cpu-files",  no_argument,       0, 'P' },
         { "help",           no_argument,       0, '?' },
         { "version",        no_argument,       0, 'V' },
         { 0, 0, 0, 0 }
     };
 
-    while ( (option = getopt_long(argc, argv, "t:s:c:e:S:r:T:M:DxX?V",
+    while ( (option = getopt_long(argc, argv, "t:s:c:e:S:r:T:M:j:DxXP?V",
                     long_options, NULL)) != -1) 
     {
         switch ( option )
@@ -1147,6 +1341,16 @@ static void parse_args(int argc, char **argv)
             opts.memory_buffer = sargtol(optarg, 0);
             break;
 
+        case 'j': /* Number of consumer threads */
+            opts.threads = argtol(optarg, 0);
+            if ( opts.threads == 0 )
+                usage();
+            break;
+
+        case 'P': /* Output file per CPU */
+            opts.per_cpu_files = 1;
+            break;
+
         default:
             usage();
         }
@@ -1157,12 +1361,13 @@ static void parse_args(int argc, char **argv)
         usage();
 
     opts.outfile = argv[optind];
-}
 
-/* *BSD has no O_LARGEFILE */
-#ifndef O_LARGEFILE
-#define O_LARGEFILE	0
-#endif
+    if ( opts.per_cpu_files && opts.memory_buffer )
+    {
+        fprintf(stderr, "Cannot use a memory buffer with per-CPU files.\n");
+        exit(EXIT_FAILURE);
+    }
+}
 
 int main(int argc, char **argv)
 {
@@ -1177,6 +1382,7 @@ int main(int argc, char **argv)
     opts.disable_tracing = 1;
     opts.start_disabled = 0;
     opts.timeout = 0;
+    opts.threads = 1;
 
     parse_args(argc, argv);
 
@@ -1199,26 +1405,37 @@ int main(int argc, char **argv)
     if ( opts.timeout != 0 ) 
         alarm(opts.timeout);
 
-    if ( opts.outfile )
+    /* Per-CPU files are opened once the buffers are mapped */
+    if ( opts.outfile && !opts.per_cpu_files )
+    {
         outfd = open(opts.outfile,
                      O_WRONLY | O_CREAT | O_TRUNC | O_LARGEFILE,
                      0644);
 
-    if ( outfd < 0 )
-    {
-        perror("Could not open output file");
-        exit(EXIT_FAILURE);
-    }        
+        if ( outfd < 0 )
+        {
+            perror("Could not open output file");
+            exit(EXIT_FAILURE);
+        }
 
-    if ( isatty(outfd) )
-    {
-        fprintf(stderr, "Cannot output to a TTY, specify a log file.\n");
-        exit(EXIT_FAILURE);
+        if ( isatty(outfd) )
+        {
+            fprintf(stderr, "Cannot output to a TTY, specify a log file.\n");
+            exit(EXIT_FAILURE);
+        }
     }
 
     if ( opts.memory_buffer > 0 )
         membuf_alloc(opts.memory_buffer);
 
+    if ( pipe(signal_pipe) ||
+         fcntl(signal_pipe[0], F_SETFL, O_NONBLOCK) ||
+         fcntl(signal_pipe[1], F_SETFL, O_NONBLOCK) )
+    {
+        perror("Could not create signal pipe");
+        exit(EXIT_FAILURE);
+    }
+
     /* ensure that if we get a signal, we'll do cleanup, then exit */
     act.sa_handler = close_handler;
     act.sa_flags = 0;
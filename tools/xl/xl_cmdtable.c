@@ -285,6 +285,14 @@ struct cmd_spec cmd_table[] = {
       "-b BUDGET, --budget=BUDGET     Budget (us)\n"
       "-e Extratime, --extratime=Extratime Extratime (1=yes, 0=no)\n"
     },
+    { "sched-stats",
+      &main_sched_stats, 0, 0,
+      "Show scheduling latency statistics",
+      "[-d <Domain> | -c <CPU>] [-r]",
+      "-d DOMAIN, --domain=DOMAIN     Show histograms of DOMAIN\n"
+      "-c CPU,    --cpu=CPU           Show histograms of physical CPU\n"
+      "-r,        --reset             Reset all statistics"
+    },
     { "domid",
       &main_domid, 0, 0,
       "Convert a domain name to domain id",
@@ -331,6 +339,13 @@ struct cmd_spec cmd_table[] = {
       "Monitor a host and the domains in real time",
       "",
     },
+    { "hypercall-stats",
+      &main_hypercall_stats, 0, 0,
+      "Show hypercall counts and latencies",
+      "[-d <Domain> [-l]]",
+      "-d DOMAIN, --domain=DOMAIN     Show each hypercall of DOMAIN\n"
+      "-l,        --latency           Show latency histograms as well"
+    },
     { "network-attach",
       &main_networkattach, 1, 1,
       "Create a new virtual network device",
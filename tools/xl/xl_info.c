@@ -27,6 +27,7 @@
 #include <libxl_json.h>
 #include <libxl_utils.h>
 #include <libxlutil.h>
+#include <xen/xen.h>
 
 #include "xl.h"
 #include "xl_utils.h"
@@ -925,6 +926,260 @@ int main_top(int argc, char **argv)
     return system("xentop");
 }
 
+#define HCALL(x) [__HYPERVISOR_ ## x] = #x
+static const char *const hypercall_names[] = {
+    HCALL(set_trap_table),
+    HCALL(mmu_update),
+    HCALL(set_gdt),
+    HCALL(stack_switch),
+    HCALL(set_callbacks),
+    HCALL(fpu_taskswitch),
+    HCALL(sched_op_compat),
+    HCALL(platform_op),
+    HCALL(set_debugreg),
+    HCALL(get_debugreg),
+    HCALL(update_descriptor),
+    HCALL(memory_op),
+    HCALL(multicall),
+    HCALL(update_va_mapping),
+    HCALL(set_timer_op),
+    HCALL(event_channel_op_compat),
+    HCALL(xen_version),
+    HCALL(console_io),
+    HCALL(physdev_op_compat),
+    HCALL(grant_table_op),
+    HCALL(vm_assist),
+    HCALL(update_va_mapping_otherdomain),
+    HCALL(iret),
+    HCALL(vcpu_op),
+    HCALL(set_segment_base),
+    HCALL(mmuext_op),
+    HCALL(xsm_op),
+    HCALL(nmi_op),
+    HCALL(sched_op),
+    HCALL(callback_op),
+    HCALL(xenoprof_op),
+    HCALL(event_channel_op),
+    HCALL(physdev_op),
+    HCALL(hvm_op),
+    HCALL(sysctl),
+    HCALL(domctl),
+    HCALL(kexec_op),
+    HCALL(tmem_op),
+    HCALL(argo_op),
+    HCALL(xenpmu_op),
+    HCALL(dm_op),
+    HCALL(arch_0),
+    HCALL(arch_1),
+    HCALL(arch_2),
+    HCALL(arch_3),
+    HCALL(arch_4),
+    HCALL(arch_5),
+    HCALL(arch_6),
+    HCALL(arch_7),
+};
+#undef HCALL
+
+static void hypercall_name(char *buf, size_t len, unsigned int nr)
+{
+    if (nr < sizeof(hypercall_names) / sizeof(hypercall_names[0]) &&
+        hypercall_names[nr])
+        snprintf(buf, len, "%s", hypercall_names[nr]);
+    else
+        snprintf(buf, len, "hypercall_%u", nr);
+}
+
+/*
+ * Upper bound, in ns, of the latencies counted in bucket b of a hypercall
+ * latency histogram (see XEN_SYSCTL_hypercall_stats).
+ */
+static uint64_t hypercall_bucket_limit(int b)
+{
+    return 1ULL << (b + 9);
+}
+
+static void hypercall_format_ns(char *buf, size_t len, uint64_t ns)
+{
+    if (ns < 1000)
+        snprintf(buf, len, "%"PRIu64"ns", ns);
+    else if (ns < 1000000)
+        snprintf(buf, len, "%"PRIu64"us", ns / 1000);
+    else if (ns < 1000000000)
+        snprintf(buf, len, "%"PRIu64"ms", ns / 1000000);
+    else
+        snprintf(buf, len, "%"PRIu64"s", ns / 1000000000);
+}
+
+/* "<limit" of the bucket below which lie pct percent of the calls, or "-". */
+static void hypercall_format_percentile(char *buf, size_t len,
+                                        const libxl_hypercall_op_stats *op,
+                                        int pct)
+{
+    uint64_t sum = 0;
+    char limit[16];
+    int b;
+
+    if (!op->calls) {
+        snprintf(buf, len, "-");
+        return;
+    }
+
+    for (b = 0; b < op->num_latency - 1; b++) {
+        sum += op->latency[b];
+        if (sum * 100 >= op->calls * pct)
+            break;
+    }
+
+    if (b == op->num_latency - 1) {
+        hypercall_format_ns(limit, sizeof(limit),
+                            hypercall_bucket_limit(b - 1));
+        snprintf(buf, len, ">%s", limit);
+    } else {
+        hypercall_format_ns(limit, sizeof(limit), hypercall_bucket_limit(b));
+        snprintf(buf, len, "<%s", limit);
+    }
+}
+
+static void hypercall_hist_output(const libxl_hypercall_op_stats *op)
+{
+    char lo[16], hi[16];
+    int b;
+
+    for (b = 0; b < op->num_latency; b++) {
+        if (!op->latency[b])
+            continue;
+        hypercall_format_ns(lo, sizeof(lo),
+                            b ? hypercall_bucket_limit(b - 1) : 0);
+        if (b == op->num_latency - 1)
+            snprintf(hi, sizeof(hi), "inf");
+        else
+            hypercall_format_ns(hi, sizeof(hi), hypercall_bucket_limit(b));
+        printf("    [%6s, %6s) %12"PRIu64"\n", lo, hi, op->latency[b]);
+    }
+}
+
+static int hypercall_stats_domain_output(uint32_t domid, bool histograms)
+{
+    libxl_domain_hypercall_stats stats;
+    char name[32], avg[16], p50[16], p99[16];
+    int i, rc;
+
+    libxl_domain_hypercall_stats_init(&stats);
+    rc = libxl_domain_hypercall_stats_get(ctx, domid, &stats);
+    if (rc)
+        goto out;
+
+    printf("%-30s %12s %10s %10s %8s %8s %8s\n", "Hypercall", "Calls",
+           "Preempted", "Time(ms)", "Avg", "p50", "p99");
+    for (i = 0; i < stats.num_ops; i++) {
+        const libxl_hypercall_op_stats *op = &stats.ops[i];
+
+        if (!op->calls)
+            continue;
+
+        hypercall_name(name, sizeof(name), i);
+        hypercall_format_ns(avg, sizeof(avg), op->time_ns / op->calls);
+        hypercall_format_percentile(p50, sizeof(p50), op, 50);
+        hypercall_format_percentile(p99, sizeof(p99), op, 99);
+        printf("%-30s %12"PRIu64" %10"PRIu64" %10"PRIu64" %8s %8s %8s\n",
+               name, op->calls, op->preempted, op->time_ns / 1000000,
+               avg, p50, p99);
+        if (histograms)
+            hypercall_hist_output(op);
+    }
+
+ out:
+    libxl_domain_hypercall_stats_dispose(&stats);
+    return rc;
+}
+
+static int hypercall_stats_domains_output(void)
+{
+    libxl_dominfo *info;
+    libxl_domain_hypercall_stats stats;
+    char top[32];
+    char *domname;
+    uint64_t calls, preempted, time_ns, top_ns;
+    int i, j, nb_domain, rc = 0;
+
+    info = libxl_list_domain(ctx, &nb_domain);
+    if (!info) {
+        fprintf(stderr, "libxl_list_domain failed.\n");
+        return 1;
+    }
+
+    libxl_domain_hypercall_stats_init(&stats);
+
+    printf("%-33s %4s %12s %10s %10s  %s\n", "Name", "ID", "Calls",
+           "Preempted", "Time(ms)", "Most time in");
+    for (i = 0; i < nb_domain; i++) {
+        if (libxl_domain_hypercall_stats_get(ctx, info[i].domid, &stats)) {
+            rc = 1;
+            continue;
+        }
+
+        calls = preempted = time_ns = top_ns = 0;
+        snprintf(top, sizeof(top), "-");
+        for (j = 0; j < stats.num_ops; j++) {
+            calls += stats.ops[j].calls;
+            preempted += stats.ops[j].preempted;
+            time_ns += stats.ops[j].time_ns;
+            if (stats.ops[j].time_ns > top_ns) {
+                top_ns = stats.ops[j].time_ns;
+                hypercall_name(top, sizeof(top), j);
+            }
+        }
+
+        domname = libxl_domid_to_name(ctx, info[i].domid);
+        printf("%-33s %4d %12"PRIu64" %10"PRIu64" %10"PRIu64"  %s\n",
+               domname ? domname : "", info[i].domid, calls, preempted,
+               time_ns / 1000000, top);
+        free(domname);
+    }
+
+    libxl_domain_hypercall_stats_dispose(&stats);
+    libxl_dominfo_list_free(info, nb_domain);
+
+    return rc;
+}
+
+/*
+ * <nothing>   : Summary of the hypercalls of all domains
+ * -d [domid]  : Per hypercall statistics of a domain
+ * -l          : ... with their latency histograms
+ */
+int main_hypercall_stats(int argc, char **argv)
+{
+    const char *dom = NULL;
+    bool histograms = false;
+    int opt;
+    static struct option opts[] = {
+        {"domain", 1, 0, 'd'},
+        {"latency", 0, 0, 'l'},
+        COMMON_LONG_OPTS
+    };
+
+    SWITCH_FOREACH_OPT(opt, "d:l", opts, "hypercall-stats", 0) {
+    case 'd':
+        dom = optarg;
+        break;
+    case 'l':
+        histograms = true;
+        break;
+    }
+
+    if (histograms && !dom) {
+        fprintf(stderr, "Latency histograms are only shown for a domain.\n");
+        return EXIT_FAILURE;
+    }
+
+    if (!dom)
+        return hypercall_stats_domains_output() ? EXIT_FAILURE : EXIT_SUCCESS;
+
+    return hypercall_stats_domain_output(find_domain(dom), histograms)
+           ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
 
 /*
  * Local variables:
@@ -923,6 +923,215 @@ out:
     return r;
 }
 
+/* Upper bound, in ns, of the values counted in a latency histogram bucket. */
+static uint64_t sched_latency_bucket_limit(int b)
+{
+    return 1ULL << (b + 10);
+}
+
+/* Bucket below which lie (at least) pct percent of the samples. */
+static int sched_latency_percentile(const uint64_t *hist, int nr, int pct)
+{
+    uint64_t total = 0, sum = 0;
+    int b;
+
+    for (b = 0; b < nr; b++)
+        total += hist[b];
+    if (!total)
+        return -1;
+
+    for (b = 0; b < nr; b++) {
+        sum += hist[b];
+        if (sum * 100 >= total * pct)
+            break;
+    }
+
+    return b;
+}
+
+static void sched_latency_format(char *buf, size_t len, uint64_t ns)
+{
+    if (ns < 1000000)
+        snprintf(buf, len, "%"PRIu64"us", ns / 1000);
+    else if (ns < 1000000000)
+        snprintf(buf, len, "%"PRIu64"ms", ns / 1000000);
+    else
+        snprintf(buf, len, "%"PRIu64"s", ns / 1000000000);
+}
+
+/* Print "<=limit" for bucket b of a histogram with nr buckets, or "-". */
+static void sched_latency_format_bucket(char *buf, size_t len, int b, int nr)
+{
+    char limit[16];
+
+    if (b < 0) {
+        snprintf(buf, len, "-");
+        return;
+    }
+    sched_latency_format(limit, sizeof(limit),
+                         sched_latency_bucket_limit(b == nr - 1 ? b - 1 : b));
+    snprintf(buf, len, "%s%s", b == nr - 1 ? ">" : "<", limit);
+}
+
+static uint64_t sched_latency_total(const uint64_t *hist, int nr)
+{
+    uint64_t total = 0;
+    int b;
+
+    for (b = 0; b < nr; b++)
+        total += hist[b];
+
+    return total;
+}
+
+static void sched_latency_hist_output(const char *title,
+                                      const uint64_t *hist, int nr)
+{
+    char lo[16], hi[16];
+    int b;
+
+    printf("%s (%"PRIu64" samples):\n", title,
+           sched_latency_total(hist, nr));
+    for (b = 0; b < nr; b++) {
+        if (!hist[b])
+            continue;
+        sched_latency_format(lo, sizeof(lo),
+                             b ? sched_latency_bucket_limit(b - 1) : 0);
+        if (b == nr - 1)
+            snprintf(hi, sizeof(hi), "inf");
+        else
+            sched_latency_format(hi, sizeof(hi),
+                                 sched_latency_bucket_limit(b));
+        printf("  [%6s, %6s) %12"PRIu64"\n", lo, hi, hist[b]);
+    }
+}
+
+static void sched_latency_stats_output(const libxl_sched_latency_stats *stats)
+{
+    sched_latency_hist_output("Wake-to-run latency", stats->wake_to_run,
+                              stats->num_wake_to_run);
+    sched_latency_hist_output("Run slice length", stats->run_slice,
+                              stats->num_run_slice);
+    printf("Migrations: %"PRIu64"\n", stats->migrations);
+}
+
+static int sched_latency_domains_output(void)
+{
+    libxl_dominfo *info;
+    libxl_sched_latency_stats stats;
+    char w50[16], w99[16], r50[16];
+    char *domname;
+    int i, nb_domain, rc = 0;
+
+    info = libxl_list_domain(ctx, &nb_domain);
+    if (!info) {
+        fprintf(stderr, "libxl_list_domain failed.\n");
+        return 1;
+    }
+
+    libxl_sched_latency_stats_init(&stats);
+
+    printf("%-33s %4s %10s %8s %8s %10s %8s %10s\n", "Name", "ID",
+           "Wakeups", "W2R-p50", "W2R-p99", "Slices", "Run-p50", "Migrations");
+    for (i = 0; i < nb_domain; i++) {
+        if (libxl_sched_latency_get_domain(ctx, info[i].domid, &stats)) {
+            rc = 1;
+            continue;
+        }
+
+        sched_latency_format_bucket(w50, sizeof(w50),
+            sched_latency_percentile(stats.wake_to_run,
+                                     stats.num_wake_to_run, 50),
+            stats.num_wake_to_run);
+        sched_latency_format_bucket(w99, sizeof(w99),
+            sched_latency_percentile(stats.wake_to_run,
+                                     stats.num_wake_to_run, 99),
+            stats.num_wake_to_run);
+        sched_latency_format_bucket(r50, sizeof(r50),
+            sched_latency_percentile(stats.run_slice,
+                                     stats.num_run_slice, 50),
+            stats.num_run_slice);
+
+        domname = libxl_domid_to_name(ctx, info[i].domid);
+        printf("%-33s %4d %10"PRIu64" %8s %8s %10"PRIu64" %8s %10"PRIu64"\n",
+               domname ? domname : "",
+               info[i].domid,
+               sched_latency_total(stats.wake_to_run, stats.num_wake_to_run),
+               w50, w99,
+               sched_latency_total(stats.run_slice, stats.num_run_slice),
+               r50, stats.migrations);
+        free(domname);
+    }
+
+    libxl_sched_latency_stats_dispose(&stats);
+    libxl_dominfo_list_free(info, nb_domain);
+
+    return rc;
+}
+
+/*
+ * <nothing>   : Summary of the scheduling latency of all domains
+ * -d [domid]  : Latency histograms of a domain
+ * -c [cpu]    : Latency histograms of a pCPU
+ * -r          : Reset all statistics
+ */
+int main_sched_stats(int argc, char **argv)
+{
+    const char *dom = NULL;
+    const char *cpu = NULL;
+    bool opt_r = false;
+    libxl_sched_latency_stats stats;
+    int opt, rc;
+    static struct option opts[] = {
+        {"domain", 1, 0, 'd'},
+        {"cpu", 1, 0, 'c'},
+        {"reset", 0, 0, 'r'},
+        COMMON_LONG_OPTS
+    };
+
+    SWITCH_FOREACH_OPT(opt, "d:c:r", opts, "sched-stats", 0) {
+    case 'd':
+        dom = optarg;
+        break;
+    case 'c':
+        cpu = optarg;
+        break;
+    case 'r':
+        opt_r = true;
+        break;
+    }
+
+    if (dom && cpu) {
+        fprintf(stderr, "Specifying both a domain and a cpu is not "
+                "allowed.\n");
+        return EXIT_FAILURE;
+    }
+
+    if (opt_r) {
+        if (dom || cpu) {
+            fprintf(stderr, "Statistics can only be reset globally.\n");
+            return EXIT_FAILURE;
+        }
+        if (libxl_sched_latency_reset(ctx))
+            return EXIT_FAILURE;
+        return EXIT_SUCCESS;
+    }
+
+    if (!dom && !cpu)
+        return sched_latency_domains_output() ? EXIT_FAILURE : EXIT_SUCCESS;
+
+    libxl_sched_latency_stats_init(&stats);
+    if (dom)
+        rc = libxl_sched_latency_get_domain(ctx, find_domain(dom), &stats);
+    else
+        rc = libxl_sched_latency_get_cpu(ctx, strtoul(cpu, NULL, 10), &stats);
+    if (!rc)
+        sched_latency_stats_output(&stats);
+    libxl_sched_latency_stats_dispose(&stats);
+
+    return rc ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
 /*
  * Local variables:
  * mode: C
@@ -1517,6 +1517,7 @@ int p2m_init(struct domain *d)
     unsigned int cpu;
 
     rwlock_init(&p2m->lock);
+    rwlock_set_class(&p2m->lock, LOCK_CLASS_P2M);
     INIT_PAGE_LIST_HEAD(&p2m->pages);
 
     p2m->vmid = INVALID_VMID;
@@ -0,0 +1,1126 @@
+	.file	"asm-offsets.c"
+	.text
+.Ltext0:
+	.cfi_sections	.debug_frame
+	.file 0 "/root/repo/xen/arch/x86" "x86_64/asm-offsets.c"
+#APP
+	.equ X86_FEATURE_FPU, 0*32+ 0
+	.equ X86_FEATURE_VME, 0*32+ 1
+	.equ X86_FEATURE_DE, 0*32+ 2
+	.equ X86_FEATURE_PSE, 0*32+ 3
+	.equ X86_FEATURE_TSC, 0*32+ 4
+	.equ X86_FEATURE_MSR, 0*32+ 5
+	.equ X86_FEATURE_PAE, 0*32+ 6
+	.equ X86_FEATURE_MCE, 0*32+ 7
+	.equ X86_FEATURE_CX8, 0*32+ 8
+	.equ X86_FEATURE_APIC, 0*32+ 9
+	.equ X86_FEATURE_SEP, 0*32+11
+	.equ X86_FEATURE_MTRR, 0*32+12
+	.equ X86_FEATURE_PGE, 0*32+13
+	.equ X86_FEATURE_MCA, 0*32+14
+	.equ X86_FEATURE_CMOV, 0*32+15
+	.equ X86_FEATURE_PAT, 0*32+16
+	.equ X86_FEATURE_PSE36, 0*32+17
+	.equ X86_FEATURE_CLFLUSH, 0*32+19
+	.equ X86_FEATURE_DS, 0*32+21
+	.equ X86_FEATURE_ACPI, 0*32+22
+	.equ X86_FEATURE_MMX, 0*32+23
+	.equ X86_FEATURE_FXSR, 0*32+24
+	.equ X86_FEATURE_SSE, 0*32+25
+	.equ X86_FEATURE_SSE2, 0*32+26
+	.equ X86_FEATURE_SS, 0*32+27
+	.equ X86_FEATURE_HTT, 0*32+28
+	.equ X86_FEATURE_TM1, 0*32+29
+	.equ X86_FEATURE_PBE, 0*32+31
+	.equ X86_FEATURE_SSE3, 1*32+ 0
+	.equ X86_FEATURE_PCLMULQDQ, 1*32+ 1
+	.equ X86_FEATURE_DTES64, 1*32+ 2
+	.equ X86_FEATURE_MONITOR, 1*32+ 3
+	.equ X86_FEATURE_DSCPL, 1*32+ 4
+	.equ X86_FEATURE_VMX, 1*32+ 5
+	.equ X86_FEATURE_SMX, 1*32+ 6
+	.equ X86_FEATURE_EIST, 1*32+ 7
+	.equ X86_FEATURE_TM2, 1*32+ 8
+	.equ X86_FEATURE_SSSE3, 1*32+ 9
+	.equ X86_FEATURE_FMA, 1*32+12
+	.equ X86_FEATURE_CX16, 1*32+13
+	.equ X86_FEATURE_XTPR, 1*32+14
+	.equ X86_FEATURE_PDCM, 1*32+15
+	.equ X86_FEATURE_PCID, 1*32+17
+	.equ X86_FEATURE_DCA, 1*32+18
+	.equ X86_FEATURE_SSE4_1, 1*32+19
+	.equ X86_FEATURE_SSE4_2, 1*32+20
+	.equ X86_FEATURE_X2APIC, 1*32+21
+	.equ X86_FEATURE_MOVBE, 1*32+22
+	.equ X86_FEATURE_POPCNT, 1*32+23
+	.equ X86_FEATURE_TSC_DEADLINE, 1*32+24
+	.equ X86_FEATURE_AESNI, 1*32+25
+	.equ X86_FEATURE_XSAVE, 1*32+26
+	.equ X86_FEATURE_OSXSAVE, 1*32+27
+	.equ X86_FEATURE_AVX, 1*32+28
+	.equ X86_FEATURE_F16C, 1*32+29
+	.equ X86_FEATURE_RDRAND, 1*32+30
+	.equ X86_FEATURE_HYPERVISOR, 1*32+31
+	.equ X86_FEATURE_SYSCALL, 2*32+11
+	.equ X86_FEATURE_NX, 2*32+20
+	.equ X86_FEATURE_MMXEXT, 2*32+22
+	.equ X86_FEATURE_FFXSR, 2*32+25
+	.equ X86_FEATURE_PAGE1GB, 2*32+26
+	.equ X86_FEATURE_RDTSCP, 2*32+27
+	.equ X86_FEATURE_LM, 2*32+29
+	.equ X86_FEATURE_3DNOWEXT, 2*32+30
+	.equ X86_FEATURE_3DNOW, 2*32+31
+	.equ X86_FEATURE_LAHF_LM, 3*32+ 0
+	.equ X86_FEATURE_CMP_LEGACY, 3*32+ 1
+	.equ X86_FEATURE_SVM, 3*32+ 2
+	.equ X86_FEATURE_EXTAPIC, 3*32+ 3
+	.equ X86_FEATURE_CR8_LEGACY, 3*32+ 4
+	.equ X86_FEATURE_ABM, 3*32+ 5
+	.equ X86_FEATURE_SSE4A, 3*32+ 6
+	.equ X86_FEATURE_MISALIGNSSE, 3*32+ 7
+	.equ X86_FEATURE_3DNOWPREFETCH, 3*32+ 8
+	.equ X86_FEATURE_OSVW, 3*32+ 9
+	.equ X86_FEATURE_IBS, 3*32+10
+	.equ X86_FEATURE_XOP, 3*32+11
+	.equ X86_FEATURE_SKINIT, 3*32+12
+	.equ X86_FEATURE_WDT, 3*32+13
+	.equ X86_FEATURE_LWP, 3*32+15
+	.equ X86_FEATURE_FMA4, 3*32+16
+	.equ X86_FEATURE_NODEID_MSR, 3*32+19
+	.equ X86_FEATURE_TBM, 3*32+21
+	.equ X86_FEATURE_TOPOEXT, 3*32+22
+	.equ X86_FEATURE_DBEXT, 3*32+26
+	.equ X86_FEATURE_MONITORX, 3*32+29
+	.equ X86_FEATURE_XSAVEOPT, 4*32+ 0
+	.equ X86_FEATURE_XSAVEC, 4*32+ 1
+	.equ X86_FEATURE_XGETBV1, 4*32+ 2
+	.equ X86_FEATURE_XSAVES, 4*32+ 3
+	.equ X86_FEATURE_FSGSBASE, 5*32+ 0
+	.equ X86_FEATURE_TSC_ADJUST, 5*32+ 1
+	.equ X86_FEATURE_SGX, 5*32+ 2
+	.equ X86_FEATURE_BMI1, 5*32+ 3
+	.equ X86_FEATURE_HLE, 5*32+ 4
+	.equ X86_FEATURE_AVX2, 5*32+ 5
+	.equ X86_FEATURE_FDP_EXCP_ONLY, 5*32+ 6
+	.equ X86_FEATURE_SMEP, 5*32+ 7
+	.equ X86_FEATURE_BMI2, 5*32+ 8
+	.equ X86_FEATURE_ERMS, 5*32+ 9
+	.equ X86_FEATURE_INVPCID, 5*32+10
+	.equ X86_FEATURE_RTM, 5*32+11
+	.equ X86_FEATURE_PQM, 5*32+12
+	.equ X86_FEATURE_NO_FPU_SEL, 5*32+13
+	.equ X86_FEATURE_MPX, 5*32+14
+	.equ X86_FEATURE_PQE, 5*32+15
+	.equ X86_FEATURE_AVX512F, 5*32+16
+	.equ X86_FEATURE_AVX512DQ, 5*32+17
+	.equ X86_FEATURE_RDSEED, 5*32+18
+	.equ X86_FEATURE_ADX, 5*32+19
+	.equ X86_FEATURE_SMAP, 5*32+20
+	.equ X86_FEATURE_AVX512_IFMA, 5*32+21
+	.equ X86_FEATURE_CLFLUSHOPT, 5*32+23
+	.equ X86_FEATURE_CLWB, 5*32+24
+	.equ X86_FEATURE_AVX512PF, 5*32+26
+	.equ X86_FEATURE_AVX512ER, 5*32+27
+	.equ X86_FEATURE_AVX512CD, 5*32+28
+	.equ X86_FEATURE_SHA, 5*32+29
+	.equ X86_FEATURE_AVX512BW, 5*32+30
+	.equ X86_FEATURE_AVX512VL, 5*32+31
+	.equ X86_FEATURE_PREFETCHWT1, 6*32+ 0
+	.equ X86_FEATURE_AVX512_VBMI, 6*32+ 1
+	.equ X86_FEATURE_UMIP, 6*32+ 2
+	.equ X86_FEATURE_PKU, 6*32+ 3
+	.equ X86_FEATURE_OSPKE, 6*32+ 4
+	.equ X86_FEATURE_AVX512_VBMI2, 6*32+ 6
+	.equ X86_FEATURE_GFNI, 6*32+ 8
+	.equ X86_FEATURE_VAES, 6*32+ 9
+	.equ X86_FEATURE_VPCLMULQDQ, 6*32+10
+	.equ X86_FEATURE_AVX512_VNNI, 6*32+11
+	.equ X86_FEATURE_AVX512_BITALG, 6*32+12
+	.equ X86_FEATURE_AVX512_VPOPCNTDQ, 6*32+14
+	.equ X86_FEATURE_RDPID, 6*32+22
+	.equ X86_FEATURE_CLDEMOTE, 6*32+25
+	.equ X86_FEATURE_ITSC, 7*32+ 8
+	.equ X86_FEATURE_EFRO, 7*32+10
+	.equ X86_FEATURE_CLZERO, 8*32+ 0
+	.equ X86_FEATURE_RSTR_FP_ERR_PTRS, 8*32+ 2
+	.equ X86_FEATURE_WBNOINVD, 8*32+ 9
+	.equ X86_FEATURE_IBPB, 8*32+12
+	.equ X86_FEATURE_AVX512_4VNNIW, 9*32+ 2
+	.equ X86_FEATURE_AVX512_4FMAPS, 9*32+ 3
+	.equ X86_FEATURE_MD_CLEAR, 9*32+10
+	.equ X86_FEATURE_TSX_FORCE_ABORT, 9*32+13
+	.equ X86_FEATURE_IBRSB, 9*32+26
+	.equ X86_FEATURE_STIBP, 9*32+27
+	.equ X86_FEATURE_L1D_FLUSH, 9*32+28
+	.equ X86_FEATURE_ARCH_CAPS, 9*32+29
+	.equ X86_FEATURE_SSBD, 9*32+31
+	.equ X86_FEATURE_AVX512_BF16, 10*32+ 5
+	.equ X86_FEATURE_CONSTANT_TSC, (11 * 32 + (0))
+	.equ X86_FEATURE_NONSTOP_TSC, (11 * 32 + (1))
+	.equ X86_FEATURE_ARAT, (11 * 32 + (2))
+	.equ X86_FEATURE_ARCH_PERFMON, (11 * 32 + (3))
+	.equ X86_FEATURE_TSC_RELIABLE, (11 * 32 + (4))
+	.equ X86_FEATURE_XTOPOLOGY, (11 * 32 + (5))
+	.equ X86_FEATURE_CPUID_FAULTING, (11 * 32 + (6))
+	.equ X86_FEATURE_CLFLUSH_MONITOR, (11 * 32 + (7))
+	.equ X86_FEATURE_APERFMPERF, (11 * 32 + (8))
+	.equ X86_FEATURE_MFENCE_RDTSC, (11 * 32 + (9))
+	.equ X86_FEATURE_XEN_SMEP, (11 * 32 + (10))
+	.equ X86_FEATURE_XEN_SMAP, (11 * 32 + (11))
+	.equ X86_FEATURE_LFENCE_DISPATCH, (11 * 32 + (12))
+	.equ X86_FEATURE_IND_THUNK_LFENCE, (11 * 32 + (13))
+	.equ X86_FEATURE_IND_THUNK_JMP, (11 * 32 + (14))
+	.equ X86_FEATURE_SC_BRANCH_HARDEN, (11 * 32 + (15))
+	.equ X86_FEATURE_SC_MSR_PV, (11 * 32 + (16))
+	.equ X86_FEATURE_SC_MSR_HVM, (11 * 32 + (17))
+	.equ X86_FEATURE_SC_RSB_PV, (11 * 32 + (18))
+	.equ X86_FEATURE_SC_RSB_HVM, (11 * 32 + (19))
+	.equ X86_FEATURE_XEN_SELFSNOOP, (11 * 32 + (20))
+	.equ X86_FEATURE_SC_MSR_IDLE, (11 * 32 + (21))
+	.equ X86_FEATURE_XEN_LBR, (11 * 32 + (22))
+	.equ X86_FEATURE_SC_VERW_PV, (11 * 32 + (23))
+	.equ X86_FEATURE_SC_VERW_HVM, (11 * 32 + (24))
+	.equ X86_FEATURE_SC_VERW_IDLE, (11 * 32 + (25))
+	.include "/root/repo/xen/include/asm-x86/asm-macros.h"
+	.equ CONFIG_INDIRECT_THUNK, 1
+	.include "asm/indirect_thunk_asm.h"
+#NO_APP
+	.globl	__dummy__
+	.hidden	__dummy__
+	.type	__dummy__, @function
+__dummy__:
+.LFB605:
+	.file 1 "x86_64/asm-offsets.c"
+	.loc 1 26 1 view -0
+	.cfi_startproc
+	.loc 1 27 5 view .LVU1
+#APP
+# 27 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r15 $0 /* offsetof(struct cpu_user_regs, r15) */<=="
+# 0 "" 2
+	.loc 1 27 49 view .LVU2
+	.loc 1 28 5 view .LVU3
+# 28 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r14 $8 /* offsetof(struct cpu_user_regs, r14) */<=="
+# 0 "" 2
+	.loc 1 28 49 view .LVU4
+	.loc 1 29 5 view .LVU5
+# 29 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r13 $16 /* offsetof(struct cpu_user_regs, r13) */<=="
+# 0 "" 2
+	.loc 1 29 49 view .LVU6
+	.loc 1 30 5 view .LVU7
+# 30 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r12 $24 /* offsetof(struct cpu_user_regs, r12) */<=="
+# 0 "" 2
+	.loc 1 30 49 view .LVU8
+	.loc 1 31 5 view .LVU9
+# 31 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rbp $32 /* offsetof(struct cpu_user_regs, rbp) */<=="
+# 0 "" 2
+	.loc 1 31 49 view .LVU10
+	.loc 1 32 5 view .LVU11
+# 32 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rbx $40 /* offsetof(struct cpu_user_regs, rbx) */<=="
+# 0 "" 2
+	.loc 1 32 49 view .LVU12
+	.loc 1 33 5 view .LVU13
+# 33 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r11 $48 /* offsetof(struct cpu_user_regs, r11) */<=="
+# 0 "" 2
+	.loc 1 33 49 view .LVU14
+	.loc 1 34 5 view .LVU15
+# 34 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r10 $56 /* offsetof(struct cpu_user_regs, r10) */<=="
+# 0 "" 2
+	.loc 1 34 49 view .LVU16
+	.loc 1 35 5 view .LVU17
+# 35 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r9 $64 /* offsetof(struct cpu_user_regs, r9) */<=="
+# 0 "" 2
+	.loc 1 35 47 view .LVU18
+	.loc 1 36 5 view .LVU19
+# 36 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_r8 $72 /* offsetof(struct cpu_user_regs, r8) */<=="
+# 0 "" 2
+	.loc 1 36 47 view .LVU20
+	.loc 1 37 5 view .LVU21
+# 37 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rax $80 /* offsetof(struct cpu_user_regs, rax) */<=="
+# 0 "" 2
+	.loc 1 37 49 view .LVU22
+	.loc 1 38 5 view .LVU23
+# 38 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rcx $88 /* offsetof(struct cpu_user_regs, rcx) */<=="
+# 0 "" 2
+	.loc 1 38 49 view .LVU24
+	.loc 1 39 5 view .LVU25
+# 39 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rdx $96 /* offsetof(struct cpu_user_regs, rdx) */<=="
+# 0 "" 2
+	.loc 1 39 49 view .LVU26
+	.loc 1 40 5 view .LVU27
+# 40 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rsi $104 /* offsetof(struct cpu_user_regs, rsi) */<=="
+# 0 "" 2
+	.loc 1 40 49 view .LVU28
+	.loc 1 41 5 view .LVU29
+# 41 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rdi $112 /* offsetof(struct cpu_user_regs, rdi) */<=="
+# 0 "" 2
+	.loc 1 41 49 view .LVU30
+	.loc 1 42 5 view .LVU31
+# 42 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_error_code $120 /* offsetof(struct cpu_user_regs, error_code) */<=="
+# 0 "" 2
+	.loc 1 42 63 view .LVU32
+	.loc 1 43 5 view .LVU33
+# 43 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_entry_vector $124 /* offsetof(struct cpu_user_regs, entry_vector) */<=="
+# 0 "" 2
+	.loc 1 43 67 view .LVU34
+	.loc 1 44 5 view .LVU35
+# 44 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rip $128 /* offsetof(struct cpu_user_regs, rip) */<=="
+# 0 "" 2
+	.loc 1 44 49 view .LVU36
+	.loc 1 45 5 view .LVU37
+# 45 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_cs $136 /* offsetof(struct cpu_user_regs, cs) */<=="
+# 0 "" 2
+	.loc 1 45 47 view .LVU38
+	.loc 1 46 5 view .LVU39
+# 46 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_eflags $144 /* offsetof(struct cpu_user_regs, rflags) */<=="
+# 0 "" 2
+	.loc 1 46 55 view .LVU40
+	.loc 1 47 5 view .LVU41
+# 47 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_rsp $152 /* offsetof(struct cpu_user_regs, rsp) */<=="
+# 0 "" 2
+	.loc 1 47 49 view .LVU42
+	.loc 1 48 5 view .LVU43
+# 48 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_ss $160 /* offsetof(struct cpu_user_regs, ss) */<=="
+# 0 "" 2
+	.loc 1 48 47 view .LVU44
+	.loc 1 49 5 view .LVU45
+# 49 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define UREGS_kernel_sizeof $168 /* offsetof(struct cpu_user_regs, es) */<=="
+# 0 "" 2
+	.loc 1 49 58 view .LVU46
+	.loc 1 50 5 view .LVU47
+# 50 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 52 5 view .LVU48
+# 52 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_processor $4 /* offsetof(struct vcpu, processor) */<=="
+# 0 "" 2
+	.loc 1 52 51 view .LVU49
+	.loc 1 53 5 view .LVU50
+# 53 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_domain $16 /* offsetof(struct vcpu, domain) */<=="
+# 0 "" 2
+	.loc 1 53 45 view .LVU51
+	.loc 1 54 5 view .LVU52
+# 54 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_vcpu_info $8 /* offsetof(struct vcpu, vcpu_info) */<=="
+# 0 "" 2
+	.loc 1 54 51 view .LVU53
+	.loc 1 55 5 view .LVU54
+# 55 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_trap_bounce $1448 /* offsetof(struct vcpu, arch.pv.trap_bounce) */<=="
+# 0 "" 2
+	.loc 1 55 63 view .LVU55
+	.loc 1 56 5 view .LVU56
+# 56 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_thread_flags $904 /* offsetof(struct vcpu, arch.flags) */<=="
+# 0 "" 2
+	.loc 1 56 55 view .LVU57
+	.loc 1 57 5 view .LVU58
+# 57 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_event_addr $1376 /* offsetof(struct vcpu, arch.pv.event_callback_eip) */<=="
+# 0 "" 2
+	.loc 1 57 69 view .LVU59
+	.loc 1 58 5 view .LVU60
+# 58 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_event_sel $1392 /* offsetof(struct vcpu, arch.pv.event_callback_cs) */<=="
+# 0 "" 2
+	.loc 1 58 67 view .LVU61
+	.loc 1 59 5 view .LVU62
+# 59 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_syscall_addr $1392 /* offsetof(struct vcpu, arch.pv.syscall_callback_eip) */<=="
+# 0 "" 2
+	.loc 1 59 73 view .LVU63
+	.loc 1 60 5 view .LVU64
+# 60 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_syscall32_addr $1400 /* offsetof(struct vcpu, arch.pv.syscall32_callback_eip) */<=="
+# 0 "" 2
+	.loc 1 60 77 view .LVU65
+	.loc 1 61 5 view .LVU66
+# 61 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_syscall32_sel $1416 /* offsetof(struct vcpu, arch.pv.syscall32_callback_cs) */<=="
+# 0 "" 2
+	.loc 1 61 75 view .LVU67
+	.loc 1 62 5 view .LVU68
+# 62 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_syscall32_disables_events $1420 /* offsetof(struct vcpu, arch.pv.syscall32_disables_events) */<=="
+# 0 "" 2
+	.loc 1 63 59 view .LVU69
+	.loc 1 64 5 view .LVU70
+# 64 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_sysenter_addr $1408 /* offsetof(struct vcpu, arch.pv.sysenter_callback_eip) */<=="
+# 0 "" 2
+	.loc 1 64 75 view .LVU71
+	.loc 1 65 5 view .LVU72
+# 65 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_sysenter_sel $1418 /* offsetof(struct vcpu, arch.pv.sysenter_callback_cs) */<=="
+# 0 "" 2
+	.loc 1 65 73 view .LVU73
+	.loc 1 66 5 view .LVU74
+# 66 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_sysenter_disables_events $1421 /* offsetof(struct vcpu, arch.pv.sysenter_disables_events) */<=="
+# 0 "" 2
+	.loc 1 67 58 view .LVU75
+	.loc 1 68 5 view .LVU76
+# 68 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_trap_ctxt $1160 /* offsetof(struct vcpu, arch.pv.trap_ctxt) */<=="
+# 0 "" 2
+	.loc 1 68 59 view .LVU77
+	.loc 1 69 5 view .LVU78
+# 69 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_kernel_sp $1304 /* offsetof(struct vcpu, arch.pv.kernel_sp) */<=="
+# 0 "" 2
+	.loc 1 69 59 view .LVU79
+	.loc 1 70 5 view .LVU80
+# 70 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_kernel_ss $1296 /* offsetof(struct vcpu, arch.pv.kernel_ss) */<=="
+# 0 "" 2
+	.loc 1 70 59 view .LVU81
+	.loc 1 71 5 view .LVU82
+# 71 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_iopl $1476 /* offsetof(struct vcpu, arch.pv.iopl) */<=="
+# 0 "" 2
+	.loc 1 71 49 view .LVU83
+	.loc 1 72 5 view .LVU84
+# 72 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_guest_context_flags $648 /* offsetof(struct vcpu, arch.vgc_flags) */<=="
+# 0 "" 2
+	.loc 1 72 66 view .LVU85
+	.loc 1 73 5 view .LVU86
+# 73 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_cr3 $2960 /* offsetof(struct vcpu, arch.cr3) */<=="
+# 0 "" 2
+	.loc 1 73 44 view .LVU87
+	.loc 1 74 5 view .LVU88
+# 74 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_arch_msrs $3352 /* offsetof(struct vcpu, arch.msrs) */<=="
+# 0 "" 2
+	.loc 1 74 51 view .LVU89
+	.loc 1 75 5 view .LVU90
+# 75 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_nmi_pending $290 /* offsetof(struct vcpu, async_exception_state[(1)-1].pending) */<=="
+# 0 "" 2
+	.loc 1 75 55 view .LVU91
+	.loc 1 76 5 view .LVU92
+# 76 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_mce_pending $292 /* offsetof(struct vcpu, async_exception_state[(2)-1].pending) */<=="
+# 0 "" 2
+	.loc 1 76 55 view .LVU93
+	.loc 1 77 5 view .LVU94
+# 77 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_nmi_old_mask $291 /* offsetof(struct vcpu, async_exception_state[(1)-1].old_mask) */<=="
+# 0 "" 2
+	.loc 1 77 63 view .LVU95
+	.loc 1 78 5 view .LVU96
+# 78 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_mce_old_mask $293 /* offsetof(struct vcpu, async_exception_state[(2)-1].old_mask) */<=="
+# 0 "" 2
+	.loc 1 78 63 view .LVU97
+	.loc 1 79 5 view .LVU98
+# 79 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_async_exception_mask $294 /* offsetof(struct vcpu, async_exception_mask) */<=="
+# 0 "" 2
+	.loc 1 79 73 view .LVU99
+	.loc 1 80 5 view .LVU100
+# 80 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_TRAP_NMI $1 /* VCPU_TRAP_NMI */<=="
+# 0 "" 2
+	.loc 1 81 5 view .LVU101
+# 81 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_TRAP_MCE $2 /* VCPU_TRAP_MCE */<=="
+# 0 "" 2
+	.loc 1 82 5 view .LVU102
+# 82 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define _VGCF_syscall_disables_events $4 /* _VGCF_syscall_disables_events */<=="
+# 0 "" 2
+	.loc 1 83 5 view .LVU103
+# 83 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 85 5 view .LVU104
+# 85 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_svm_vmcb_pa $1480 /* offsetof(struct vcpu, arch.hvm.svm.vmcb_pa) */<=="
+# 0 "" 2
+	.loc 1 85 64 view .LVU105
+	.loc 1 86 5 view .LVU106
+# 86 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_svm_vmcb $1472 /* offsetof(struct vcpu, arch.hvm.svm.vmcb) */<=="
+# 0 "" 2
+	.loc 1 86 58 view .LVU107
+	.loc 1 87 5 view .LVU108
+# 87 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 89 5 view .LVU109
+# 89 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_vmx_launched $1524 /* offsetof(struct vcpu, arch.hvm.vmx.launched) */<=="
+# 0 "" 2
+	.loc 1 89 66 view .LVU110
+	.loc 1 90 5 view .LVU111
+# 90 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_vmx_realmode $1737 /* offsetof(struct vcpu, arch.hvm.vmx.vmx_realmode) */<=="
+# 0 "" 2
+	.loc 1 90 70 view .LVU112
+	.loc 1 91 5 view .LVU113
+# 91 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_vmx_emulate $1738 /* offsetof(struct vcpu, arch.hvm.vmx.vmx_emulate) */<=="
+# 0 "" 2
+	.loc 1 91 68 view .LVU114
+	.loc 1 92 5 view .LVU115
+# 92 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_vm86_seg_mask $1740 /* offsetof(struct vcpu, arch.hvm.vmx.vm86_segment_mask) */<=="
+# 0 "" 2
+	.loc 1 92 76 view .LVU116
+	.loc 1 93 5 view .LVU117
+# 93 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_hvm_guest_cr2 $1040 /* offsetof(struct vcpu, arch.hvm.guest_cr[2]) */<=="
+# 0 "" 2
+	.loc 1 93 66 view .LVU118
+	.loc 1 94 5 view .LVU119
+# 94 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 96 5 view .LVU120
+# 96 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_nhvm_guestmode $1960 /* offsetof(struct vcpu, arch.hvm.nvcpu.nv_guestmode) */<=="
+# 0 "" 2
+	.loc 1 96 74 view .LVU121
+	.loc 1 97 5 view .LVU122
+# 97 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_nhvm_p2m $2192 /* offsetof(struct vcpu, arch.hvm.nvcpu.nv_p2m) */<=="
+# 0 "" 2
+	.loc 1 97 62 view .LVU123
+	.loc 1 98 5 view .LVU124
+# 98 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPU_nsvm_hap_enabled $2148 /* offsetof(struct vcpu, arch.hvm.nvcpu.u.nsvm.ns_hap_enabled) */<=="
+# 0 "" 2
+	.loc 1 98 85 view .LVU125
+	.loc 1 99 5 view .LVU126
+# 99 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 101 5 view .LVU127
+# 101 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define DOMAIN_is_32bit_pv $2312 /* offsetof(struct domain, arch.is_32bit_pv) */<=="
+# 0 "" 2
+	.loc 1 101 64 view .LVU128
+	.loc 1 102 5 view .LVU129
+# 102 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 104 5 view .LVU130
+# 104 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPUINFO_upcall_pending $0 /* offsetof(struct vcpu_info, evtchn_upcall_pending) */<=="
+# 0 "" 2
+	.loc 1 104 77 view .LVU131
+	.loc 1 105 5 view .LVU132
+# 105 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPUINFO_upcall_mask $1 /* offsetof(struct vcpu_info, evtchn_upcall_mask) */<=="
+# 0 "" 2
+	.loc 1 105 71 view .LVU133
+	.loc 1 106 5 view .LVU134
+# 106 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 108 5 view .LVU135
+# 108 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define COMPAT_VCPUINFO_upcall_pending $0 /* offsetof(struct compat_vcpu_info, evtchn_upcall_pending) */<=="
+# 0 "" 2
+	.loc 1 108 91 view .LVU136
+	.loc 1 109 5 view .LVU137
+# 109 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define COMPAT_VCPUINFO_upcall_mask $1 /* offsetof(struct compat_vcpu_info, evtchn_upcall_mask) */<=="
+# 0 "" 2
+	.loc 1 109 85 view .LVU138
+	.loc 1 110 5 view .LVU139
+# 110 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 112 5 view .LVU140
+# 112 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_guest_cpu_user_regs $0 /* offsetof(struct cpu_info, guest_cpu_user_regs) */<=="
+# 0 "" 2
+	.loc 1 112 78 view .LVU141
+	.loc 1 113 5 view .LVU142
+# 113 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_verw_sel $204 /* offsetof(struct cpu_info, verw_sel) */<=="
+# 0 "" 2
+	.loc 1 113 56 view .LVU143
+	.loc 1 114 5 view .LVU144
+# 114 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_current_vcpu $208 /* offsetof(struct cpu_info, current_vcpu) */<=="
+# 0 "" 2
+	.loc 1 114 64 view .LVU145
+	.loc 1 115 5 view .LVU146
+# 115 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_cr4 $224 /* offsetof(struct cpu_info, cr4) */<=="
+# 0 "" 2
+	.loc 1 115 46 view .LVU147
+	.loc 1 116 5 view .LVU148
+# 116 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_xen_cr3 $232 /* offsetof(struct cpu_info, xen_cr3) */<=="
+# 0 "" 2
+	.loc 1 116 54 view .LVU149
+	.loc 1 117 5 view .LVU150
+# 117 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_pv_cr3 $240 /* offsetof(struct cpu_info, pv_cr3) */<=="
+# 0 "" 2
+	.loc 1 117 52 view .LVU151
+	.loc 1 118 5 view .LVU152
+# 118 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_shadow_spec_ctrl $248 /* offsetof(struct cpu_info, shadow_spec_ctrl) */<=="
+# 0 "" 2
+	.loc 1 118 72 view .LVU153
+	.loc 1 119 5 view .LVU154
+# 119 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_xen_spec_ctrl $252 /* offsetof(struct cpu_info, xen_spec_ctrl) */<=="
+# 0 "" 2
+	.loc 1 119 66 view .LVU155
+	.loc 1 120 5 view .LVU156
+# 120 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_spec_ctrl_flags $253 /* offsetof(struct cpu_info, spec_ctrl_flags) */<=="
+# 0 "" 2
+	.loc 1 120 70 view .LVU157
+	.loc 1 121 5 view .LVU158
+# 121 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_root_pgt_changed $254 /* offsetof(struct cpu_info, root_pgt_changed) */<=="
+# 0 "" 2
+	.loc 1 121 72 view .LVU159
+	.loc 1 122 5 view .LVU160
+# 122 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_use_pv_cr3 $255 /* offsetof(struct cpu_info, use_pv_cr3) */<=="
+# 0 "" 2
+	.loc 1 122 60 view .LVU161
+	.loc 1 123 5 view .LVU162
+# 123 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_sizeof $264 /* sizeof(struct cpu_info) */<=="
+# 0 "" 2
+	.loc 1 124 5 view .LVU163
+# 124 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 126 5 view .LVU164
+# 126 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPINFO_eip $8 /* offsetof(struct trap_info, address) */<=="
+# 0 "" 2
+	.loc 1 126 52 view .LVU165
+	.loc 1 127 5 view .LVU166
+# 127 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPINFO_cs $2 /* offsetof(struct trap_info, cs) */<=="
+# 0 "" 2
+	.loc 1 127 46 view .LVU167
+	.loc 1 128 5 view .LVU168
+# 128 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPINFO_flags $1 /* offsetof(struct trap_info, flags) */<=="
+# 0 "" 2
+	.loc 1 128 52 view .LVU169
+	.loc 1 129 5 view .LVU170
+# 129 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPINFO_sizeof $16 /* sizeof(struct trap_info) */<=="
+# 0 "" 2
+	.loc 1 130 5 view .LVU171
+# 130 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 132 5 view .LVU172
+# 132 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPBOUNCE_error_code $0 /* offsetof(struct trap_bounce, error_code) */<=="
+# 0 "" 2
+	.loc 1 132 66 view .LVU173
+	.loc 1 133 5 view .LVU174
+# 133 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPBOUNCE_flags $4 /* offsetof(struct trap_bounce, flags) */<=="
+# 0 "" 2
+	.loc 1 133 56 view .LVU175
+	.loc 1 134 5 view .LVU176
+# 134 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPBOUNCE_cs $6 /* offsetof(struct trap_bounce, cs) */<=="
+# 0 "" 2
+	.loc 1 134 50 view .LVU177
+	.loc 1 135 5 view .LVU178
+# 135 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define TRAPBOUNCE_eip $8 /* offsetof(struct trap_bounce, eip) */<=="
+# 0 "" 2
+	.loc 1 135 52 view .LVU179
+	.loc 1 136 5 view .LVU180
+# 136 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 138 5 view .LVU181
+# 138 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define VCPUMSR_spec_ctrl_raw $0 /* offsetof(struct vcpu_msrs, spec_ctrl.raw) */<=="
+# 0 "" 2
+	.loc 1 138 67 view .LVU182
+	.loc 1 139 5 view .LVU183
+# 139 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 146 5 view .LVU184
+# 146 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define IRQSTAT_shift $7 /* ilog2(sizeof(irq_cpustat_t)) */<=="
+# 0 "" 2
+	.loc 1 147 5 view .LVU185
+# 147 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define IRQSTAT_softirq_pending $0 /* offsetof(irq_cpustat_t, __softirq_pending) */<=="
+# 0 "" 2
+	.loc 1 147 70 view .LVU186
+	.loc 1 148 5 view .LVU187
+# 148 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 150 5 view .LVU188
+# 150 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define CPUINFO_features $12 /* offsetof(struct cpuinfo_x86, x86_capability) */<=="
+# 0 "" 2
+	.loc 1 150 65 view .LVU189
+	.loc 1 151 5 view .LVU190
+# 151 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 153 5 view .LVU191
+# 153 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB_flags $0 /* offsetof(multiboot_info_t, flags) */<=="
+# 0 "" 2
+	.loc 1 153 46 view .LVU192
+	.loc 1 154 5 view .LVU193
+# 154 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB_cmdline $16 /* offsetof(multiboot_info_t, cmdline) */<=="
+# 0 "" 2
+	.loc 1 154 50 view .LVU194
+	.loc 1 155 5 view .LVU195
+# 155 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB_mem_lower $4 /* offsetof(multiboot_info_t, mem_lower) */<=="
+# 0 "" 2
+	.loc 1 155 54 view .LVU196
+	.loc 1 156 5 view .LVU197
+# 156 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 158 5 view .LVU198
+# 158 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_fixed_sizeof $8 /* sizeof(multiboot2_fixed_t) */<=="
+# 0 "" 2
+	.loc 1 159 5 view .LVU199
+# 159 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_fixed_total_size $0 /* offsetof(multiboot2_fixed_t, total_size) */<=="
+# 0 "" 2
+	.loc 1 159 65 view .LVU200
+	.loc 1 160 5 view .LVU201
+# 160 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_tag_type $0 /* offsetof(multiboot2_tag_t, type) */<=="
+# 0 "" 2
+	.loc 1 160 49 view .LVU202
+	.loc 1 161 5 view .LVU203
+# 161 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_tag_size $4 /* offsetof(multiboot2_tag_t, size) */<=="
+# 0 "" 2
+	.loc 1 161 49 view .LVU204
+	.loc 1 162 5 view .LVU205
+# 162 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_load_base_addr $8 /* offsetof(multiboot2_tag_load_base_addr_t, load_base_addr) */<=="
+# 0 "" 2
+	.loc 1 162 80 view .LVU206
+	.loc 1 163 5 view .LVU207
+# 163 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_mem_lower $8 /* offsetof(multiboot2_tag_basic_meminfo_t, mem_lower) */<=="
+# 0 "" 2
+	.loc 1 163 69 view .LVU208
+	.loc 1 164 5 view .LVU209
+# 164 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_efi64_st $8 /* offsetof(multiboot2_tag_efi64_t, pointer) */<=="
+# 0 "" 2
+	.loc 1 164 58 view .LVU210
+	.loc 1 165 5 view .LVU211
+# 165 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define MB2_efi64_ih $8 /* offsetof(multiboot2_tag_efi64_ih_t, pointer) */<=="
+# 0 "" 2
+	.loc 1 165 61 view .LVU212
+	.loc 1 166 5 view .LVU213
+# 166 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 168 5 view .LVU214
+# 168 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define l2_identmap_sizeof $16384 /* sizeof(l2_identmap) */<=="
+# 0 "" 2
+	.loc 1 169 5 view .LVU215
+# 169 "x86_64/asm-offsets.c" 1
+	
+.ascii"==><=="
+# 0 "" 2
+	.loc 1 171 5 view .LVU216
+# 171 "x86_64/asm-offsets.c" 1
+	
+.ascii"==>#define DOMAIN_vm_assist $520 /* offsetof(struct domain, vm_assist) */<=="
+# 0 "" 2
+	.loc 1 171 55 view .LVU217
+	.loc 1 172 1 is_stmt 0 view .LVU218
+#NO_APP
+	ret
+	.cfi_endproc
+.LFE605:
+	.size	__dummy__, .-__dummy__
+.Letext0:
+	.file 2 "/root/repo/xen/include/asm/asm_defns.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xa7
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2
+	.long	.LASF13
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF3
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF10
+	.uleb128 0x4
+	.long	.LASF14
+	.byte	0x2
+	.byte	0x22
+	.byte	0x18
+	.long	0x2e
+	.uleb128 0x1
+	.byte	0x57
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF12
+	.uleb128 0x5
+	.long	.LASF15
+	.byte	0x1
+	.byte	0x19
+	.byte	0x6
+	.quad	.LFB605
+	.quad	.LFE605-.LFB605
+	.uleb128 0x1
+	.byte	0x9c
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF15:
+	.string	"__dummy__"
+.LASF4:
+	.string	"unsigned int"
+.LASF2:
+	.string	"long unsigned int"
+.LASF9:
+	.string	"long int"
+.LASF5:
+	.string	"unsigned char"
+.LASF7:
+	.string	"signed char"
+.LASF13:
+	.ascii	"GNU C99 12.2.0 -m64 -msoft-float -mno-red-zone -mno-sse -msk"
+	.ascii	"ip-rax-setup -mindirect-branch=thunk-extern -mindire"
+	.string	"ct-branch-register -mpreferred-stack-boundary=3 -mtune=generic -march=x86-64 -g -O1 -std=gnu99 -fno-strict-aliasing -fno-omit-frame-pointer -fno-builtin -fno-common -fno-stack-protector -fno-exceptions -fpic -fno-asynchronous-unwind-tables -fno-jump-tables"
+.LASF6:
+	.string	"short unsigned int"
+.LASF8:
+	.string	"short int"
+.LASF11:
+	.string	"long long unsigned int"
+.LASF10:
+	.string	"_Bool"
+.LASF14:
+	.string	"current_stack_pointer"
+.LASF3:
+	.string	"char"
+.LASF12:
+	.string	"long long int"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"x86_64/asm-offsets.c"
+.LASF1:
+	.string	"/root/repo/xen/arch/x86"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
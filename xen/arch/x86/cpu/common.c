@@ -419,6 +419,45 @@ static void generic_identify(struct cpuinfo_x86 *c)
 			    &tmp, &tmp, &tmp);
 }
 
+/*
+ * Derive an identifier of the last level cache from the deterministic cache
+ * parameters (leaf 4 on Intel, leaf 0x8000001d on AMD and Hygon): logical
+ * processors sharing a cache have the same APIC ID once the bits enumerating
+ * them are shifted out.  Without that information, assume the LLC spans the
+ * whole package.
+ */
+static void detect_llc(struct cpuinfo_x86 *c)
+{
+	unsigned int eax, ebx, ecx, edx, leaf, i;
+	unsigned int level = 0, sharing = 0;
+
+	c->llc_id = c->phys_proc_id;
+
+	if (c->x86_vendor & (X86_VENDOR_AMD | X86_VENDOR_HYGON)) {
+		if (!cpu_has(c, X86_FEATURE_TOPOEXT) ||
+		    c->extended_cpuid_level < 0x8000001d)
+			return;
+		leaf = 0x8000001d;
+	} else if (c->cpuid_level >= 4)
+		leaf = 4;
+	else
+		return;
+
+	for (i = 0; i < 16; i++) {
+		cpuid_count(leaf, i, &eax, &ebx, &ecx, &edx);
+		/* Cache type 0 terminates the list. */
+		if (!(eax & 0x1f))
+			break;
+		if (((eax >> 5) & 7) > level) {
+			level = (eax >> 5) & 7;
+			sharing = ((eax >> 14) & 0xfff) + 1;
+		}
+	}
+
+	if (sharing)
+		c->llc_id = c->apicid >> get_count_order(sharing);
+}
+
 /*
  * This does the hard work of actually picking apart the CPU stuff...
  */
@@ -438,6 +477,7 @@ void identify_cpu(struct cpuinfo_x86 *c)
 	c->phys_proc_id = XEN_INVALID_SOCKET_ID;
 	c->cpu_core_id = XEN_INVALID_CORE_ID;
 	c->compute_unit_id = INVALID_CUID;
+	c->llc_id = XEN_INVALID_SOCKET_ID;
 	memset(&c->x86_capability, 0, sizeof c->x86_capability);
 
 	generic_identify(c);
@@ -462,6 +502,7 @@ void identify_cpu(struct cpuinfo_x86 *c)
 	if (this_cpu->c_init)
 		this_cpu->c_init(c);
 
+	detect_llc(c);
 
    	if (c == &boot_cpu_data && !opt_pku)
 		setup_clear_cpu_cap(X86_FEATURE_PKU);
@@ -0,0 +1,474 @@
+/******************************************************************************
+ * pmuprof.c
+ *
+ * Sampling profiler of the hypervisor and its guests.
+ *
+ * While running, general purpose counter 0 of every pCPU counts cycles or
+ * instructions, and raises an NMI through the local APIC every period
+ * events.  The NMI handler records the interrupted IP, who was running and
+ * in which mode, and when that was Xen, its call chain, into a ring per pCPU
+ * which dom0 maps read-only (see public/pmuprof.h).  The rings are never
+ * freed, as they may be mapped, and are reused by later runs.
+ *
+ * Unlike xenoprof, this doesn't need any cooperation from the profiled
+ * domains, nor a profiling daemon in dom0: xenpmuprof reads the rings, and
+ * symbolises Xen addresses from the hypervisor's own symbol table.
+ */
+
+#include <xen/cpu.h>
+#include <xen/init.h>
+#include <xen/kernel.h>
+#include <xen/lib.h>
+#include <xen/mm.h>
+#include <xen/sched.h>
+#include <xen/smp.h>
+#include <xen/spinlock.h>
+#include <xen/time.h>
+#include <asm/apic.h>
+#include <asm/current.h>
+#include <asm/hvm/hvm.h>
+#include <asm/msr.h>
+#include <asm/nmi.h>
+#include <asm/pmuprof.h>
+#include <asm/processor.h>
+#include <asm/vpmu.h>
+#include <public/pmuprof.h>
+#include <public/sysctl.h>
+
+/* Record frames per pCPU ring, rounded up to a power of two. */
+static unsigned int __initdata opt_pmuprof_frames = 32;
+integer_param("pmuprof-frames", opt_pmuprof_frames);
+static unsigned int __read_mostly ring_order;
+
+#define EVNTSEL_USR      (1u << 16)
+#define EVNTSEL_OS       (1u << 17)
+#define EVNTSEL_INT      (1u << 20)
+#define EVNTSEL_ENABLE   (1u << 22)
+
+/* Event select values, by XEN_PMUPROF_EVENT_* */
+static const uint8_t intel_events[][2] = {
+    { 0x3c, 0x00 },     /* UnHalted Core Cycles */
+    { 0xc0, 0x00 },     /* Instruction Retired */
+};
+static const uint8_t amd_events[][2] = {
+    { 0x76, 0x00 },     /* CPU Clocks not Halted */
+    { 0xc0, 0x00 },     /* Retired Instructions */
+};
+
+/* Writes to the Intel counters only take 32 bits, sign extended. */
+#define MAX_PERIOD       ((1ul << 31) - 1)
+
+static DEFINE_SPINLOCK(pmuprof_lock);
+static bool running;
+static unsigned int evntsel_msr, perfctr_msr, counter_width;
+static unsigned int arch_perfmon_version;
+static uint32_t evntsel;
+/* Of the last run */
+static unsigned int event;
+static uint64_t period;
+
+/*
+ * Rings, by pCPU.  The header page may be writable by a translated hardware
+ * domain, so what the NMI handler indexes the records with is kept here and
+ * only ever written out to it.
+ */
+static struct pmuprof_ring {
+    struct xen_pmuprof_header *header;
+    struct xen_pmuprof_record *records;
+    uint64_t head;
+    unsigned int mask;
+} rings[NR_CPUS];
+
+/* State of the counter, only used on its own pCPU */
+struct pmuprof_cpu {
+    bool active;
+    uint32_t saved_lvtpc;
+    uint64_t saved_global_ctrl;
+};
+static DEFINE_PER_CPU(struct pmuprof_cpu, pmuprof_cpu);
+
+static unsigned int sample_mode(struct vcpu *curr,
+                                const struct cpu_user_regs *regs)
+{
+    if ( !guest_mode(regs) )
+        return XEN_PMUPROF_MODE_xen;
+
+    if ( !is_hvm_vcpu(curr) )
+        return guest_kernel_mode(curr, regs) ? XEN_PMUPROF_MODE_guest_kernel
+                                             : XEN_PMUPROF_MODE_guest_user;
+
+    switch ( hvm_guest_x86_mode(curr) )
+    {
+    case 0: /* real mode */
+        return XEN_PMUPROF_MODE_guest_kernel;
+    case 1: /* vm86 mode */
+        return XEN_PMUPROF_MODE_guest_user;
+    default:
+        return hvm_get_cpl(curr) != 3 ? XEN_PMUPROF_MODE_guest_kernel
+                                      : XEN_PMUPROF_MODE_guest_user;
+    }
+}
+
+/*
+ * Follow the frame pointers of the interrupted Xen context, staying within
+ * its stack, like _show_trace() does.
+ */
+static unsigned int sample_callers(const struct cpu_user_regs *regs,
+                                   uint64_t *callers)
+{
+    unsigned int n = 0;
+#ifdef CONFIG_FRAME_POINTER
+    unsigned long low = regs->rsp, high = get_stack_trace_bottom(regs->rsp);
+    unsigned long next = regs->rbp;
+    const unsigned long *frame;
+
+    while ( n < XEN_PMUPROF_MAX_CALLERS &&
+            next >= low && next < high - sizeof(*frame) &&
+            IS_ALIGNED(next, sizeof(*frame)) )
+    {
+        frame = (const unsigned long *)next;
+        if ( !is_active_kernel_text(frame[1]) )
+            break;
+
+        callers[n++] = frame[1];
+        next = frame[0];
+        low = (unsigned long)&frame[2];
+    }
+#endif
+
+    return n;
+}
+
+static int pmuprof_nmi(const struct cpu_user_regs *regs, int cpu)
+{
+    struct pmuprof_cpu *pc = &per_cpu(pmuprof_cpu, cpu);
+    struct pmuprof_ring *ring = &rings[cpu];
+    struct xen_pmuprof_record *rec;
+    struct vcpu *curr = current;
+    uint64_t val, head;
+
+    if ( !pc->active )
+        return 0;
+
+    /* Started at -period, the counter has wrapped once its top bit clears. */
+    rdmsrl(perfctr_msr, val);
+    if ( val & (1ull << (counter_width - 1)) )
+        return 0;
+
+    head = ring->head;
+    rec = &ring->records[head & ring->mask];
+
+    rec->time = NOW();
+    rec->ip = regs->rip;
+    rec->domid = curr->domain->domain_id;
+    rec->vcpu = curr->vcpu_id;
+    rec->mode = sample_mode(curr, regs);
+    rec->nr_callers = rec->mode == XEN_PMUPROF_MODE_xen
+                      ? sample_callers(regs, rec->callers) : 0;
+
+    ring->head = head + 1;
+    smp_wmb();
+    write_atomic(&ring->header->head, head + 1);
+
+    wrmsrl(perfctr_msr, -period);
+    if ( arch_perfmon_version >= 2 )
+        wrmsrl(MSR_CORE_PERF_GLOBAL_OVF_CTRL, 1);
+
+    /* Intel masks LVTPC on delivery. */
+    apic_write(APIC_LVTPC, APIC_DM_NMI);
+
+    return 1;
+}
+
+static void pmuprof_cpu_start(void *unused)
+{
+    unsigned int cpu = smp_processor_id();
+    struct pmuprof_cpu *pc = &per_cpu(pmuprof_cpu, cpu);
+
+    /* Came online after the rings were allocated. */
+    if ( !rings[cpu].header )
+        return;
+
+    rings[cpu].header->event = event;
+    rings[cpu].header->period = period;
+
+    wrmsrl(evntsel_msr, 0);
+    wrmsrl(perfctr_msr, -period);
+
+    pc->saved_lvtpc = apic_read(APIC_LVTPC);
+    apic_write(APIC_LVTPC, APIC_DM_NMI);
+
+    if ( arch_perfmon_version >= 2 )
+    {
+        rdmsrl(MSR_CORE_PERF_GLOBAL_CTRL, pc->saved_global_ctrl);
+        wrmsrl(MSR_CORE_PERF_GLOBAL_CTRL, pc->saved_global_ctrl | 1);
+    }
+
+    pc->active = true;
+    wrmsrl(evntsel_msr, evntsel | EVNTSEL_ENABLE);
+}
+
+static void pmuprof_cpu_stop(void *unused)
+{
+    struct pmuprof_cpu *pc = &this_cpu(pmuprof_cpu);
+    uint32_t v;
+
+    if ( !pc->active )
+        return;
+
+    wrmsrl(evntsel_msr, 0);
+    pc->active = false;
+
+    if ( arch_perfmon_version >= 2 )
+        wrmsrl(MSR_CORE_PERF_GLOBAL_CTRL, pc->saved_global_ctrl);
+
+    /*
+     * The LVTPC left by firmware may have a vector illegal for its delivery
+     * mode: don't let restoring it raise an APIC error, see nmi_cpu_stop().
+     */
+    v = apic_read(APIC_LVTERR);
+    apic_write(APIC_LVTERR, v | APIC_LVT_MASKED);
+    apic_write(APIC_LVTPC, pc->saved_lvtpc);
+    apic_write(APIC_LVTERR, v);
+}
+
+/* Pick the counter and event, and check the CPU can count it. */
+static int pmuprof_setup(unsigned int new_event)
+{
+    const uint8_t (*events)[2];
+
+    if ( new_event > XEN_PMUPROF_EVENT_instructions )
+        return -EINVAL;
+
+    switch ( boot_cpu_data.x86_vendor )
+    {
+    case X86_VENDOR_INTEL:
+    {
+        uint32_t eax, ebx, ecx, edx;
+
+        if ( !cpu_has_arch_perfmon )
+            return -EOPNOTSUPP;
+
+        cpuid(0xa, &eax, &ebx, &ecx, &edx);
+        arch_perfmon_version = eax & 0xff;
+        counter_width = (eax >> 16) & 0xff;
+        /* No counter, or the event isn't available. */
+        if ( !((eax >> 8) & 0xff) || counter_width < 32 ||
+             counter_width > 64 || (ebx & (1u << new_event)) )
+            return -EOPNOTSUPP;
+
+        evntsel_msr = MSR_P6_EVNTSEL(0);
+        perfctr_msr = MSR_P6_PERFCTR(0);
+        events = intel_events;
+        break;
+    }
+
+    case X86_VENDOR_AMD:
+    case X86_VENDOR_HYGON:
+        arch_perfmon_version = 0;
+        counter_width = 48;
+        evntsel_msr = MSR_K7_EVNTSEL0;
+        perfctr_msr = MSR_K7_PERFCTR0;
+        events = amd_events;
+        break;
+
+    default:
+        return -EOPNOTSUPP;
+    }
+
+    evntsel = events[new_event][0] | (events[new_event][1] << 8) |
+              EVNTSEL_USR | EVNTSEL_OS | EVNTSEL_INT;
+
+    return 0;
+}
+
+static int pmuprof_alloc_ring(unsigned int cpu)
+{
+    struct pmuprof_ring *ring = &rings[cpu];
+    struct xen_pmuprof_header *header;
+    struct xen_pmuprof_record *records;
+    unsigned int i, nr_frames = 1u << ring_order;
+
+    header = alloc_xenheap_pages(0, MEMF_node(cpu_to_node(cpu)));
+    records = alloc_xenheap_pages(ring_order, MEMF_node(cpu_to_node(cpu)));
+    if ( !header || !records )
+    {
+        free_xenheap_pages(header, 0);
+        free_xenheap_pages(records, ring_order);
+        return -ENOMEM;
+    }
+
+    clear_page(header);
+    header->version = XEN_PMUPROF_VERSION;
+    header->cpu = cpu;
+    header->nr_frames = nr_frames;
+    header->nr_records = nr_frames * XEN_PMUPROF_RECORDS_PER_FRAME;
+    share_xen_page_with_privileged_guests(virt_to_page(header), SHARE_ro);
+
+    for ( i = 0; i < nr_frames; i++ )
+    {
+        void *p = (void *)records + i * PAGE_SIZE;
+
+        clear_page(p);
+        share_xen_page_with_privileged_guests(virt_to_page(p), SHARE_ro);
+    }
+
+    ring->records = records;
+    ring->head = 0;
+    ring->mask = header->nr_records - 1;
+    smp_wmb();
+    ring->header = header;
+
+    return 0;
+}
+
+static int pmuprof_start(unsigned int new_event, uint64_t new_period)
+{
+    unsigned int cpu;
+    int rc;
+
+    if ( running )
+        return -EBUSY;
+
+    if ( new_period > MAX_PERIOD )
+        return -EINVAL;
+
+    rc = pmuprof_setup(new_event);
+    if ( rc )
+        return rc;
+
+    for_each_online_cpu ( cpu )
+        if ( !rings[cpu].header && (rc = pmuprof_alloc_ring(cpu)) != 0 )
+            return rc;
+
+    rc = vpmu_reserve();
+    if ( rc )
+        return rc;
+
+    /* Held by xenoprof, otherwise the NMI watchdog gets paused. */
+    if ( reserve_lapic_nmi() )
+    {
+        vpmu_release();
+        return -EBUSY;
+    }
+
+    event = new_event;
+    period = new_period ?: max(cpu_khz, 1ul);
+
+    set_nmi_callback(pmuprof_nmi);
+    on_each_cpu(pmuprof_cpu_start, NULL, 1);
+    running = true;
+
+    return 0;
+}
+
+static void pmuprof_stop(void)
+{
+    if ( !running )
+        return;
+
+    on_each_cpu(pmuprof_cpu_stop, NULL, 1);
+    unset_nmi_callback();
+    release_lapic_nmi();
+    vpmu_release();
+    running = false;
+}
+
+int pmuprof_op(struct xen_sysctl_pmuprof_op *op)
+{
+    int rc = 0;
+
+    BUILD_BUG_ON(sizeof(struct xen_pmuprof_record) *
+                 XEN_PMUPROF_RECORDS_PER_FRAME != PAGE_SIZE);
+    BUILD_BUG_ON(sizeof(struct xen_pmuprof_header) > PAGE_SIZE);
+
+    spin_lock(&pmuprof_lock);
+
+    switch ( op->cmd )
+    {
+    case XEN_SYSCTL_PMUPROF_start:
+        rc = pmuprof_start(op->event, op->period);
+        break;
+
+    case XEN_SYSCTL_PMUPROF_stop:
+        pmuprof_stop();
+        break;
+
+    case XEN_SYSCTL_PMUPROF_status:
+        op->running = running;
+        op->event = event;
+        op->period = period;
+        op->nr_frames = period ? 1 + (1u << ring_order) : 0;
+        break;
+
+    default:
+        rc = -EOPNOTSUPP;
+        break;
+    }
+
+    spin_unlock(&pmuprof_lock);
+
+    return rc;
+}
+
+int pmuprof_acquire(unsigned int cpu, unsigned long frame,
+                    unsigned int nr_frames, xen_pfn_t mfn_list[])
+{
+    const struct pmuprof_ring *ring;
+    unsigned int i, total;
+    int rc = 0;
+
+    if ( cpu >= nr_cpu_ids )
+        return -EINVAL;
+
+    spin_lock(&pmuprof_lock);
+
+    ring = &rings[cpu];
+    total = 1 + (1u << ring_order);
+
+    if ( !ring->header )
+        rc = -ENOENT;
+    else if ( frame > total || nr_frames > total - frame )
+        rc = -EINVAL;
+
+    for ( i = 0; !rc && i < nr_frames; i++ )
+        mfn_list[i] = frame + i ? __virt_to_mfn(ring->records) + frame + i - 1
+                                : __virt_to_mfn(ring->header);
+
+    spin_unlock(&pmuprof_lock);
+
+    return rc;
+}
+
+/* Don't leave the NMI handler sampling into a CPU that is going away. */
+static int cpu_callback(
+    struct notifier_block *nfb, unsigned long action, void *hcpu)
+{
+    if ( action == CPU_DYING )
+        pmuprof_cpu_stop(NULL);
+
+    return NOTIFY_DONE;
+}
+
+static struct notifier_block cpu_nfb = {
+    .notifier_call = cpu_callback
+};
+
+static int __init pmuprof_init(void)
+{
+    ring_order = get_order_from_pages(max(opt_pmuprof_frames, 1u));
+    register_cpu_notifier(&cpu_nfb);
+
+    return 0;
+}
+__initcall(pmuprof_init);
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
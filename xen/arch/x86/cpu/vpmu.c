@@ -49,6 +49,8 @@ bool __read_mostly opt_rtm_abort;
 
 static DEFINE_SPINLOCK(vpmu_lock);
 static unsigned vpmu_count;
+/* The PMU is in use by Xen itself: vpmu_mode has to stay off. */
+static bool vpmu_reserved;
 
 static DEFINE_PER_CPU(struct vcpu *, last_vcpu);
 
@@ -527,6 +529,30 @@ static void put_vpmu(struct vcpu *v)
     spin_unlock(&vpmu_lock);
 }
 
+/* Keep guests off the PMU, for the hypervisor profiler to use it. */
+int vpmu_reserve(void)
+{
+    int rc = 0;
+
+    spin_lock(&vpmu_lock);
+
+    if ( vpmu_mode != XENPMU_MODE_OFF || vpmu_reserved )
+        rc = -EBUSY;
+    else
+        vpmu_reserved = true;
+
+    spin_unlock(&vpmu_lock);
+
+    return rc;
+}
+
+void vpmu_release(void)
+{
+    spin_lock(&vpmu_lock);
+    vpmu_reserved = false;
+    spin_unlock(&vpmu_lock);
+}
+
 void vpmu_initialise(struct vcpu *v)
 {
     get_vpmu(v);
@@ -725,13 +751,16 @@ long do_xenpmu_op(unsigned int op, XEN_GUEST_HANDLE_PARAM(xen_pmu_params_t) arg)
 
         spin_lock(&vpmu_lock);
 
+        /* The hypervisor profiler is using the PMU. */
+        if ( vpmu_reserved && pmu_params.val != XENPMU_MODE_OFF )
+            ret = -EBUSY;
         /*
          * We can always safely switch between XENPMU_MODE_SELF and
          * XENPMU_MODE_HV while other VPMUs are active.
          */
-        if ( (vpmu_count == 0) ||
-             ((vpmu_mode ^ pmu_params.val) ==
-              (XENPMU_MODE_SELF | XENPMU_MODE_HV)) )
+        else if ( (vpmu_count == 0) ||
+                  ((vpmu_mode ^ pmu_params.val) ==
+                   (XENPMU_MODE_SELF | XENPMU_MODE_HV)) )
             vpmu_mode = pmu_params.val;
         else if ( vpmu_mode != pmu_params.val )
         {
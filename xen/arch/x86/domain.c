@@ -19,6 +19,7 @@
 #include <xen/smp.h>
 #include <xen/delay.h>
 #include <xen/softirq.h>
+#include <xen/tasklet.h>
 #include <xen/grant_table.h>
 #include <xen/iocap.h>
 #include <xen/kernel.h>
@@ -36,6 +37,7 @@
 #include <xen/wait.h>
 #include <xen/guest_access.h>
 #include <xen/livepatch.h>
+#include <xen/vmap.h>
 #include <public/sysctl.h>
 #include <public/hvm/hvm_vcpu.h>
 #include <asm/altp2m.h>
@@ -403,6 +405,14 @@ int arch_vcpu_create(struct vcpu *v)
         vmce_init_vcpu(v);
 
         arch_vcpu_regs_init(v);
+
+        /* Several pages in size, so don't require contiguous memory. */
+        v->arch.hcall_stats = vzalloc(sizeof(*v->arch.hcall_stats));
+        if ( !v->arch.hcall_stats )
+        {
+            rc = -ENOMEM;
+            goto fail;
+        }
     }
     else if ( (rc = xstate_alloc_save_area(v)) != 0 )
         return rc;
@@ -440,6 +450,8 @@ int arch_vcpu_create(struct vcpu *v)
     vcpu_destroy_fpu(v);
     xfree(v->arch.msrs);
     v->arch.msrs = NULL;
+    vfree(v->arch.hcall_stats);
+    v->arch.hcall_stats = NULL;
 
     return rc;
 }
@@ -454,6 +466,9 @@ void arch_vcpu_destroy(struct vcpu *v)
     xfree(v->arch.msrs);
     v->arch.msrs = NULL;
 
+    vfree(v->arch.hcall_stats);
+    v->arch.hcall_stats = NULL;
+
     if ( !is_idle_domain(v->domain) )
         vpmu_destroy(v);
 
@@ -1835,8 +1850,13 @@ void context_switch(struct vcpu *prev, struct vcpu *next)
     vpmu_switch_from(prev);
     np2m_schedule(NP2M_SCHEDLE_OUT);
 
-    if ( is_hvm_domain(prevd) && !list_empty(&prev->arch.hvm.tm_list) )
-        pt_save_timer(prev);
+    if ( is_hvm_domain(prevd) )
+    {
+        /* Time descheduled isn't spent handling the last VM exit. */
+        hvm_exit_stats_stop(prev);
+        if ( !list_empty(&prev->arch.hvm.tm_list) )
+            pt_save_timer(prev);
+    }
 
     local_irq_disable();
 
@@ -2084,6 +2104,143 @@ static int relinquish_memory(
     return ret;
 }
 
+/*
+ * Relinquishing the memory of a large HVM domain is dominated by the cache
+ * misses on its page_info structures, and freed pages only get scrubbed once
+ * they are back in the heap.  Chunks of the page list are therefore handed
+ * out to tasklets on idle pCPUs, which work alongside the destroying vCPU.
+ * PV domains aren't covered: their page table pages need de-validating in
+ * order.
+ */
+static bool __read_mostly opt_parallel_relinquish = true;
+boolean_param("parallel-relinquish", opt_parallel_relinquish);
+
+/* Pages taken off the page list at a time. */
+#define RELMEM_CHUNK        128
+/* Domains smaller than this (1GiB) aren't worth the helpers. */
+#define RELMEM_MIN_PAGES    (1U << 18)
+#define RELMEM_MAX_WORKERS  16
+
+struct relmem_worker {
+    struct tasklet tasklet;
+    struct domain *domain;
+};
+
+/*
+ * Drop the allocation reference of up to RELMEM_CHUNK pages off the head of
+ * d->page_list.  The pages are moved to d->arch.relmem_list before the lock
+ * is dropped, as arch_free_heap_page() expects to find them on either list.
+ * Returns false once d->page_list has been found empty.
+ */
+static bool relinquish_chunk(struct domain *d)
+{
+    struct page_info *pages[RELMEM_CHUNK], *page = NULL;
+    unsigned int i, n = 0;
+
+    spin_lock_recursive(&d->page_alloc_lock);
+
+    while ( n < RELMEM_CHUNK &&
+            (page = page_list_remove_head(&d->page_list)) )
+    {
+        page_list_add_tail(page, &d->arch.relmem_list);
+
+        /* If this fails, someone else is freeing the page. */
+        if ( likely(get_page(page, d)) )
+            pages[n++] = page;
+    }
+
+    spin_unlock_recursive(&d->page_alloc_lock);
+
+    for ( i = 0; i < n; i++ )
+    {
+        /* HVM domains can't pin page tables. */
+        ASSERT(!(pages[i]->u.inuse.type_info & PGT_pinned));
+        put_page_alloc_ref(pages[i]);
+        put_page(pages[i]);
+    }
+
+    return page;
+}
+
+static void relinquish_worker(unsigned long data)
+{
+    struct relmem_worker *w = (void *)data;
+    struct domain *d = w->domain;
+
+    while ( relinquish_chunk(d) )
+    {
+        if ( softirq_pending(smp_processor_id()) )
+        {
+            tasklet_schedule(&w->tasklet);
+            return;
+        }
+    }
+
+    atomic_dec(&d->arch.relmem_active);
+}
+
+static void relinquish_start_workers(struct domain *d)
+{
+    unsigned int cpu, nr = 0;
+
+    if ( !opt_parallel_relinquish || d->tot_pages < RELMEM_MIN_PAGES )
+        return;
+
+    d->arch.relmem_workers = xzalloc_array(struct relmem_worker,
+                                           RELMEM_MAX_WORKERS);
+    if ( !d->arch.relmem_workers )
+        return;
+
+    for_each_online_cpu ( cpu )
+    {
+        struct relmem_worker *w;
+
+        if ( nr == RELMEM_MAX_WORKERS )
+            break;
+
+        /* Racy, but only meant to avoid getting in the way of guests. */
+        if ( cpu == smp_processor_id() ||
+             !is_idle_vcpu(get_cpu_current(cpu)) )
+            continue;
+
+        w = &d->arch.relmem_workers[nr++];
+        w->domain = d;
+        tasklet_init(&w->tasklet, relinquish_worker, (unsigned long)w);
+        atomic_inc(&d->arch.relmem_active);
+        tasklet_schedule_on_cpu(&w->tasklet, cpu);
+    }
+
+    d->arch.nr_relmem_workers = nr;
+}
+
+/*
+ * Relinquish d->page_list together with the helpers, if any.  Whatever is
+ * left on d->arch.relmem_list (pages with references held elsewhere) is put
+ * back on d->page_list for the serial passes.
+ */
+static int relinquish_parallel(struct domain *d)
+{
+    unsigned int i;
+
+    while ( relinquish_chunk(d) )
+        if ( hypercall_preempt_check() )
+            return -ERESTART;
+
+    if ( atomic_read(&d->arch.relmem_active) )
+        return -ERESTART;
+
+    for ( i = 0; i < d->arch.nr_relmem_workers; i++ )
+        tasklet_kill(&d->arch.relmem_workers[i].tasklet);
+    XFREE(d->arch.relmem_workers);
+    d->arch.nr_relmem_workers = 0;
+
+    spin_lock(&d->page_alloc_lock);
+    page_list_move(&d->page_list, &d->arch.relmem_list);
+    spin_unlock(&d->page_alloc_lock);
+
+    return 0;
+}
+
 int domain_relinquish_resources(struct domain *d)
 {
     int ret;
@@ -2115,6 +2272,7 @@ int domain_relinquish_resources(struct domain *d)
             PROG_paging = 1,
             PROG_vcpu_pagetables,
             PROG_shared,
+            PROG_parallel,
             PROG_xen,
             PROG_l4,
             PROG_l3,
@@ -2186,6 +2344,18 @@ int domain_relinquish_resources(struct domain *d)
         INIT_PAGE_LIST_HEAD(&d->arch.relmem_list);
         spin_unlock(&d->page_alloc_lock);
 
+        if ( is_hvm_domain(d) )
+            relinquish_start_workers(d);
+
+    PROGRESS(parallel):
+
+        if ( is_hvm_domain(d) )
+        {
+            ret = relinquish_parallel(d);
+            if ( ret )
+                return ret;
+        }
+
     PROGRESS(xen):
 
         ret = relinquish_memory(d, &d->xenpage_list, ~0UL);
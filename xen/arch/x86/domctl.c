@@ -1177,6 +1177,36 @@ long arch_do_domctl(
         break;
 #endif /* P2M_AUDIT */
 
+#ifdef CONFIG_HVM
+    case XEN_DOMCTL_p2m_superpages:
+        ret = p2m_get_superpages(d, &domctl->u.p2m_superpages);
+        if ( ret == -ERESTART )
+        {
+            if ( __copy_to_guest(u_domctl, domctl, 1) )
+                ret = -EFAULT;
+            else
+                ret = hypercall_create_continuation(__HYPERVISOR_domctl,
+                                                    "h", u_domctl);
+            break;
+        }
+        copyback = true;
+        break;
+
+    case XEN_DOMCTL_p2m_access_bits:
+        ret = p2m_access_bits(d, &domctl->u.p2m_access_bits);
+        if ( ret == -ERESTART )
+        {
+            if ( __copy_to_guest(u_domctl, domctl, 1) )
+                ret = -EFAULT;
+            else
+                ret = hypercall_create_continuation(__HYPERVISOR_domctl,
+                                                    "h", u_domctl);
+            break;
+        }
+        copyback = true;
+        break;
+#endif
+
     case XEN_DOMCTL_set_broken_page_p2m:
     {
         p2m_type_t pt;
@@ -234,7 +234,7 @@ static int set_mem_type(struct domain *d,
 {
     xen_pfn_t last_pfn = data->first_pfn + data->nr - 1;
     unsigned int iter = 0, mem_type;
-    int rc = 0;
+    int rc = 0, ret;
 
     /* Interface types to internal p2m types */
     static const p2m_type_t memtype[] = {
@@ -267,6 +267,9 @@ static int set_mem_type(struct domain *d,
             return -EINVAL;
     }
 
+    /* Have the type changes flushed in batches of 256. */
+    p2m_batch_begin(d);
+
     while ( iter < data->nr )
     {
         unsigned long pfn = data->first_pfn + iter;
@@ -276,8 +279,9 @@ static int set_mem_type(struct domain *d,
         if ( p2m_is_paging(t) )
         {
             put_gfn(d, pfn);
+            ret = p2m_batch_end(d);
             p2m_mem_paging_populate(d, pfn);
-            return -EAGAIN;
+            return ret ?: -EAGAIN;
         }
 
         if ( p2m_is_shared(t) )
@@ -295,20 +299,31 @@ static int set_mem_type(struct domain *d,
         iter++;
 
         /*
-         * Check for continuation every 256th iteration and if the
-         * iteration is not the last.
+         * Flush, and check for continuation, every 256th iteration and if
+         * the iteration is not the last.
          */
-        if ( (iter < data->nr) && ((iter & 0xff) == 0) &&
-             hypercall_preempt_check() )
+        if ( (iter < data->nr) && ((iter & 0xff) == 0) )
         {
-            data->first_pfn += iter;
-            data->nr -= iter;
+            rc = p2m_batch_end(d);
+            if ( rc )
+                return rc;
 
-            rc = -ERESTART;
-            break;
+            if ( hypercall_preempt_check() )
+            {
+                data->first_pfn += iter;
+                data->nr -= iter;
+
+                return -ERESTART;
+            }
+
+            p2m_batch_begin(d);
         }
     }
 
+    ret = p2m_batch_end(d);
+    if ( !rc )
+        rc = ret;
+
     return rc;
 }
 
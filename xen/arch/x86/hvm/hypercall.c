@@ -159,6 +159,7 @@ int hvm_hypercall(struct cpu_user_regs *regs)
     struct domain *currd = curr->domain;
     int mode = hvm_guest_x86_mode(curr);
     unsigned long eax = regs->eax;
+    s_time_t start;
 
     switch ( mode )
     {
@@ -203,6 +204,7 @@ int hvm_hypercall(struct cpu_user_regs *regs)
     }
 
     curr->hcall_preempted = false;
+    start = NOW();
 
     if ( mode == 8 )
     {
@@ -295,6 +297,8 @@ int hvm_hypercall(struct cpu_user_regs *regs)
 #endif
     }
 
+    hypercall_stats_account(curr, eax, start);
+
     HVM_DBG_LOG(DBG_LEVEL_HCALL, "hcall%lu -> %lx", eax, regs->rax);
 
     if ( curr->hcall_preempted )
@@ -1065,6 +1065,8 @@ void svm_vmenter_helper(const struct cpu_user_regs *regs)
                     nestedhvm_vcpu_in_guestmode(curr) ? TRC_HVM_NESTEDFLAG : 0,
                     1/*cycles*/, 0, 0, 0, 0, 0, 0, 0);
 
+    hvm_exit_stats_stop(curr);
+
     svm_sync_vmcb(curr, vmcb_needs_vmsave);
 
     vmcb->rax = regs->rax;
@@ -2535,6 +2537,10 @@ void svm_vmexit_handler(struct cpu_user_regs *regs)
 
     exit_reason = vmcb->exitcode;
 
+    hvm_exit_stats_start(v, exit_reason == VMEXIT_NPF ? HVM_EXIT_STATS_SVM_NPF
+                            : exit_reason < HVM_EXIT_STATS_SVM_NPF
+                            ? exit_reason : HVM_EXIT_STATS_OTHER);
+
     if ( hvm_long_mode_active(v) )
         HVMTRACE_ND(VMEXIT64, vcpu_guestmode ? TRC_HVM_NESTEDFLAG : 0,
                     1/*cycles*/, 3, exit_reason,
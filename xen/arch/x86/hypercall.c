@@ -262,6 +262,23 @@ int hypercall_xlat_continuation(unsigned int *id, unsigned int nr,
     return rc;
 }
 
+/*
+ * Account a hypercall of v, dispatched at start, once it returns or got
+ * preempted.  Only v updates its statistics, so they need no locking.
+ */
+void hypercall_stats_account(struct vcpu *v, unsigned int op, s_time_t start)
+{
+    typeof(v->arch.hcall_stats->op[0]) *s = &v->arch.hcall_stats->op[op];
+    s_time_t delta = max(NOW() - start, (s_time_t)0);
+    unsigned int b = fls64(delta);
+
+    s->calls++;
+    if ( v->hcall_preempted )
+        s->preempted++;
+    s->time += delta;
+    s->latency[b <= 9 ? 0 : min(b - 9, HYPERCALL_STATS_BUCKETS - 1u)]++;
+}
+
 #ifndef CONFIG_PV
 /* Stub for arch_do_multicall_call */
 enum mc_disposition arch_do_multicall_call(struct mc_state *mc)
@@ -22,9 +22,45 @@
 
 #include <asm/p2m.h>
 #include <xen/guest_access.h>
+#include <xen/event.h>
 #include <xen/vm_event.h>
 #include <xsm/xsm.h>
 
+/*
+ * Nominate or evict the gfns of a batch, storing each result in its entry.
+ * Returns 1 when preempted, with mpo advanced past the entries done.
+ */
+static int paging_batch(struct domain *d, xen_mem_paging_op_t *mpo)
+{
+    XEN_GUEST_HANDLE_PARAM(xen_mem_paging_batch_entry_t) entries =
+        guest_handle_from_ptr((void *)(unsigned long)mpo->buffer,
+                              xen_mem_paging_batch_entry_t);
+
+    while ( mpo->gfn )
+    {
+        xen_mem_paging_batch_entry_t e;
+
+        if ( copy_from_guest(&e, entries, 1) )
+            return -EFAULT;
+
+        if ( mpo->op == XENMEM_paging_op_nominate_batch )
+            e.rc = p2m_mem_paging_nominate(d, e.gfn);
+        else
+            e.rc = p2m_mem_paging_evict(d, e.gfn);
+
+        if ( copy_field_to_guest(entries, &e, rc) )
+            return -EFAULT;
+
+        guest_handle_add_offset(entries, 1);
+        mpo->buffer += sizeof(e);
+
+        if ( --mpo->gfn && hypercall_preempt_check() )
+            return 1;
+    }
+
+    return 0;
+}
+
 int mem_paging_memop(XEN_GUEST_HANDLE_PARAM(xen_mem_paging_op_t) arg)
 {
     int rc;
@@ -57,6 +93,20 @@ int mem_paging_memop(XEN_GUEST_HANDLE_PARAM(xen_mem_paging_op_t) arg)
         rc = p2m_mem_paging_evict(d, mpo.gfn);
         break;
 
+    case XENMEM_paging_op_nominate_batch:
+    case XENMEM_paging_op_evict_batch:
+        rc = paging_batch(d, &mpo);
+        if ( rc > 0 )
+        {
+            if ( __copy_to_guest(arg, &mpo, 1) )
+                rc = -EFAULT;
+            else
+                rc = hypercall_create_continuation(__HYPERVISOR_memory_op,
+                                                   "lh", XENMEM_paging_op,
+                                                   arg);
+        }
+        break;
+
     case XENMEM_paging_op_prep:
         rc = p2m_mem_paging_prep(d, mpo.gfn, mpo.buffer);
         if ( !rc )
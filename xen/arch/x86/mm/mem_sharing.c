@@ -21,6 +21,7 @@
  */
 
 #include <xen/types.h>
+#include <xen/domain.h>
 #include <xen/domain_page.h>
 #include <xen/spinlock.h>
 #include <xen/rwlock.h>
@@ -36,6 +37,8 @@
 #include <asm/altp2m.h>
 #include <asm/atomic.h>
 #include <asm/event.h>
+#include <asm/hap.h>
+#include <asm/hvm/hvm.h>
 #include <xsm/xsm.h>
 
 #include "mm-locks.h"
@@ -53,12 +56,13 @@ static DEFINE_PER_CPU(pg_lock_data_t, __pld);
     debugtrace_printk("mem_sharing_debug: %s(): " _f, __func__, ##_a)
 
 /* Reverse map defines */
-#define RMAP_HASHTAB_ORDER  0
-#define RMAP_HASHTAB_SIZE   \
-        ((PAGE_SIZE << RMAP_HASHTAB_ORDER) / sizeof(struct list_head))
 #define RMAP_USES_HASHTAB(page) \
-        ((page)->sharing->hash_table.flag == NULL)
-#define RMAP_HEAVY_SHARED_PAGE   RMAP_HASHTAB_SIZE
+        ((page)->sharing->rmap_order != 0)
+#define RMAP_HASHTAB_MIN_ORDER   6
+#define RMAP_HASHTAB_MAX_ORDER   16
+/* Average bucket length beyond which the hash table is grown. */
+#define RMAP_HASHTAB_LOAD        2
+#define RMAP_HEAVY_SHARED_PAGE   (1u << RMAP_HASHTAB_MIN_ORDER)
 /* A bit of hysteresis. We don't want to be mutating between list and hash
  * table constantly. */
 #define RMAP_LIGHT_SHARED_PAGE   (RMAP_HEAVY_SHARED_PAGE >> 2)
@@ -88,8 +92,7 @@ static inline void page_sharing_dispose(struct page_info *page)
 {
     /* Unlikely given our thresholds, but we should be careful. */
     if ( unlikely(RMAP_USES_HASHTAB(page)) )
-        free_xenheap_pages(page->sharing->hash_table.bucket, 
-                            RMAP_HASHTAB_ORDER);
+        xfree(page->sharing->buckets);
 
     spin_lock(&shr_audit_lock);
     list_del_rcu(&page->sharing->entry);
@@ -105,8 +108,7 @@ static inline void page_sharing_dispose(struct page_info *page)
 {
     /* Unlikely given our thresholds, but we should be careful. */
     if ( unlikely(RMAP_USES_HASHTAB(page)) )
-        free_xenheap_pages(page->sharing->hash_table.bucket, 
-                            RMAP_HASHTAB_ORDER);
+        xfree(page->sharing->buckets);
     xfree(page->sharing);
 }
 
@@ -205,13 +207,18 @@ static atomic_t nr_shared_mfns  = ATOMIC_INIT(0);
 /* Every shared frame keeps a reverse map (rmap) of <domain, gfn> tuples that
  * this shared frame backs. For pages with a low degree of sharing, a O(n)
  * search linked list is good enough. For pages with higher degree of sharing,
- * we use a hash table instead. */
+ * we use a hash table instead, grown as the number of sharers increases so
+ * that lookups (on unshare) stay O(1) even for pages shared by hundreds of
+ * domains. */
 
 typedef struct gfn_info
 {
     unsigned long gfn;
     domid_t domain; 
-    struct list_head list;
+    union {
+        struct list_head list;    /* When the rmap is a list. */
+        struct hlist_node node;   /* When the rmap is a hash table. */
+    };
 } gfn_info_t;
 
 static inline void
@@ -219,60 +226,88 @@ rmap_init(struct page_info *page)
 {
     /* We always start off as a doubly linked list. */
     INIT_LIST_HEAD(&page->sharing->gfns);
+    page->sharing->rmap_order = 0;
 }
 
-/* Exceedingly simple "hash function" */
-#define HASH(domain, gfn)       \
-    (((gfn) + (domain)) % RMAP_HASHTAB_SIZE)
-
-/* Conversions. Tuned by the thresholds. Should only happen twice 
- * (once each) during the lifetime of a shared page */
-static inline int
-rmap_list_to_hash_table(struct page_info *page)
+/*
+ * Multiplicative (Fibonacci) hashing: the top bits of the product depend on
+ * all bits of the key, so neither consecutive gfns nor the same gfn shared
+ * by many domains end up clustering in a few buckets.
+ */
+static inline unsigned int
+rmap_hash(domid_t domain, unsigned long gfn, unsigned int order)
 {
-    unsigned int i;
-    struct list_head *pos, *tmp, *b =
-        alloc_xenheap_pages(RMAP_HASHTAB_ORDER, 0);
+    uint64_t key = gfn ^ ((uint64_t)domain << 48);
 
-    if ( b == NULL )
-        return -ENOMEM;
-
-    for ( i = 0; i < RMAP_HASHTAB_SIZE; i++ )
-        INIT_LIST_HEAD(b + i);
-
-    list_for_each_safe(pos, tmp, &page->sharing->gfns)
-    {
-        gfn_info_t *gfn_info = list_entry(pos, gfn_info_t, list);
-        struct list_head *bucket = b + HASH(gfn_info->domain, gfn_info->gfn);
-        list_del(pos);
-        list_add(pos, bucket);
-    }
+    return (key * 0x9e3779b97f4a7c15ULL) >> (64 - order);
+}
 
-    page->sharing->hash_table.bucket = b;
-    page->sharing->hash_table.flag   = NULL;
+static inline void
+rmap_insert(gfn_info_t *gfn_info, struct page_info *page)
+{
+    unsigned int order = page->sharing->rmap_order;
 
-    return 0;
+    if ( order )
+        hlist_add_head(&gfn_info->node, page->sharing->buckets +
+                       rmap_hash(gfn_info->domain, gfn_info->gfn, order));
+    else
+        list_add(&gfn_info->list, &page->sharing->gfns);
 }
 
-static inline void
-rmap_hash_table_to_list(struct page_info *page)
+/* Switch the rmap to a hash table of 1 << order buckets, or to a list if
+ * order is 0. May only fail with -ENOMEM, leaving the rmap unchanged. */
+static int
+rmap_rehash(struct page_info *page, unsigned int order)
 {
+    struct page_sharing_info *sharing = page->sharing;
+    struct hlist_head *b = NULL, entries = { NULL };
+    struct hlist_node *pos, *tmp;
     unsigned int i;
-    struct list_head *bucket = page->sharing->hash_table.bucket;
 
-    INIT_LIST_HEAD(&page->sharing->gfns);
+    if ( order )
+    {
+        b = xmalloc_array(struct hlist_head, 1u << order);
+        if ( b == NULL )
+            return -ENOMEM;
+        for ( i = 0; i < (1u << order); i++ )
+            INIT_HLIST_HEAD(b + i);
+    }
 
-    for ( i = 0; i < RMAP_HASHTAB_SIZE; i++ )
+    /* Unhook all entries into a temporary chain first: the list and the hash
+     * table overlap within both page_sharing_info and gfn_info. */
+    if ( RMAP_USES_HASHTAB(page) )
     {
-        struct list_head *pos, *tmp, *head = bucket + i;
-        list_for_each_safe(pos, tmp, head)
+        for ( i = 0; i < (1u << sharing->rmap_order); i++ )
+            hlist_for_each_safe(pos, tmp, sharing->buckets + i)
+            {
+                __hlist_del(pos);
+                hlist_add_head(pos, &entries);
+            }
+        xfree(sharing->buckets);
+    }
+    else
+    {
+        struct list_head *le, *ltmp;
+
+        list_for_each_safe(le, ltmp, &sharing->gfns)
         {
-            list_del(pos);
-            list_add(pos, &page->sharing->gfns);
+            gfn_info_t *gfn_info = list_entry(le, gfn_info_t, list);
+
+            list_del(le);
+            hlist_add_head(&gfn_info->node, &entries);
         }
     }
 
-    free_xenheap_pages(bucket, RMAP_HASHTAB_ORDER);
+    sharing->rmap_order = order;
+    if ( order )
+        sharing->buckets = b;
+    else
+        INIT_LIST_HEAD(&sharing->gfns);
+
+    hlist_for_each_safe(pos, tmp, &entries)
+        rmap_insert(hlist_entry(pos, gfn_info_t, node), page);
+
+    return 0;
 }
 
 /* Generic accessors to the rmap */
@@ -293,51 +328,65 @@ rmap_count(struct page_info *pg)
 static inline void
 rmap_del(gfn_info_t *gfn_info, struct page_info *page, int convert)
 {
-    if ( RMAP_USES_HASHTAB(page) && convert &&
-         (rmap_count(page) <= RMAP_LIGHT_SHARED_PAGE) )
-        rmap_hash_table_to_list(page);
+    unsigned int order = page->sharing->rmap_order;
+    unsigned long count;
 
-    /* Regardless of rmap type, same removal operation */
-    list_del(&gfn_info->list);
+    if ( order )
+        hlist_del(&gfn_info->node);
+    else
+        list_del(&gfn_info->list);
+
+    if ( !order || !convert )
+        return;
+
+    /* The type count still includes the entry just removed. */
+    count = rmap_count(page) - 1;
+    if ( count <= RMAP_LIGHT_SHARED_PAGE )
+        rmap_rehash(page, 0);
+    else if ( order > RMAP_HASHTAB_MIN_ORDER && count < (1ul << order) / 4 )
+        /* Shrinking is an optimization only: ignore -ENOMEM. */
+        (void)rmap_rehash(page, order - 1);
 }
 
 /* The page type count is always increased before adding to the rmap. */
 static inline void
 rmap_add(gfn_info_t *gfn_info, struct page_info *page)
 {
-    struct list_head *head;
-
-    if ( !RMAP_USES_HASHTAB(page) &&
-         (rmap_count(page) >= RMAP_HEAVY_SHARED_PAGE) )
-        /* The conversion may fail with ENOMEM. We'll be less efficient,
-         * but no reason to panic. */
-        (void)rmap_list_to_hash_table(page);
-
-    head = (RMAP_USES_HASHTAB(page)) ?
-        page->sharing->hash_table.bucket + 
-                            HASH(gfn_info->domain, gfn_info->gfn) :
-        &page->sharing->gfns;
-
-    INIT_LIST_HEAD(&gfn_info->list);
-    list_add(&gfn_info->list, head);
+    unsigned int order = page->sharing->rmap_order;
+    unsigned long count = rmap_count(page);
+
+    /* The conversion may fail with ENOMEM. We'll be less efficient,
+     * but no reason to panic. */
+    if ( !order && count >= RMAP_HEAVY_SHARED_PAGE )
+        (void)rmap_rehash(page, RMAP_HASHTAB_MIN_ORDER);
+    else if ( order && order < RMAP_HASHTAB_MAX_ORDER &&
+              count > ((unsigned long)RMAP_HASHTAB_LOAD << order) )
+        (void)rmap_rehash(page, order + 1);
+
+    rmap_insert(gfn_info, page);
 }
 
 static inline gfn_info_t *
 rmap_retrieve(uint16_t domain_id, unsigned long gfn, 
                             struct page_info *page)
 {
+    unsigned int order = page->sharing->rmap_order;
     gfn_info_t *gfn_info;
-    struct list_head *le, *head;
 
-    head = (RMAP_USES_HASHTAB(page)) ?
-        page->sharing->hash_table.bucket + HASH(domain_id, gfn) :
-        &page->sharing->gfns;
+    if ( order )
+    {
+        struct hlist_node *pos;
 
-    list_for_each(le, head)
+        hlist_for_each_entry(gfn_info, pos, page->sharing->buckets +
+                             rmap_hash(domain_id, gfn, order), node)
+            if ( (gfn_info->gfn == gfn) && (gfn_info->domain == domain_id) )
+                return gfn_info;
+    }
+    else
     {
-        gfn_info = list_entry(le, gfn_info_t, list);
-        if ( (gfn_info->gfn == gfn) && (gfn_info->domain == domain_id) )
-            return gfn_info;
+        list_for_each_entry(gfn_info, &page->sharing->gfns, list)
+            if ( (gfn_info->gfn == gfn) && (gfn_info->domain == domain_id) )
+                return gfn_info;
     }
 
     /* Nothing was found */
@@ -356,53 +405,55 @@ static inline int rmap_has_entries(struct page_info *page)
     return (rmap_count(page) != 0);
 }
 
-/* The iterator hides the details of how the rmap is implemented. This
- * involves splitting the list_for_each_safe macro into two steps. */
+/* The iterator hides the details of how the rmap is implemented. The
+ * current entry may be removed (without conversion) while iterating. */
 struct rmap_iterator {
-    struct list_head *curr;
     struct list_head *next;
+    struct hlist_node *hnext;
     unsigned int bucket;
 };
 
 static inline void
 rmap_seed_iterator(struct page_info *page, struct rmap_iterator *ri)
 {
-    ri->curr = (RMAP_USES_HASHTAB(page)) ?
-                page->sharing->hash_table.bucket :
-                &page->sharing->gfns;
-    ri->next = ri->curr->next; 
     ri->bucket = 0;
+    ri->next = NULL;
+    ri->hnext = NULL;
+    if ( RMAP_USES_HASHTAB(page) )
+        ri->hnext = page->sharing->buckets[0].first;
+    else
+        ri->next = page->sharing->gfns.next;
 }
 
 static inline gfn_info_t *
 rmap_iterate(struct page_info *page, struct rmap_iterator *ri)
 {
-    struct list_head *head = (RMAP_USES_HASHTAB(page)) ?
-                page->sharing->hash_table.bucket + ri->bucket :
-                &page->sharing->gfns;
+    gfn_info_t *gfn_info;
 
-retry:
-    if ( ri->next == head)
+    if ( !RMAP_USES_HASHTAB(page) )
     {
-        if ( RMAP_USES_HASHTAB(page) )
-        {
-            ri->bucket++;
-            if ( ri->bucket >= RMAP_HASHTAB_SIZE )
-                /* No more hash table buckets */
-                return NULL;
-            head = page->sharing->hash_table.bucket + ri->bucket;
-            ri->curr = head;
-            ri->next = ri->curr->next;
-            goto retry;
-        } else
+        if ( ri->next == &page->sharing->gfns )
             /* List exhausted */
             return NULL;
+
+        gfn_info = list_entry(ri->next, gfn_info_t, list);
+        ri->next = ri->next->next;
+
+        return gfn_info;
+    }
+
+    while ( ri->hnext == NULL )
+    {
+        if ( ++ri->bucket >= (1u << page->sharing->rmap_order) )
+            /* No more hash table buckets */
+            return NULL;
+        ri->hnext = page->sharing->buckets[ri->bucket].first;
     }
 
-    ri->curr = ri->next;
-    ri->next = ri->curr->next;
+    gfn_info = hlist_entry(ri->hnext, gfn_info_t, node);
+    ri->hnext = ri->hnext->next;
 
-    return list_entry(ri->curr, gfn_info_t, list);
+    return gfn_info;
 }
 
 static inline gfn_info_t *mem_sharing_gfn_alloc(struct page_info *page,
@@ -1023,7 +1074,10 @@ static int share_pages(struct domain *sd, gfn_t sgfn, shr_handle_t sh,
         BUG_ON(set_shared_p2m_entry(d, gfn->gfn, smfn));
         put_domain(d);
     }
-    ASSERT(list_empty(&cpage->sharing->gfns));
+    if ( RMAP_USES_HASHTAB(cpage) )
+        ASSERT(!rmap_has_entries(cpage));
+    else
+        ASSERT(list_empty(&cpage->sharing->gfns));
     BUG_ON(!put_count);
 
     /* Clear the rest of the shared state */
@@ -1133,6 +1187,322 @@ err_out:
 }
 
 
+/** VM forking **/
+/* A fork is a domain whose memory is populated lazily from its (paused)
+ * parent: on first access a gfn is either shared with the parent, or, for
+ * writes or pages that can't be shared, backed by a copy of the parent's
+ * page. vCPU and HVM platform state are copied when forking. Resetting a
+ * fork throws away its private pages and copies the parent's state again,
+ * which is cheap as long as the fork dirtied little memory. */
+
+int mem_sharing_fork_page(struct domain *d, gfn_t gfn, bool unsharing)
+{
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
+    struct domain *parent;
+    struct page_info *page;
+    shr_handle_t handle;
+    p2m_type_t p2mt;
+    mfn_t mfn, new_mfn;
+    int rc;
+
+    ASSERT(p2m_locked_by_me(p2m));
+
+    if ( !mem_sharing_is_fork(d) )
+        return -ENOENT;
+
+    /* Find the nearest ancestor with the gfn populated: forks of forks may
+     * not have populated it yet, while any entry a fork has supersedes its
+     * own parent's. */
+    for ( parent = d->parent; ; parent = parent->parent )
+    {
+        if ( !parent || parent->is_dying )
+            return -ENOENT;
+
+        mfn = get_gfn_query(parent, gfn_x(gfn), &p2mt);
+        if ( !p2m_is_hole(p2mt) )
+            break;
+        put_gfn(parent, gfn_x(gfn));
+    }
+
+    /* E.g. paged out: older ancestors' contents would be stale. */
+    if ( !mfn_valid(mfn) || !p2m_is_ram(p2mt) )
+    {
+        put_gfn(parent, gfn_x(gfn));
+        return -ENOENT;
+    }
+
+    /* For reads, the ancestor's page is shared with the fork. */
+    if ( !unsharing && !nominate_page(parent, gfn, 0, &handle) &&
+         !mem_sharing_add_to_physmap(parent, gfn_x(gfn), handle,
+                                     d, gfn_x(gfn)) )
+    {
+        put_gfn(parent, gfn_x(gfn));
+        return 0;
+    }
+
+    /* Writes, or pages which can't be shared, get a private copy. */
+    page = alloc_domheap_page(d, 0);
+    if ( !page )
+    {
+        put_gfn(parent, gfn_x(gfn));
+        return -ENOMEM;
+    }
+
+    new_mfn = page_to_mfn(page);
+    copy_domain_page(new_mfn, mfn);
+    put_gfn(parent, gfn_x(gfn));
+
+    rc = p2m_set_entry(p2m, gfn, new_mfn, PAGE_ORDER_4K, p2m_ram_rw,
+                       p2m->default_access);
+    if ( rc )
+    {
+        put_page_alloc_ref(page);
+        put_page(page);
+        return rc;
+    }
+
+    set_gpfn_from_mfn(mfn_x(new_mfn), gfn_x(gfn));
+
+    return 0;
+}
+
+static int bring_up_vcpus(struct domain *cd, struct domain *d)
+{
+    unsigned int i;
+
+    for ( i = 0; i < d->max_vcpus; i++ )
+    {
+        if ( !d->vcpu[i] || cd->vcpu[i] )
+            continue;
+
+        if ( vcpu_create(cd, i) == NULL )
+            return -ENOMEM;
+    }
+
+    domain_update_node_affinity(cd);
+
+    return 0;
+}
+
+static int copy_vcpu_settings(struct domain *cd, struct domain *d)
+{
+    unsigned int i;
+    int rc;
+
+    for ( i = 0; i < cd->max_vcpus; i++ )
+    {
+        const struct vcpu *d_vcpu = d->vcpu[i];
+        struct vcpu *cd_vcpu = cd->vcpu[i];
+        mfn_t vcpu_info_mfn;
+
+        if ( !d_vcpu || !cd_vcpu )
+            continue;
+
+        /* Map the vcpu_info at the same place as the parent, if it uses a
+         * separate page for it, and bring the contents in line. */
+        vcpu_info_mfn = d_vcpu->vcpu_info_mfn;
+        if ( mfn_eq(vcpu_info_mfn, INVALID_MFN) )
+            continue;
+
+        if ( mfn_eq(cd_vcpu->vcpu_info_mfn, INVALID_MFN) )
+        {
+            unsigned long gfn = get_gpfn_from_mfn(mfn_x(vcpu_info_mfn));
+            struct page_info *page;
+
+            if ( !VALID_M2P(gfn) )
+                return -EINVAL;
+
+            /* map_vcpu_info() wants a private page. */
+            page = get_page_from_gfn(cd, gfn, NULL, P2M_UNSHARE);
+            if ( !page )
+                return -ENOMEM;
+            put_page(page);
+
+            rc = map_vcpu_info(cd_vcpu, gfn,
+                               (unsigned long)d_vcpu->vcpu_info & ~PAGE_MASK);
+            if ( rc )
+                return rc;
+        }
+
+        copy_domain_page(cd_vcpu->vcpu_info_mfn, vcpu_info_mfn);
+    }
+
+    return 0;
+}
+
+static int copy_shared_info(struct domain *cd, struct domain *d)
+{
+    mfn_t old_mfn = _mfn(virt_to_mfn(d->shared_info));
+    mfn_t new_mfn = _mfn(virt_to_mfn(cd->shared_info));
+    unsigned long gfn = get_gpfn_from_mfn(mfn_x(old_mfn));
+    int rc = 0;
+
+    /* Map the fork's shared_info where the parent has its own. */
+    if ( VALID_M2P(gfn) )
+    {
+        p2m_type_t t;
+        mfn_t mfn = get_gfn_query(cd, gfn, &t);
+
+        if ( !mfn_eq(mfn, new_mfn) )
+            rc = p2m_is_hole(t) ? guest_physmap_add_page(cd, _gfn(gfn), new_mfn,
+                                                         PAGE_ORDER_4K)
+                                : -EBUSY;
+        put_gfn(cd, gfn);
+    }
+
+    if ( !rc )
+        copy_domain_page(new_mfn, old_mfn);
+
+    return rc;
+}
+
+static void copy_tsc(struct domain *cd, struct domain *d)
+{
+    uint32_t tsc_mode, gtsc_khz, incarnation;
+    uint64_t elapsed_nsec;
+
+    tsc_get_info(d, &tsc_mode, &elapsed_nsec, &gtsc_khz, &incarnation);
+    /* Setting bumps the incarnation: keep the parent's. */
+    tsc_set_info(cd, tsc_mode, elapsed_nsec, gtsc_khz, incarnation - 1);
+}
+
+static int copy_settings(struct domain *cd, struct domain *d)
+{
+    int rc;
+
+    /* Before the HVM context brings the fork's vCPUs up. */
+    rc = copy_vcpu_settings(cd, d);
+    if ( rc )
+        return rc;
+
+    rc = hvm_copy_context_and_params(cd, d);
+    if ( rc )
+        return rc;
+
+    rc = copy_shared_info(cd, d);
+    if ( rc )
+        return rc;
+
+    copy_tsc(cd, d);
+
+    return 0;
+}
+
+/* Turn cd, a freshly created domain, into a fork of d. Preemptible. */
+static int fork(struct domain *cd, struct domain *d)
+{
+    unsigned int mb;
+    bool preempted = false;
+    int rc;
+
+    if ( cd->parent != d )
+    {
+        /* Both domains must be paused by the toolstack, and the fork must
+         * not have any memory yet. */
+        if ( cd == d || cd->parent || cd->max_vcpus != d->max_vcpus ||
+             !hap_enabled(cd) )
+            return -EINVAL;
+        if ( !cd->controller_pause_count || !d->controller_pause_count ||
+             cd->tot_pages || d->is_dying || !get_domain(d) )
+            return -EBUSY;
+
+        /* Forks are populated from the parent's memory as they run, which
+         * therefore must not change until the last fork is gone. */
+        domain_pause(d);
+        cd->parent = d;
+    }
+
+    /* The fork needs as large a p2m as its parent. */
+    mb = hap_get_allocation(d);
+    if ( hap_get_allocation(cd) < mb )
+    {
+        paging_lock(cd);
+        rc = hap_set_allocation(cd, mb << (20 - PAGE_SHIFT), &preempted);
+        paging_unlock(cd);
+        if ( rc )
+            goto fail;
+        if ( preempted )
+            return -ERESTART;
+    }
+
+    rc = bring_up_vcpus(cd, d);
+    if ( !rc )
+        rc = copy_settings(cd, d);
+    if ( !rc || rc == -ERESTART )
+        return rc;
+
+ fail:
+    cd->parent = NULL;
+    domain_unpause(d);
+    put_domain(d);
+
+    return rc;
+}
+
+/* Drop the private pages of fork d, and copy its parent's state again.
+ * Pages referenced elsewhere (e.g. vcpu_info) are kept. Preemptible. */
+static int fork_reset(struct domain *d, struct domain *pd)
+{
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
+    struct page_info *page, *tmp;
+    unsigned int count = 0;
+    int rc = 0;
+
+    domain_pause(d);
+
+    p2m_lock(p2m);
+    spin_lock_recursive(&d->page_alloc_lock);
+
+    page_list_for_each_safe ( page, tmp, &d->page_list )
+    {
+        mfn_t mfn = page_to_mfn(page);
+        unsigned long gfn = get_gpfn_from_mfn(mfn_x(mfn));
+        p2m_access_t a;
+        p2m_type_t t;
+
+        if ( !VALID_M2P(gfn) ||
+             !mfn_eq(p2m->get_entry(p2m, _gfn(gfn), &t, &a, 0, NULL, NULL),
+                     mfn) ||
+             t != p2m_ram_rw || !get_page(page, d) )
+            continue;
+
+        /* The allocation reference plus ours. */
+        if ( (page->count_info & PGC_count_mask) != 2 )
+        {
+            put_page(page);
+            continue;
+        }
+
+        rc = p2m_set_entry(p2m, _gfn(gfn), INVALID_MFN, PAGE_ORDER_4K,
+                           p2m_invalid, p2m->default_access);
+        if ( rc )
+        {
+            put_page(page);
+            break;
+        }
+
+        set_gpfn_from_mfn(mfn_x(mfn), INVALID_M2P_ENTRY);
+        put_page_alloc_ref(page);
+        put_page(page);
+
+        if ( !(++count & 0xff) && hypercall_preempt_check() )
+        {
+            rc = -ERESTART;
+            break;
+        }
+    }
+
+    spin_unlock_recursive(&d->page_alloc_lock);
+    p2m_unlock(p2m);
+
+    if ( !rc )
+        rc = copy_settings(d, pd);
+
+    domain_unpause(d);
+
+    return rc;
+}
+
 /* A note on the rationale for unshare error handling:
  *  1. Unshare can only fail with ENOMEM. Any other error conditions BUG_ON()'s
  *  2. We notify a potential dom0 helper through a vm_event ring. But we
@@ -1152,7 +1522,7 @@ int __mem_sharing_unshare_page(struct domain *d,
 {
     p2m_type_t p2mt;
     mfn_t mfn;
-    struct page_info *page, *old_page;
+    struct page_info *page, *old_page, *new_page = NULL;
     int last_gfn;
     gfn_info_t *gfn_info = NULL;
    
@@ -1164,6 +1534,24 @@ int __mem_sharing_unshare_page(struct domain *d,
         return 0;
     }
 
+    /* Allocate and fill the private copy before taking the page lock, which
+     * all sharers of the page contend on: the contents of a shared page
+     * don't change, and holding the gfn keeps our reference to it. Unless
+     * we're likely to be the last sharer, in which case we keep the page. */
+    if ( !(flags & MEM_SHARING_DESTROY_GFN) &&
+         rmap_count(mfn_to_page(mfn)) > 1 )
+    {
+        new_page = alloc_domheap_page(d, 0);
+        if ( !new_page )
+        {
+            put_gfn(d, gfn);
+            /* Caller is responsible for placing an event
+             * in the ring */
+            return -ENOMEM;
+        }
+        copy_domain_page(page_to_mfn(new_page), mfn);
+    }
+
     page = __grab_shared_page(mfn);
     if ( page == NULL )
     {
@@ -1195,6 +1583,14 @@ int __mem_sharing_unshare_page(struct domain *d,
     else
         atomic_dec(&nr_saved_mfns);
 
+    /* Lost a race with other sharers unsharing: we turned out to be last. */
+    if ( last_gfn && new_page )
+    {
+        put_page_alloc_ref(new_page);
+        put_page(new_page);
+        new_page = NULL;
+    }
+
     /* If the GFN is getting destroyed drop the references to MFN 
      * (possibly freeing the page), and exit early */
     if ( flags & MEM_SHARING_DESTROY_GFN )
@@ -1221,19 +1617,24 @@ int __mem_sharing_unshare_page(struct domain *d,
     }
 
     old_page = page;
-    page = alloc_domheap_page(d, 0);
-    if ( !page ) 
+    page = new_page;
+    if ( !page )
     {
-        /* Undo dec of nr_saved_mfns, as the retry will decrease again. */
-        atomic_inc(&nr_saved_mfns);
-        mem_sharing_page_unlock(old_page);
-        put_gfn(d, gfn);
-        /* Caller is responsible for placing an event
-         * in the ring */
-        return -ENOMEM;
-    }
+        /* Other sharers appeared since we checked. */
+        page = alloc_domheap_page(d, 0);
+        if ( !page )
+        {
+            /* Undo dec of nr_saved_mfns, as the retry will decrease again. */
+            atomic_inc(&nr_saved_mfns);
+            mem_sharing_page_unlock(old_page);
+            put_gfn(d, gfn);
+            /* Caller is responsible for placing an event
+             * in the ring */
+            return -ENOMEM;
+        }
 
-    copy_domain_page(page_to_mfn(page), page_to_mfn(old_page));
+        copy_domain_page(page_to_mfn(page), page_to_mfn(old_page));
+    }
 
     BUG_ON(set_shared_p2m_entry(d, gfn, page_to_mfn(page)));
     mem_sharing_gfn_destroy(old_page, d, gfn_info);
@@ -1310,6 +1711,15 @@ int relinquish_shared_pages(struct domain *d)
     }
 
     p2m_unlock(p2m);
+
+    /* The fork's memory is gone: its parent may run again. */
+    if ( !rc && d->parent )
+    {
+        domain_unpause(d->parent);
+        put_domain(d->parent);
+        d->parent = NULL;
+    }
+
     return rc;
 }
 
@@ -1364,6 +1774,35 @@ static int range_share(struct domain *d, struct domain *cd,
     return rc;
 }
 
+static int share_batch(struct domain *d, struct domain *cd,
+                       struct mem_sharing_op_share_batch *batch)
+{
+    while ( batch->done < batch->nr_entries )
+    {
+        xen_mem_sharing_batch_entry_t e;
+
+        if ( copy_from_guest_offset(&e, batch->entries, batch->done, 1) )
+            return -EFAULT;
+
+        /* Grant references aren't supported here. */
+        if ( XENMEM_SHARING_OP_FIELD_IS_GREF(e.source_gfn) ||
+             XENMEM_SHARING_OP_FIELD_IS_GREF(e.client_gfn) || e._pad )
+            e.rc = -EINVAL;
+        else
+            e.rc = share_pages(d, _gfn(e.source_gfn), e.source_handle,
+                               cd, _gfn(e.client_gfn), e.client_handle);
+
+        if ( copy_to_guest_offset(batch->entries, batch->done, &e, 1) )
+            return -EFAULT;
+
+        /* Check for continuation if it's not the last iteration. */
+        if ( ++batch->done < batch->nr_entries && hypercall_preempt_check() )
+            return 1;
+    }
+
+    return 0;
+}
+
 int mem_sharing_memop(XEN_GUEST_HANDLE_PARAM(xen_mem_sharing_op_t) arg)
 {
     int rc;
@@ -1630,6 +2069,99 @@ int mem_sharing_memop(XEN_GUEST_HANDLE_PARAM(xen_mem_sharing_op_t) arg)
         }
         break;
 
+        case XENMEM_sharing_op_share_batch:
+        {
+            struct domain *cd;
+
+            rc = -EINVAL;
+            if ( mso.u.batch._pad[0] || mso.u.batch._pad[1] ||
+                 mso.u.batch._pad[2] ||
+                 mso.u.batch.done > mso.u.batch.nr_entries )
+                goto out;
+
+            if ( !mem_sharing_enabled(d) )
+                goto out;
+
+            rc = rcu_lock_live_remote_domain_by_id(mso.u.batch.client_domain,
+                                                   &cd);
+            if ( rc )
+                goto out;
+
+            /* As for range sharing, reuse the XENMEM_sharing_op_share check. */
+            rc = xsm_mem_sharing_op(XSM_DM_PRIV, d, cd,
+                                    XENMEM_sharing_op_share);
+            if ( rc )
+            {
+                rcu_unlock_domain(cd);
+                goto out;
+            }
+
+            if ( !mem_sharing_enabled(cd) )
+            {
+                rcu_unlock_domain(cd);
+                rc = -EINVAL;
+                goto out;
+            }
+
+            rc = share_batch(d, cd, &mso.u.batch);
+            rcu_unlock_domain(cd);
+
+            if ( rc > 0 )
+            {
+                if ( __copy_to_guest(arg, &mso, 1) )
+                    rc = -EFAULT;
+                else
+                    rc = hypercall_create_continuation(__HYPERVISOR_memory_op,
+                                                       "lh", XENMEM_sharing_op,
+                                                       arg);
+            }
+            else
+                mso.u.batch.done = 0;
+        }
+        break;
+
+        case XENMEM_sharing_op_fork:
+        {
+            struct domain *pd;
+
+            rc = -EINVAL;
+            if ( mso.u.fork._pad[0] || mso.u.fork._pad[1] ||
+                 mso.u.fork._pad[2] )
+                goto out;
+
+            rc = rcu_lock_live_remote_domain_by_id(mso.u.fork.parent_domain,
+                                                   &pd);
+            if ( rc )
+                goto out;
+
+            /* Forking shares all of the parent's memory with the fork. */
+            rc = xsm_mem_sharing_op(XSM_DM_PRIV, pd, d,
+                                    XENMEM_sharing_op_share);
+            if ( !rc )
+                rc = mem_sharing_enabled(pd) ? fork(d, pd) : -EINVAL;
+            rcu_unlock_domain(pd);
+
+            if ( rc == -ERESTART )
+                rc = hypercall_create_continuation(__HYPERVISOR_memory_op,
+                                                   "lh", XENMEM_sharing_op,
+                                                   arg);
+        }
+        break;
+
+        case XENMEM_sharing_op_fork_reset:
+            rc = -EINVAL;
+            if ( mso.u.fork._pad[0] || mso.u.fork._pad[1] ||
+                 mso.u.fork._pad[2] || !mem_sharing_is_fork(d) )
+                goto out;
+
+            rc = fork_reset(d, d->parent);
+
+            if ( rc == -ERESTART )
+                rc = hypercall_create_continuation(__HYPERVISOR_memory_op,
+                                                   "lh", XENMEM_sharing_op,
+                                                   arg);
+            break;
+
         case XENMEM_sharing_op_debug_gfn:
             rc = debug_gfn(d, _gfn(mso.u.debug.u.gfn));
             break;
@@ -0,0 +1,375 @@
+/******************************************************************************
+ * arch/x86/mm/p2m-coalesce.c
+ *
+ * Background re-coalescing of superpage mappings in the host p2m.
+ *
+ * Once a superpage entry has been shattered (log-dirty tracking, mem_access,
+ * ballooning, PoD, grant or foreign mappings, ...) nothing ever merges the
+ * resulting smaller entries again, even after the reason for splitting has
+ * gone away, so long lived guests steadily lose superpage coverage.
+ *
+ * A periodic, budgeted scan walks the host p2m of HAP domains and replaces
+ * every naturally aligned range of entries mapping contiguous, equally
+ * aligned frames with identical type and access by a single 2M (and then
+ * 1G) entry.  Ranges backed by discontiguous frames are left alone: moving
+ * guest frames would require them to be free of grant, foreign and DMA
+ * references, which can't be established from here.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <xen/event.h>
+#include <xen/init.h>
+#include <xen/perfc.h>
+#include <xen/rangeset.h>
+#include <xen/sched.h>
+#include <xen/softirq.h>
+#include <xen/tasklet.h>
+#include <xen/timer.h>
+#include <asm/altp2m.h>
+#include <asm/mtrr.h>
+#include <asm/paging.h>
+#include <asm/p2m.h>
+#include <public/domctl.h>
+
+#include "mm-locks.h"
+
+static bool __read_mostly opt_p2m_coalesce;
+boolean_param("p2m-coalesce", opt_p2m_coalesce);
+
+/* Interval between two scan periods. */
+#define COALESCE_PERIOD   SECONDS(1)
+/* Number of p2m lookups a scan period may perform. */
+#define COALESCE_BUDGET   (1u << 16)
+/* Number of p2m lookups between preemption checks when reporting. */
+#define REPORT_BATCH      (1u << 12)
+
+static void coalesce_work(unsigned long unused);
+static DECLARE_TASKLET(coalesce_tasklet, coalesce_work, 0);
+static struct timer coalesce_timer;
+
+/* Scan state, only ever touched by the tasklet. */
+static domid_t coalesce_domid;
+static unsigned int coalesce_lookups;
+
+/*
+ * Check whether the 1 << order gfns starting at gfn are mapped by entries of
+ * at least 1 << min_order pages, all of the same type and access, to a range
+ * of contiguous frames aligned to 1 << order.  Returns the first frame of
+ * that range, or INVALID_MFN.  *pa is set to the common access type.
+ */
+static mfn_t coalesce_check(struct p2m_domain *p2m, unsigned long gfn,
+                            unsigned int order, unsigned int min_order,
+                            p2m_access_t *pa)
+{
+    unsigned long i, nr = 1UL << order;
+    mfn_t base = INVALID_MFN;
+
+    for ( i = 0; i < nr; i += 1UL << min_order )
+    {
+        p2m_type_t t;
+        p2m_access_t a;
+        unsigned int cur_order;
+        bool_t sve = 1;
+        mfn_t mfn;
+
+        mfn = p2m->get_entry(p2m, _gfn(gfn + i), &t, &a, 0, &cur_order, &sve);
+        coalesce_lookups++;
+
+        if ( t != p2m_ram_rw || !sve ||
+             cur_order < min_order || cur_order >= order )
+            return INVALID_MFN;
+
+        if ( !i )
+        {
+            if ( mfn_x(mfn) & (nr - 1) )
+                return INVALID_MFN;
+            base = mfn;
+            *pa = a;
+        }
+        else if ( !mfn_eq(mfn, mfn_add(base, i)) || a != *pa )
+            return INVALID_MFN;
+
+        /* Entries are naturally aligned, so skip the rest of this one. */
+        min_order = max(min_order, cur_order);
+    }
+
+    return base;
+}
+
+/*
+ * Try to replace the entries covering the 1 << order gfns at gfn by a single
+ * superpage entry.  Returns the order of the range the caller may skip: the
+ * order of an existing mapping at gfn if that's already at least as large,
+ * order otherwise.
+ */
+static unsigned int coalesce_range(struct p2m_domain *p2m, unsigned long gfn,
+                                   unsigned int order)
+{
+    struct domain *d = p2m->domain;
+    unsigned int cur_order, ret = order;
+    p2m_type_t t;
+    p2m_access_t a;
+    uint8_t ipat;
+    mfn_t mfn;
+
+    p2m_lock(p2m);
+
+    /*
+     * coalesce_domain() checks these without the lock.  Enabling log-dirty
+     * mode sets the flag before changing the p2m types under the p2m lock,
+     * so checking again here means no superpage can be created behind its
+     * back.
+     */
+    if ( paging_mode_log_dirty(d) || altp2m_active(d) )
+    {
+        ret = PAGE_ORDER_1G;
+        goto out;
+    }
+
+    p2m->get_entry(p2m, _gfn(gfn), &t, &a, 0, &cur_order, NULL);
+    coalesce_lookups++;
+    if ( cur_order >= order )
+    {
+        ret = cur_order;
+        goto out;
+    }
+
+    /*
+     * Ranges tracked for the device model would be split again on the next
+     * log-dirty cycle.
+     */
+    if ( t != p2m_ram_rw ||
+         (p2m->logdirty_ranges &&
+          rangeset_overlaps_range(p2m->logdirty_ranges, gfn,
+                                  gfn + (1UL << order) - 1)) )
+        goto out;
+
+    mfn = coalesce_check(p2m, gfn, order,
+                         order > PAGE_ORDER_2M ? PAGE_ORDER_2M : PAGE_ORDER_4K,
+                         &a);
+    if ( mfn_eq(mfn, INVALID_MFN) )
+        goto out;
+
+    /*
+     * With EPT, a superpage spanning several memory types would be split
+     * again by the misconfiguration handler.
+     */
+    if ( cpu_has_vmx &&
+         epte_get_entry_emt(d, gfn, mfn, order, &ipat, 0) < 0 )
+        goto out;
+
+    if ( p2m_set_entry(p2m, _gfn(gfn), mfn, order, p2m_ram_rw, a) )
+        goto out;
+
+    if ( order == PAGE_ORDER_1G )
+    {
+        p2m->coalesce.coalesced_1g++;
+        perfc_incr(p2m_coalesce_1g);
+    }
+    else
+    {
+        p2m->coalesce.coalesced_2m++;
+        perfc_incr(p2m_coalesce_2m);
+    }
+
+ out:
+    p2m_unlock(p2m);
+
+    return ret;
+}
+
+/*
+ * Scan the host p2m of d from its cursor onwards until either the budget is
+ * used up, preemption is needed, or the end is reached.  Returns true in the
+ * latter case.
+ */
+static bool coalesce_domain(struct domain *d)
+{
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
+
+    if ( d->is_dying || !d->creation_finished ||
+         paging_mode_log_dirty(d) || altp2m_active(d) )
+    {
+        p2m->coalesce.next_gfn = 0;
+        return true;
+    }
+
+    while ( coalesce_lookups < COALESCE_BUDGET )
+    {
+        unsigned long gfn = p2m->coalesce.next_gfn, next;
+        unsigned int order;
+
+        if ( gfn > p2m->max_mapped_pfn )
+        {
+            p2m->coalesce.next_gfn = 0;
+            return true;
+        }
+
+        order = coalesce_range(p2m, gfn, PAGE_ORDER_2M);
+        next = (gfn | ((1UL << order) - 1)) + 1;
+        perfc_incr(p2m_coalesce_scans);
+
+        /* Log-dirty mode or altp2m may have been enabled meanwhile. */
+        if ( paging_mode_log_dirty(d) || altp2m_active(d) )
+        {
+            p2m->coalesce.next_gfn = 0;
+            return true;
+        }
+
+        /* Having finished a 1G range, see whether it can be merged too. */
+        if ( hap_has_1gb && order < PAGE_ORDER_1G &&
+             !(next & ((1UL << PAGE_ORDER_1G) - 1)) )
+            coalesce_range(p2m, next - (1UL << PAGE_ORDER_1G), PAGE_ORDER_1G);
+
+        p2m->coalesce.next_gfn = next;
+
+        if ( softirq_pending(smp_processor_id()) )
+            break;
+    }
+
+    return false;
+}
+
+/* Find the next HAP domain at or after coalesce_domid, and take a ref. */
+static struct domain *coalesce_next_domain(void)
+{
+    struct domain *d;
+
+    rcu_read_lock(&domlist_read_lock);
+
+    for_each_domain ( d )
+        if ( d->domain_id >= coalesce_domid &&
+             is_hvm_domain(d) && hap_enabled(d) && get_domain(d) )
+            break;
+
+    rcu_read_unlock(&domlist_read_lock);
+
+    return d;
+}
+
+static void coalesce_work(unsigned long unused)
+{
+    struct domain *d;
+
+    while ( coalesce_lookups < COALESCE_BUDGET )
+    {
+        if ( softirq_pending(smp_processor_id()) )
+        {
+            tasklet_schedule(&coalesce_tasklet);
+            return;
+        }
+
+        d = coalesce_next_domain();
+        if ( !d )
+        {
+            /* A full pass over all domains is done. */
+            coalesce_domid = 0;
+            break;
+        }
+
+        if ( coalesce_domain(d) )
+            coalesce_domid = d->domain_id + 1;
+
+        put_domain(d);
+    }
+
+    coalesce_lookups = 0;
+    set_timer(&coalesce_timer, NOW() + COALESCE_PERIOD);
+}
+
+static void coalesce_timer_fn(void *unused)
+{
+    tasklet_schedule(&coalesce_tasklet);
+}
+
+static int __init p2m_coalesce_init(void)
+{
+    if ( !opt_p2m_coalesce || !hvm_enabled || !hap_has_2mb )
+        return 0;
+
+    init_timer(&coalesce_timer, coalesce_timer_fn, NULL, 0);
+    set_timer(&coalesce_timer, NOW() + COALESCE_PERIOD);
+
+    return 0;
+}
+__initcall(p2m_coalesce_init);
+
+/*
+ * XEN_DOMCTL_p2m_superpages: count the RAM mappings of d's host p2m by
+ * size.  Returns -ERESTART when preempted, with start_gfn updated.
+ */
+int p2m_get_superpages(struct domain *d, struct xen_domctl_p2m_superpages *sp)
+{
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
+    unsigned long gfn = sp->start_gfn;
+    int rc = 0;
+
+    if ( !paging_mode_translate(d) )
+        return -EINVAL;
+
+    sp->shattered = p2m->coalesce.shattered;
+    sp->coalesced_2m = p2m->coalesce.coalesced_2m;
+    sp->coalesced_1g = p2m->coalesce.coalesced_1g;
+
+    while ( gfn <= p2m->max_mapped_pfn )
+    {
+        unsigned int n;
+
+        p2m_read_lock(p2m);
+
+        for ( n = 0; n < REPORT_BATCH && gfn <= p2m->max_mapped_pfn; n++ )
+        {
+            p2m_type_t t;
+            p2m_access_t a;
+            unsigned int order;
+            mfn_t mfn;
+
+            mfn = p2m->get_entry(p2m, _gfn(gfn), &t, &a, 0, &order, NULL);
+
+            if ( p2m_is_ram(t) && mfn_valid(mfn) )
+            {
+                if ( order >= PAGE_ORDER_1G )
+                    sp->nr_1g++;
+                else if ( order >= PAGE_ORDER_2M )
+                    sp->nr_2m++;
+                else
+                    sp->nr_4k++;
+            }
+
+            gfn = (gfn | ((1UL << order) - 1)) + 1;
+        }
+
+        p2m_read_unlock(p2m);
+
+        if ( gfn <= p2m->max_mapped_pfn && hypercall_preempt_check() )
+        {
+            rc = -ERESTART;
+            break;
+        }
+    }
+
+    sp->start_gfn = gfn;
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -256,6 +256,8 @@ static bool_t ept_split_super_page(struct p2m_domain *p2m,
     if ( !ept_set_middle_entry(p2m, &new_ept) )
         return 0;
 
+    p2m->coalesce.shattered++;
+
     table = map_domain_page(_mfn(new_ept.mfn));
     trunk = 1UL << ((level - 1) * EPT_TABLE_ORDER);
 
@@ -1168,6 +1170,80 @@ static void ept_set_ad_sync(struct domain *d, bool value)
     }
 }
 
+/*
+ * Report and clear the accessed bits of the leaf entries mapping the nr gfns
+ * from gfn.  All gfns covered by a superpage entry share its bit.
+ */
+static unsigned int ept_harvest_accessed(struct p2m_domain *p2m,
+                                         unsigned long gfn, unsigned int nr,
+                                         unsigned long *bits)
+{
+    unsigned int done = 0, accessed = 0, i;
+    bool cleared = false;
+
+    ASSERT(p2m_locked_by_me(p2m));
+
+    while ( done < nr && gfn + done <= p2m->max_mapped_pfn )
+    {
+        ept_entry_t *table =
+            map_domain_page(pagetable_get_mfn(p2m_get_pagetable(p2m)));
+        unsigned long gfn_remainder = gfn + done, mask;
+        unsigned int level, n;
+        int ret = GUEST_TABLE_NORMAL_PAGE;
+
+        for ( level = p2m->ept.wl; level > 0; level-- )
+        {
+            ret = ept_next_level(p2m, 1, &table, &gfn_remainder, level);
+            if ( ret != GUEST_TABLE_NORMAL_PAGE )
+                break;
+        }
+
+        /* The entry found covers this many gfns from gfn + done onwards. */
+        mask = (1UL << (level * EPT_TABLE_ORDER)) - 1;
+        n = min_t(unsigned long, nr - done,
+                  mask + 1 - (gfn_remainder & mask));
+
+        if ( ret == GUEST_TABLE_NORMAL_PAGE || ret == GUEST_TABLE_SUPER_PAGE )
+        {
+            ept_entry_t *e = table +
+                             (gfn_remainder >> (level * EPT_TABLE_ORDER));
+
+            if ( is_epte_present(e) &&
+                 test_and_clear_bit(EPTE_A_SHIFT, &e->epte) )
+            {
+                for ( i = 0; i < n; i++ )
+                    __set_bit(done + i, bits);
+                accessed += n;
+                cleared = true;
+            }
+        }
+
+        unmap_domain_page(table);
+        done += n;
+    }
+
+    /* Cached translations wouldn't set the bits again. */
+    if ( cleared )
+        ept_sync_domain(p2m);
+
+    return accessed;
+}
+
+static void ept_set_access_tracking(struct p2m_domain *p2m, bool enable)
+{
+    /* Domain must have been paused */
+    ASSERT(atomic_read(&p2m->domain->pause_count));
+
+    p2m->access_tracking = enable;
+
+    /* PML needs the A/D bits, ept_disable_pml() turns them off later. */
+    if ( !enable && vmx_domain_pml_enabled(p2m->domain) )
+        return;
+
+    ept_set_ad_sync(p2m->domain, enable);
+    vmx_domain_update_eptp(p2m->domain);
+}
+
 static void ept_enable_pml(struct p2m_domain *p2m)
 {
     /* Domain must have been paused */
@@ -1193,8 +1269,8 @@ static void ept_disable_pml(struct p2m_domain *p2m)
 
     vmx_domain_disable_pml(p2m->domain);
 
-    /* Disable EPT A/D bit */
-    ept_set_ad_sync(p2m->domain, false);
+    /* Disable EPT A/D bit, unless accessed bits are being sampled */
+    ept_set_ad_sync(p2m->domain, p2m->access_tracking);
     vmx_domain_update_eptp(p2m->domain);
 }
 
@@ -1250,6 +1326,12 @@ int ept_p2m_init(struct p2m_domain *p2m)
         p2m->flush_hardware_cached_dirty = ept_flush_pml_buffers;
     }
 
+    if ( cpu_has_vmx_ept_ad )
+    {
+        p2m->set_access_tracking = ept_set_access_tracking;
+        p2m->harvest_accessed = ept_harvest_accessed;
+    }
+
     if ( !zalloc_cpumask_var(&ept->invalidate) )
         return -ENOMEM;
 
@@ -1364,6 +1446,8 @@ void p2m_init_altp2m_ept(struct domain *d, unsigned int i)
     p2m->ept.ad = hostp2m->ept.ad;
     p2m->min_remapped_gfn = gfn_x(INVALID_GFN);
     p2m->max_mapped_pfn = p2m->max_remapped_gfn = 0;
+    p2m->min_stale_gfn = gfn_x(INVALID_GFN);
+    p2m->max_stale_gfn = 0;
     ept = &p2m->ept;
     ept->mfn = pagetable_get_pfn(p2m_get_pagetable(p2m));
     d->arch.altp2m_eptp[i] = ept->eptp;
@@ -21,7 +21,9 @@
 
 #include <xen/event.h>
 #include <xen/mm.h>
+#include <xen/perfc.h>
 #include <xen/sched.h>
+#include <xen/softirq.h>
 #include <xen/trace.h>
 #include <asm/page.h>
 #include <asm/paging.h>
@@ -376,9 +378,13 @@ int p2m_pod_empty_cache(struct domain *d)
     struct page_info *page;
     unsigned int i;
 
-    /* After this barrier no new PoD activities can happen. */
+    /*
+     * After this barrier no new PoD activities can happen.  Only then kill
+     * the sweep tasklet, as a populate still in progress may queue it.
+     */
     BUG_ON(!d->is_dying);
     spin_barrier(&p2m->pod.lock.lock);
+    tasklet_kill(&p2m->pod.sweep_tasklet);
 
     lock_page_alloc(p2m);
 
@@ -680,6 +686,31 @@ void p2m_pod_dump_data(struct domain *d)
 
     printk("    PoD entries=%ld cachesize=%ld\n",
            p2m->pod.entry_count, p2m->pod.count);
+    if ( p2m->pod.stats.stalls )
+        printk("    PoD stalls=%lu avg=%"PRI_stime"ns max=%"PRI_stime"ns\n",
+               p2m->pod.stats.stalls,
+               p2m->pod.stats.stall_total / p2m->pod.stats.stalls,
+               p2m->pod.stats.stall_max);
+    if ( p2m->pod.stats.bg_sweeps )
+        printk("    PoD background sweeps=%lu reclaimed=%lu\n",
+               p2m->pod.stats.bg_sweeps, p2m->pod.stats.bg_reclaimed);
+}
+
+/*
+ * Check whether a page is all zeroes.  OR-ing a cache line's worth of words
+ * per iteration keeps the loop to one branch per line, rather than one per
+ * word.  (Xen doesn't use vector registers for itself.)
+ */
+static bool pod_page_is_zero(const unsigned long *map)
+{
+    unsigned int i;
+
+    for ( i = 0; i < PAGE_SIZE / sizeof(*map); i += 8 )
+        if ( map[i] | map[i + 1] | map[i + 2] | map[i + 3] |
+             map[i + 4] | map[i + 5] | map[i + 6] | map[i + 7] )
+            return false;
+
+    return true;
 }
 
 
@@ -806,12 +837,8 @@ p2m_pod_zero_check_superpage(struct p2m_domain *p2m, gfn_t gfn)
     {
         map = map_domain_page(mfn_add(mfn0, i));
 
-        for ( j = 0; j < (PAGE_SIZE / sizeof(*map)); j++ )
-            if ( *(map+j) != 0 )
-            {
-                reset = 1;
-                break;
-            }
+        if ( !pod_page_is_zero(map) )
+            reset = 1;
 
         unmap_domain_page(map);
 
@@ -840,6 +867,7 @@ p2m_pod_zero_check_superpage(struct p2m_domain *p2m, gfn_t gfn)
      */
     p2m_pod_cache_add(p2m, mfn_to_page(mfn0), PAGE_ORDER_2M);
     p2m->pod.entry_count += SUPERPAGE_PAGES;
+    perfc_add(pod_zero_reclaim, SUPERPAGE_PAGES);
 
     ret = SUPERPAGE_PAGES;
 
@@ -951,12 +979,12 @@ p2m_pod_zero_check(struct p2m_domain *p2m, const gfn_t *gfns, unsigned int count
     /* Now check each page for real */
     for ( i = 0; i < count; i++ )
     {
+        bool zero;
+
         if ( !map[i] )
             continue;
 
-        for ( j = 0; j < (PAGE_SIZE / sizeof(*map[i])); j++ )
-            if ( *(map[i] + j) != 0 )
-                break;
+        zero = pod_page_is_zero(map[i]);
 
         unmap_domain_page(map[i]);
 
@@ -966,7 +994,7 @@ p2m_pod_zero_check(struct p2m_domain *p2m, const gfn_t *gfns, unsigned int count
          * See comment in p2m_pod_zero_check_superpage() re gnttab
          * check timing.
          */
-        if ( j < (PAGE_SIZE / sizeof(*map[i])) )
+        if ( !zero )
         {
             /*
              * If the previous p2m_set_entry call succeeded, this one shouldn't
@@ -1000,6 +1028,7 @@ p2m_pod_zero_check(struct p2m_domain *p2m, const gfn_t *gfns, unsigned int count
             /* Add to cache, and account for the new p2m PoD entry */
             p2m_pod_cache_add(p2m, mfn_to_page(mfns[i]), PAGE_ORDER_4K);
             p2m->pod.entry_count++;
+            perfc_incr(pod_zero_reclaim);
         }
     }
 
@@ -1015,8 +1044,14 @@ out_unmap:
             unmap_domain_page(map[i]);
 }
 
+/*
+ * Sweep backwards from reclaim_single for zero pages to reclaim.  Having
+ * scanned at least POD_SWEEP_LIMIT gfns, stop once the cache holds target
+ * pages or preemption is due.  A background sweep always stops there, so
+ * that its caller can drop the locks before going on.
+ */
 static void
-p2m_pod_emergency_sweep(struct p2m_domain *p2m)
+p2m_pod_sweep(struct p2m_domain *p2m, long target, bool background)
 {
     gfn_t gfns[POD_SWEEP_STRIDE];
     unsigned long i, j = 0, start, limit;
@@ -1052,13 +1087,15 @@ p2m_pod_emergency_sweep(struct p2m_domain *p2m)
             }
         }
         /*
-         * Stop if we're past our limit and we have found *something*.
+         * Stop if we're past our limit and we have found enough.
          *
          * NB that this is a zero-sum game; we're increasing our cache size
          * by re-increasing our 'debt'.  Since we hold the pod lock,
          * (entry_count - count) must remain the same.
          */
-        if ( i < limit && (p2m->pod.count > 0 || hypercall_preempt_check()) )
+        if ( i < limit &&
+             (background || p2m->pod.count >= target ||
+              hypercall_preempt_check()) )
             break;
     }
 
@@ -1070,6 +1107,111 @@ p2m_pod_emergency_sweep(struct p2m_domain *p2m)
 
 }
 
+static void
+p2m_pod_emergency_sweep(struct p2m_domain *p2m)
+{
+    perfc_incr(pod_sweep_emergency);
+    p2m_pod_sweep(p2m, 1, false);
+}
+
+/*
+ * Once the cache runs low, a tasklet sweeps for zero pages in the
+ * background, so that guest faults don't have to.  It preferably runs on
+ * an idle CPU.
+ */
+#define POD_CACHE_LOW    2048
+#define POD_CACHE_HIGH   8192
+/* Maximum number of sweeps, of POD_SWEEP_LIMIT gfns each, per tasklet run. */
+#define POD_SWEEP_ROUNDS 4
+
+static void pod_sweep_work(unsigned long data)
+{
+    struct p2m_domain *p2m = (void *)data;
+    long reclaimed = 0;
+    unsigned int i;
+    bool again = false;
+
+    /*
+     * Drop the locks between sweeps: holding the p2m lock across all of them
+     * would stall every other p2m user of the domain.
+     */
+    for ( i = 0; ; i++ )
+    {
+        long before;
+
+        p2m_lock(p2m);
+        pod_lock(p2m);
+
+        /* Check under the lock: teardown of the p2m takes it as well. */
+        if ( p2m->domain->is_dying || p2m->pod.count >= POD_CACHE_HIGH ||
+             p2m->pod.entry_count <= p2m->pod.count )
+            break;
+
+        /*
+         * Out of budget: come back later, but only if this run got
+         * anywhere, so as not to keep a CPU busy sweeping a guest without
+         * zero pages.  The next low cache condition kicks off a new run.
+         */
+        if ( i == POD_SWEEP_ROUNDS || softirq_pending(smp_processor_id()) )
+        {
+            again = reclaimed > 0;
+            break;
+        }
+
+        before = p2m->pod.count;
+        perfc_incr(pod_sweep_background);
+        p2m_pod_sweep(p2m, POD_CACHE_HIGH, true);
+        if ( p2m->pod.count > before )
+            reclaimed += p2m->pod.count - before;
+
+        pod_unlock(p2m);
+        p2m_unlock(p2m);
+    }
+
+    p2m->pod.stats.bg_sweeps++;
+    p2m->pod.stats.bg_reclaimed += reclaimed;
+
+    if ( again )
+        tasklet_schedule(&p2m->pod.sweep_tasklet);
+    else
+        p2m->pod.sweep_pending = false;
+
+    pod_unlock(p2m);
+    p2m_unlock(p2m);
+}
+
+static void pod_sweep_kick(struct p2m_domain *p2m)
+{
+    unsigned int cpu, self = smp_processor_id();
+
+    ASSERT(pod_locked_by_me(p2m));
+
+    if ( p2m->pod.sweep_pending || !p2m_is_hostp2m(p2m) ||
+         p2m->pod.count >= POD_CACHE_LOW ||
+         p2m->pod.entry_count <= p2m->pod.count )
+        return;
+
+    p2m->pod.sweep_pending = true;
+
+    /* Racy, but only meant to keep out of the way of guests. */
+    for ( cpu = cpumask_cycle(self, &cpu_online_map); cpu != self;
+          cpu = cpumask_cycle(cpu, &cpu_online_map) )
+        if ( is_idle_vcpu(get_cpu_current(cpu)) )
+            break;
+
+    tasklet_schedule_on_cpu(&p2m->pod.sweep_tasklet, cpu);
+}
+
+static void pod_account_stall(struct p2m_domain *p2m, s_time_t start)
+{
+    s_time_t stall = NOW() - start;
+
+    p2m->pod.stats.stalls++;
+    p2m->pod.stats.stall_total += stall;
+    if ( stall > p2m->pod.stats.stall_max )
+        p2m->pod.stats.stall_max = stall;
+}
+
 static void pod_eager_reclaim(struct p2m_domain *p2m)
 {
     struct pod_mrp_list *mrp = &p2m->pod.mrp;
@@ -1130,6 +1272,7 @@ p2m_pod_demand_populate(struct p2m_domain *p2m, gfn_t gfn,
     gfn_t gfn_aligned = _gfn((gfn_x(gfn) >> order) << order);
     mfn_t mfn;
     unsigned long i;
+    s_time_t start = 0;
 
     ASSERT(gfn_locked_by_me(p2m, gfn));
     pod_lock(p2m);
@@ -1165,14 +1308,24 @@ p2m_pod_demand_populate(struct p2m_domain *p2m, gfn_t gfn,
 
     /* Only reclaim if we're in actual need of more cache. */
     if ( p2m->pod.entry_count > p2m->pod.count )
+    {
+        start = NOW();
         pod_eager_reclaim(p2m);
+    }
 
     /*
      * Only sweep if we're actually out of memory.  Doing anything else
      * causes unnecessary time and fragmentation of superpages in the p2m.
      */
     if ( p2m->pod.count == 0 )
+    {
+        if ( !start )
+            start = NOW();
         p2m_pod_emergency_sweep(p2m);
+    }
+
+    if ( start )
+        pod_account_stall(p2m, start);
 
     /* If the sweep failed, give up. */
     if ( p2m->pod.count == 0 )
@@ -1209,6 +1362,7 @@ p2m_pod_demand_populate(struct p2m_domain *p2m, gfn_t gfn,
     BUG_ON(p2m->pod.entry_count < 0);
 
     pod_eager_record(p2m, gfn_aligned, order);
+    pod_sweep_kick(p2m);
 
     if ( tb_init_done )
     {
@@ -1331,8 +1485,10 @@ void p2m_pod_init(struct p2m_domain *p2m)
     unsigned int i;
 
     mm_lock_init(&p2m->pod.lock);
+    spin_lock_set_class(&p2m->pod.lock.lock, LOCK_CLASS_P2M);
     INIT_PAGE_LIST_HEAD(&p2m->pod.super);
     INIT_PAGE_LIST_HEAD(&p2m->pod.single);
+    tasklet_init(&p2m->pod.sweep_tasklet, pod_sweep_work, (unsigned long)p2m);
 
     for ( i = 0; i < ARRAY_SIZE(p2m->pod.mrp.list); ++i )
         p2m->pod.mrp.list[i] = gfn_x(INVALID_GFN);
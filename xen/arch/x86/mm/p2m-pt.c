@@ -241,6 +241,8 @@ p2m_next_level(struct p2m_domain *p2m, void **table,
                                   level + 1);
         if ( rc )
             goto error;
+
+        p2m->coalesce.shattered++;
     }
     else
         ASSERT(flags & _PAGE_PRESENT);
@@ -27,6 +27,7 @@
 #include <xen/iommu.h>
 #include <xen/vm_event.h>
 #include <xen/event.h>
+#include <xen/perfc.h>
 #include <public/vm_event.h>
 #include <asm/domain.h>
 #include <asm/page.h>
@@ -87,6 +88,7 @@ static int p2m_initialise(struct domain *d, struct p2m_domain *p2m)
     int ret = 0;
 
     mm_rwlock_init(&p2m->lock);
+    percpu_rwlock_set_class(&p2m->lock.lock, LOCK_CLASS_P2M);
     INIT_PAGE_LIST_HEAD(&p2m->pages);
 
     p2m->domain = d;
@@ -285,6 +287,10 @@ int p2m_is_logdirty_range(struct p2m_domain *p2m, unsigned long start,
     return 0;
 }
 
+#ifdef CONFIG_HVM
+static int altp2m_reset_stale(struct p2m_domain *ap2m);
+#endif
+
 static void change_entry_type_global(struct p2m_domain *p2m,
                                      p2m_type_t ot, p2m_type_t nt)
 {
@@ -321,6 +327,9 @@ void p2m_change_entry_type_global(struct domain *d,
 
                 p2m_lock(altp2m);
                 change_entry_type_global(altp2m, ot, nt);
+                /* Deferred changes are superseded by the global one. */
+                if ( ot != nt && altp2m_reset_stale(altp2m) )
+                    ASSERT_UNREACHABLE();
                 p2m_unlock(altp2m);
             }
     }
@@ -483,6 +492,37 @@ void p2m_unlock_and_tlb_flush(struct p2m_domain *p2m)
         mm_write_unlock(&p2m->lock);
 }
 
+void p2m_batch_begin(struct domain *d)
+{
+    if ( !paging_mode_translate(d) )
+        return;
+
+    /* p2m_set_entry() defers TLB flushes until the outermost unlock. */
+    p2m_lock(p2m_get_hostp2m(d));
+
+    if ( need_iommu_pt_sync(d) )
+    {
+        ASSERT(!this_cpu(iommu_dont_flush_iotlb));
+        this_cpu(iommu_dont_flush_iotlb) = 1;
+    }
+}
+
+int p2m_batch_end(struct domain *d)
+{
+    if ( !paging_mode_translate(d) )
+        return 0;
+
+    p2m_unlock(p2m_get_hostp2m(d));
+
+    if ( !this_cpu(iommu_dont_flush_iotlb) )
+        return 0;
+
+    this_cpu(iommu_dont_flush_iotlb) = 0;
+
+    return iommu_iotlb_flush_all(d, IOMMU_FLUSHF_added |
+                                    IOMMU_FLUSHF_modified);
+}
+
 mfn_t __get_gfn_type_access(struct p2m_domain *p2m, unsigned long gfn_l,
                     p2m_type_t *t, p2m_access_t *a, p2m_query_t q,
                     unsigned int *page_order, bool_t locked)
@@ -508,6 +548,12 @@ mfn_t __get_gfn_type_access(struct p2m_domain *p2m, unsigned long gfn_l,
 
     mfn = p2m->get_entry(p2m, gfn, t, a, q, page_order, NULL);
 
+    /* Lazily populate VM forks from their parent. */
+    if ( (q & P2M_ALLOC) && p2m_is_hole(*t) && locked &&
+         p2m_is_hostp2m(p2m) && mem_sharing_is_fork(p2m->domain) &&
+         !mem_sharing_fork_page(p2m->domain, gfn, q & P2M_UNSHARE) )
+        mfn = p2m->get_entry(p2m, gfn, t, a, q, page_order, NULL);
+
     if ( (q & P2M_UNSHARE) && p2m_is_shared(*t) )
     {
         ASSERT(p2m_is_hostp2m(p2m));
@@ -582,8 +628,9 @@ struct page_info *p2m_get_page_from_gfn(
         if ( page )
             return page;
 
-        /* Error path: not a suitable GFN at all */
-        if ( !p2m_is_ram(*t) && !p2m_is_paging(*t) && !p2m_is_pod(*t) )
+        /* Error path: not a suitable GFN at all (forks populate holes) */
+        if ( !p2m_is_ram(*t) && !p2m_is_paging(*t) && !p2m_is_pod(*t) &&
+             !mem_sharing_is_fork(p2m->domain) )
             return NULL;
     }
 
@@ -863,7 +910,8 @@ guest_physmap_add_entry(struct domain *d, gfn_t gfn, mfn_t mfn,
                         unsigned int page_order, p2m_type_t t)
 {
     struct p2m_domain *p2m = p2m_get_hostp2m(d);
-    unsigned long i;
+    unsigned long i, n;
+    unsigned int cur_order;
     gfn_t ogfn;
     p2m_type_t ot;
     p2m_access_t a;
@@ -885,11 +933,23 @@ guest_physmap_add_entry(struct domain *d, gfn_t gfn, mfn_t mfn,
 
     P2M_DEBUG("adding gfn=%#lx mfn=%#lx\n", gfn_x(gfn), mfn_x(mfn));
 
-    /* First, remove m->p mappings for existing p->m mappings */
-    for ( i = 0; i < (1UL << page_order); i++ )
+    /*
+     * First, remove m->p mappings for existing p->m mappings.  Entries
+     * without any (holes, PoD, emulated MMIO) are skipped as a whole.
+     */
+    for ( i = 0; i < (1UL << page_order); i += n )
     {
         omfn = p2m->get_entry(p2m, gfn_add(gfn, i), &ot,
-                              &a, 0, NULL, NULL);
+                              &a, 0, &cur_order, NULL);
+        n = (1UL << cur_order) -
+            ((gfn_x(gfn) + i) & ((1UL << cur_order) - 1));
+        n = min(n, (1UL << page_order) - i);
+        if ( !p2m_is_ram(ot) && !p2m_is_grant(ot) && !p2m_is_foreign(ot) &&
+             ot != p2m_populate_on_demand )
+            continue;
+        if ( ot != p2m_populate_on_demand )
+            n = 1;
+
         if ( p2m_is_shared(ot) )
         {
             /* Do an unshare to cleanly take care of all corner 
@@ -935,7 +995,7 @@ guest_physmap_add_entry(struct domain *d, gfn_t gfn, mfn_t mfn,
         else if ( ot == p2m_populate_on_demand )
         {
             /* Count how man PoD entries we'll be replacing if successful */
-            pod_count++;
+            pod_count += n;
         }
         else if ( p2m_is_paging(ot) && (ot != p2m_ram_paging_out) )
         {
@@ -1900,6 +1960,76 @@ void p2m_mem_paging_resume(struct domain *d, vm_event_response_t *rsp)
 }
 
 #ifdef CONFIG_HVM
+/* Number of gfns harvested per p2m lock hold. */
+#define ACCESS_BITS_BATCH (1u << 12)
+
+/*
+ * XEN_DOMCTL_p2m_access_bits: sample the accessed bits of d's host p2m.
+ * Harvesting returns -ERESTART when preempted, with done updated.
+ */
+int p2m_access_bits(struct domain *d, struct xen_domctl_p2m_access_bits *ab)
+{
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
+    unsigned long bits[BITS_TO_LONGS(ACCESS_BITS_BATCH)];
+
+    if ( !is_hvm_domain(d) || ab->_pad )
+        return -EINVAL;
+
+    /* Alternate views have accessed bits of their own. */
+    if ( !p2m->harvest_accessed || altp2m_active(d) )
+        return -EOPNOTSUPP;
+
+    switch ( ab->op )
+    {
+    case XEN_DOMCTL_P2M_ACCESS_BITS_ENABLE:
+    case XEN_DOMCTL_P2M_ACCESS_BITS_DISABLE:
+        if ( d == current->domain )
+            return -EINVAL;
+
+        domain_pause(d);
+        p2m_lock(p2m);
+        p2m->set_access_tracking(p2m,
+                                 ab->op == XEN_DOMCTL_P2M_ACCESS_BITS_ENABLE);
+        p2m_unlock(p2m);
+        domain_unpause(d);
+
+        return 0;
+
+    case XEN_DOMCTL_P2M_ACCESS_BITS_HARVEST:
+        if ( !p2m->access_tracking ||
+             ab->start_gfn + ab->nr < ab->start_gfn || ab->done > ab->nr ||
+             ((ab->done & 7) && ab->done != ab->nr) )
+            return -EINVAL;
+
+        while ( ab->done < ab->nr )
+        {
+            unsigned int n = min_t(uint64_t, ab->nr - ab->done,
+                                   ACCESS_BITS_BATCH);
+
+            memset(bits, 0, DIV_ROUND_UP(n, 8));
+
+            p2m_lock(p2m);
+            ab->accessed += p2m->harvest_accessed(p2m,
+                                                  ab->start_gfn + ab->done,
+                                                  n, bits);
+            p2m_unlock(p2m);
+
+            if ( copy_to_guest_offset(ab->bitmap, ab->done / 8,
+                                      (uint8_t *)bits, DIV_ROUND_UP(n, 8)) )
+                return -EFAULT;
+
+            ab->done += n;
+
+            if ( ab->done < ab->nr && hypercall_preempt_check() )
+                return -ERESTART;
+        }
+
+        return 0;
+    }
+
+    return -EOPNOTSUPP;
+}
+
 static struct p2m_domain *
 p2m_getlru_nestedp2m(struct domain *d, struct p2m_domain *p2m)
 {
@@ -2417,6 +2547,143 @@ bool_t p2m_switch_vcpu_altp2m_by_id(struct vcpu *v, unsigned int idx)
     return rc;
 }
 
+/*
+ * Propagating a host p2m change into every altp2m view is expensive with
+ * many views, yet for changes which merely relax a view's entry (e.g. a
+ * log-dirty page becoming writable again) a view lagging behind causes
+ * nothing worse than a fault.  Such changes are therefore only recorded as
+ * stale in each view, and applied when an access through the view faults.
+ */
+static bool __read_mostly opt_altp2m_lazy = true;
+boolean_param("altp2m-lazy-propagate", opt_altp2m_lazy);
+
+/* Bound on the number of stale ranges, and hence lookup cost, per view. */
+#define ALTP2M_STALE_RANGES 64
+
+/* Removing all ranges never needs to split one, so this can't fail. */
+static int altp2m_reset_stale(struct p2m_domain *ap2m)
+{
+    ap2m->min_stale_gfn = gfn_x(INVALID_GFN);
+    ap2m->max_stale_gfn = 0;
+
+    return ap2m->stale_ranges
+           ? rangeset_remove_range(ap2m->stale_ranges, 0, ~0UL) : 0;
+}
+
+static int altp2m_init_stale(struct p2m_domain *ap2m)
+{
+    int rc = altp2m_reset_stale(ap2m);
+
+    if ( rc || ap2m->stale_ranges )
+        return rc;
+
+    ap2m->stale_ranges = rangeset_new(ap2m->domain, "altp2m-stale",
+                                      RANGESETF_prettyprint_hex);
+    if ( !ap2m->stale_ranges )
+        return -ENOMEM;
+
+    rangeset_limit(ap2m->stale_ranges, ALTP2M_STALE_RANGES);
+
+    return 0;
+}
+
+static void altp2m_free_stale(struct p2m_domain *ap2m)
+{
+    rangeset_destroy(ap2m->stale_ranges);
+    ap2m->stale_ranges = NULL;
+    ap2m->min_stale_gfn = gfn_x(INVALID_GFN);
+    ap2m->max_stale_gfn = 0;
+}
+
+static bool altp2m_is_stale(const struct p2m_domain *ap2m, unsigned long gfn)
+{
+    return gfn >= ap2m->min_stale_gfn && gfn <= ap2m->max_stale_gfn &&
+           rangeset_contains_singleton(ap2m->stale_ranges, gfn);
+}
+
+/*
+ * Record the 1 << order gfns at gfn as lagging behind the host p2m.  Fails
+ * when the view tracks too many ranges already, in which case the change has
+ * to be propagated right away.
+ */
+static int altp2m_mark_stale(struct p2m_domain *ap2m, unsigned long gfn,
+                             unsigned int order)
+{
+    unsigned long last = gfn + (1UL << order) - 1;
+    int rc;
+
+    if ( !ap2m->stale_ranges )
+        return -ENOMEM;
+
+    rc = rangeset_add_range(ap2m->stale_ranges, gfn, last);
+    if ( rc )
+        return rc;
+
+    if ( gfn < ap2m->min_stale_gfn )
+        ap2m->min_stale_gfn = gfn;
+    if ( last > ap2m->max_stale_gfn )
+        ap2m->max_stale_gfn = last;
+
+    return 0;
+}
+
+static void altp2m_clear_stale(struct p2m_domain *ap2m, unsigned long gfn,
+                               unsigned int order)
+{
+    unsigned long last = gfn + (1UL << order) - 1;
+
+    if ( gfn > ap2m->max_stale_gfn || last < ap2m->min_stale_gfn )
+        return;
+
+    /*
+     * Splitting a range may fail for lack of space.  Stale marks are only
+     * hints though: a left over one merely costs a lookup on a fault.
+     */
+    if ( rangeset_remove_range(ap2m->stale_ranges, gfn, last) )
+        return;
+
+    if ( rangeset_is_empty(ap2m->stale_ranges) )
+    {
+        ap2m->min_stale_gfn = gfn_x(INVALID_GFN);
+        ap2m->max_stale_gfn = 0;
+    }
+}
+
+/*
+ * Bring a stale altp2m entry in line with the host's, keeping the view's
+ * access permissions.  Entries remapped since the change was deferred are
+ * left alone.  Returns true if the entry was updated.
+ */
+static bool altp2m_fixup_stale(struct p2m_domain *ap2m, unsigned long gfn_l,
+                               mfn_t amfn, p2m_type_t ap2mt,
+                               p2m_access_t ap2ma, unsigned int aorder,
+                               mfn_t mfn, p2m_type_t p2mt,
+                               unsigned int page_order)
+{
+    unsigned int order = min(aorder, page_order);
+    unsigned long mask = ~((1UL << order) - 1);
+    int rc;
+
+    altp2m_clear_stale(ap2m, gfn_l & mask, order);
+
+    if ( !mfn_eq(amfn, mfn) || ap2mt == p2mt )
+        return false;
+
+    rc = p2m_set_entry(ap2m, _gfn(gfn_l & mask), _mfn(mfn_x(mfn) & mask),
+                       order, p2mt, ap2ma);
+    if ( rc )
+    {
+        gprintk(XENLOG_ERR,
+                "failed to fix up %"PRI_gfn" -> %"PRI_mfn" altp2m %u, rc %d\n",
+                gfn_l, mfn_x(mfn), vcpu_altp2m(current).p2midx, rc);
+        domain_crash(ap2m->domain);
+    }
+
+    perfc_incr(altp2m_stale_fixup);
+
+    return true;
+}
+
 /*
  * Read info about the gfn in an altp2m, locking the gfn.
  *
@@ -2435,6 +2702,7 @@ bool p2m_altp2m_get_or_propagate(struct p2m_domain *ap2m, unsigned long gfn_l,
 {
     p2m_type_t ap2mt;
     p2m_access_t ap2ma;
+    unsigned int aorder;
     unsigned long mask;
     gfn_t gfn;
     mfn_t amfn;
@@ -2447,10 +2715,19 @@ bool p2m_altp2m_get_or_propagate(struct p2m_domain *ap2m, unsigned long gfn_l,
      */
     p2m_lock(ap2m);
 
-    amfn = get_gfn_type_access(ap2m, gfn_l, &ap2mt, &ap2ma, 0, NULL);
+    amfn = get_gfn_type_access(ap2m, gfn_l, &ap2mt, &ap2ma, 0, &aorder);
 
     if ( !mfn_eq(amfn, INVALID_MFN) )
     {
+        /* A change to the host entry may not have been propagated yet. */
+        if ( altp2m_is_stale(ap2m, gfn_l) &&
+             altp2m_fixup_stale(ap2m, gfn_l, amfn, ap2mt, ap2ma, aorder,
+                                *mfn, *p2mt, page_order) )
+        {
+            p2m_unlock(ap2m);
+            return true;
+        }
+
         p2m_unlock(ap2m);
         *mfn  = amfn;
         *p2mt = ap2mt;
@@ -2506,7 +2783,12 @@ static void p2m_reset_altp2m(struct domain *d, unsigned int idx,
     p2m_flush_table_locked(p2m);
 
     if ( reset_type == ALTP2M_DEACTIVATE )
+    {
         p2m_free_logdirty(p2m);
+        altp2m_free_stale(p2m);
+    }
+    else
+        altp2m_init_stale(p2m);
 
     /* Uninit and reinit ept to force TLB shootdown */
     ept_p2m_uninit(p2m);
@@ -2553,9 +2835,13 @@ static int p2m_activate_altp2m(struct domain *d, unsigned int idx)
     /* The following is really just a rangeset copy. */
     rc = rangeset_merge(p2m->logdirty_ranges, hostp2m->logdirty_ranges);
 
+    if ( !rc )
+        rc = altp2m_init_stale(p2m);
+
     if ( rc )
     {
         p2m_free_logdirty(p2m);
+        altp2m_free_stale(p2m);
         goto out;
     }
 
@@ -2739,9 +3025,16 @@ int p2m_altp2m_propagate_change(struct domain *d, gfn_t gfn,
     p2m_access_t a;
     p2m_type_t t;
     mfn_t m;
-    unsigned int i;
+    unsigned int i, cur_order;
     unsigned int reset_count = 0;
     unsigned int last_reset_idx = ~0;
+    /*
+     * A vCPU of the domain making the change itself (e.g. writing to a
+     * log-dirty page) would fault on its own view straight away if the
+     * change was deferred there.
+     */
+    unsigned int cur_idx = current->domain == d ? vcpu_altp2m(current).p2midx
+                                                : INVALID_ALTP2M;
     int ret = 0;
 
     if ( !altp2m_active(d) )
@@ -2755,7 +3048,7 @@ int p2m_altp2m_propagate_change(struct domain *d, gfn_t gfn,
             continue;
 
         p2m = d->arch.altp2m_p2m[i];
-        m = get_gfn_type_access(p2m, gfn_x(gfn), &t, &a, 0, NULL);
+        m = get_gfn_type_access(p2m, gfn_x(gfn), &t, &a, 0, &cur_order);
 
         /* Check for a dropped page that may impact this altp2m */
         if ( mfn_eq(mfn, INVALID_MFN) &&
@@ -2785,10 +3078,34 @@ int p2m_altp2m_propagate_change(struct domain *d, gfn_t gfn,
                 break;
             }
         }
-        else if ( !mfn_eq(m, INVALID_MFN) )
+        else if ( mfn_eq(m, INVALID_MFN) ||
+                  (mfn_eq(m, mfn) && t == p2mt && a == p2ma &&
+                   cur_order >= page_order) )
+        {
+            /* Not mapped in this view, or already up to date. */
+            altp2m_clear_stale(p2m, gfn_x(gfn), page_order);
+            perfc_incr(altp2m_propagate_skipped);
+        }
+        else if ( opt_altp2m_lazy && i != cur_idx &&
+                  mfn_eq(m, mfn) && a == p2ma &&
+                  t == p2m_ram_logdirty && p2mt == p2m_ram_rw &&
+                  cur_order >= page_order &&
+                  !altp2m_mark_stale(p2m, gfn_x(gfn), page_order) )
+        {
+            /*
+             * The view's entry covers the whole range, mapping the same
+             * frames read-only: defer making it writable to the next write
+             * fault through this view.
+             */
+            perfc_incr(altp2m_propagate_lazy);
+        }
+        else
         {
             int rc = p2m_set_entry(p2m, gfn, mfn, page_order, p2mt, p2ma);
 
+            altp2m_clear_stale(p2m, gfn_x(gfn), page_order);
+            perfc_incr(altp2m_propagate_sync);
+
             /* Best effort: Don't bail on error. */
             if ( !ret )
                 ret = rc;
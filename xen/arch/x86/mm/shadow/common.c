@@ -76,18 +76,7 @@ int shadow_domain_init(struct domain *d)
  */
 void shadow_vcpu_init(struct vcpu *v)
 {
-#if (SHADOW_OPTIMIZATIONS & SHOPT_OUT_OF_SYNC)
-    int i, j;
-
-    for ( i = 0; i < SHADOW_OOS_PAGES; i++ )
-    {
-        v->arch.paging.shadow.oos[i] = INVALID_MFN;
-        v->arch.paging.shadow.oos_snapshot[i] = INVALID_MFN;
-        for ( j = 0; j < SHADOW_OOS_FIXUPS; j++ )
-            v->arch.paging.shadow.oos_fixup[i].smfn[j] = INVALID_MFN;
-    }
-#endif
-
+    /* The OOS arrays are set up along with the snapshots, on first use. */
     v->arch.paging.mode = is_pv_vcpu(v) ?
                           &SHADOW_INTERNAL_NAME(sh_paging_mode, 4) :
                           &SHADOW_INTERNAL_NAME(sh_paging_mode, 3);
@@ -155,9 +144,66 @@ __initcall(shadow_audit_key_init);
  *
  * We keep a hash per vcpu, because we want as much as possible to do
  * the re-sync on the save vcpu we did the unsync on, so the VA hint
- * will be valid.
+ * will be valid.  Its size is picked when the vcpu's snapshots are first
+ * allocated, from the size of the shadow pool, and stays fixed until the
+ * snapshots are freed again.
  */
 
+static unsigned int __read_mostly opt_oos_pages;
+integer_param("shadow-oos-pages", opt_oos_pages);
+
+/* Number of OOS slots to give each vcpu of d. */
+static unsigned int sh_oos_pages(const struct domain *d)
+{
+    static const unsigned int sizes[] = { SHADOW_OOS_PAGES, 7, 13,
+                                          SHADOW_OOS_PAGES_MAX };
+    unsigned int i = ARRAY_SIZE(sizes) - 1;
+
+    if ( opt_oos_pages )
+        return min(opt_oos_pages, (unsigned int)SHADOW_OOS_PAGES_MAX);
+
+    /*
+     * Let snapshots take up to 1/64th of the pool.  More slots mean less
+     * thrashing with many page tables being written to, but also more to
+     * resync on each TLB flush.
+     */
+    while ( i && sizes[i] * d->max_vcpus * 64 > d->arch.paging.shadow.total_pages )
+        i--;
+
+    return sizes[i];
+}
+
+/*
+ * Index of gmfn in v's OOS hash, or -1 if it's not there.  Callers look for
+ * gmfn in each vcpu's hash in turn, so misses are counted per vcpu probed.
+ */
+static int oos_hash_find(const struct vcpu *v, mfn_t gmfn)
+{
+    const mfn_t *oos = v->arch.paging.shadow.oos;
+    unsigned int nr = v->arch.paging.shadow.oos_pages;
+    unsigned int idx;
+
+    if ( !nr )
+        return -1;
+
+    idx = mfn_x(gmfn) % nr;
+    if ( mfn_eq(oos[idx], gmfn) )
+    {
+        perfc_incr(shadow_oos_hit);
+        return idx;
+    }
+
+    idx = (idx + 1) % nr;
+    if ( mfn_eq(oos[idx], gmfn) )
+    {
+        perfc_incr(shadow_oos_hit2);
+        return idx;
+    }
+
+    perfc_incr(shadow_oos_probe_miss);
+    return -1;
+}
+
 static void sh_oos_audit(struct domain *d)
 {
     unsigned int idx, expected_idx, expected_idx_alt;
@@ -166,14 +212,16 @@ static void sh_oos_audit(struct domain *d)
 
     for_each_vcpu(d, v)
     {
-        for ( idx = 0; idx < SHADOW_OOS_PAGES; idx++ )
+        unsigned int nr = v->arch.paging.shadow.oos_pages;
+
+        for ( idx = 0; idx < nr; idx++ )
         {
             mfn_t *oos = v->arch.paging.shadow.oos;
             if ( !mfn_valid(oos[idx]) )
                 continue;
 
-            expected_idx = mfn_x(oos[idx]) % SHADOW_OOS_PAGES;
-            expected_idx_alt = ((expected_idx + 1) % SHADOW_OOS_PAGES);
+            expected_idx = mfn_x(oos[idx]) % nr;
+            expected_idx_alt = ((expected_idx + 1) % nr);
             if ( idx != expected_idx && idx != expected_idx_alt )
             {
                 printk("%s: idx %x contains gmfn %lx, expected at %x or %x.\n",
@@ -207,22 +255,13 @@ static void sh_oos_audit(struct domain *d)
 #if SHADOW_AUDIT & SHADOW_AUDIT_ENTRIES
 void oos_audit_hash_is_present(struct domain *d, mfn_t gmfn)
 {
-    int idx;
     struct vcpu *v;
-    mfn_t *oos;
 
     ASSERT(mfn_is_out_of_sync(gmfn));
 
     for_each_vcpu(d, v)
-    {
-        oos = v->arch.paging.shadow.oos;
-        idx = mfn_x(gmfn) % SHADOW_OOS_PAGES;
-        if ( !mfn_eq(oos[idx], gmfn) )
-            idx = (idx + 1) % SHADOW_OOS_PAGES;
-
-        if ( mfn_eq(oos[idx], gmfn) )
+        if ( oos_hash_find(v, gmfn) >= 0 )
             return;
-    }
 
     printk(XENLOG_ERR "gmfn %"PRI_mfn" marked OOS but not in hash table\n",
            mfn_x(gmfn));
@@ -278,7 +317,6 @@ void oos_fixup_add(struct domain *d, mfn_t gmfn,
                    mfn_t smfn,  unsigned long off)
 {
     int idx, next;
-    mfn_t *oos;
     struct oos_fixup *oos_fixup;
     struct vcpu *v;
 
@@ -286,12 +324,9 @@ void oos_fixup_add(struct domain *d, mfn_t gmfn,
 
     for_each_vcpu(d, v)
     {
-        oos = v->arch.paging.shadow.oos;
         oos_fixup = v->arch.paging.shadow.oos_fixup;
-        idx = mfn_x(gmfn) % SHADOW_OOS_PAGES;
-        if ( !mfn_eq(oos[idx], gmfn) )
-            idx = (idx + 1) % SHADOW_OOS_PAGES;
-        if ( mfn_eq(oos[idx], gmfn) )
+        idx = oos_hash_find(v, gmfn);
+        if ( idx >= 0 )
         {
             int i;
             for ( i = 0; i < SHADOW_OOS_FIXUPS; i++ )
@@ -424,21 +459,22 @@ static void oos_hash_add(struct vcpu *v, mfn_t gmfn)
     mfn_t *oos_snapshot = v->arch.paging.shadow.oos_snapshot;
     struct oos_fixup *oos_fixup = v->arch.paging.shadow.oos_fixup;
     struct oos_fixup fixup = { .next = 0 };
+    unsigned int nr = v->arch.paging.shadow.oos_pages;
 
     for (i = 0; i < SHADOW_OOS_FIXUPS; i++ )
         fixup.smfn[i] = INVALID_MFN;
 
-    idx = mfn_x(gmfn) % SHADOW_OOS_PAGES;
+    idx = mfn_x(gmfn) % nr;
     oidx = idx;
 
     if ( mfn_valid(oos[idx])
-         && (mfn_x(oos[idx]) % SHADOW_OOS_PAGES) == idx )
+         && (mfn_x(oos[idx]) % nr) == idx )
     {
         /* Punt the current occupant into the next slot */
         SWAP(oos[idx], gmfn);
         SWAP(oos_fixup[idx], fixup);
         swap = 1;
-        idx = (idx + 1) % SHADOW_OOS_PAGES;
+        idx = (idx + 1) % nr;
     }
     if ( mfn_valid(oos[idx]) )
    {
@@ -463,20 +499,16 @@ static void oos_hash_add(struct vcpu *v, mfn_t gmfn)
 static void oos_hash_remove(struct domain *d, mfn_t gmfn)
 {
     int idx;
-    mfn_t *oos;
     struct vcpu *v;
 
     SHADOW_PRINTK("d%d gmfn %lx\n", d->domain_id, mfn_x(gmfn));
 
     for_each_vcpu(d, v)
     {
-        oos = v->arch.paging.shadow.oos;
-        idx = mfn_x(gmfn) % SHADOW_OOS_PAGES;
-        if ( !mfn_eq(oos[idx], gmfn) )
-            idx = (idx + 1) % SHADOW_OOS_PAGES;
-        if ( mfn_eq(oos[idx], gmfn) )
+        idx = oos_hash_find(v, gmfn);
+        if ( idx >= 0 )
         {
-            oos[idx] = INVALID_MFN;
+            v->arch.paging.shadow.oos[idx] = INVALID_MFN;
             return;
         }
     }
@@ -489,21 +521,13 @@ static void oos_hash_remove(struct domain *d, mfn_t gmfn)
 mfn_t oos_snapshot_lookup(struct domain *d, mfn_t gmfn)
 {
     int idx;
-    mfn_t *oos;
-    mfn_t *oos_snapshot;
     struct vcpu *v;
 
     for_each_vcpu(d, v)
     {
-        oos = v->arch.paging.shadow.oos;
-        oos_snapshot = v->arch.paging.shadow.oos_snapshot;
-        idx = mfn_x(gmfn) % SHADOW_OOS_PAGES;
-        if ( !mfn_eq(oos[idx], gmfn) )
-            idx = (idx + 1) % SHADOW_OOS_PAGES;
-        if ( mfn_eq(oos[idx], gmfn) )
-        {
-            return oos_snapshot[idx];
-        }
+        idx = oos_hash_find(v, gmfn);
+        if ( idx >= 0 )
+            return v->arch.paging.shadow.oos_snapshot[idx];
     }
 
     printk(XENLOG_ERR "gmfn %"PRI_mfn" was OOS but not in hash table\n",
@@ -515,24 +539,16 @@ mfn_t oos_snapshot_lookup(struct domain *d, mfn_t gmfn)
 void sh_resync(struct domain *d, mfn_t gmfn)
 {
     int idx;
-    mfn_t *oos;
-    mfn_t *oos_snapshot;
-    struct oos_fixup *oos_fixup;
     struct vcpu *v;
 
     for_each_vcpu(d, v)
     {
-        oos = v->arch.paging.shadow.oos;
-        oos_fixup = v->arch.paging.shadow.oos_fixup;
-        oos_snapshot = v->arch.paging.shadow.oos_snapshot;
-        idx = mfn_x(gmfn) % SHADOW_OOS_PAGES;
-        if ( !mfn_eq(oos[idx], gmfn) )
-            idx = (idx + 1) % SHADOW_OOS_PAGES;
-
-        if ( mfn_eq(oos[idx], gmfn) )
+        idx = oos_hash_find(v, gmfn);
+        if ( idx >= 0 )
         {
-            _sh_resync(v, gmfn, &oos_fixup[idx], oos_snapshot[idx]);
-            oos[idx] = INVALID_MFN;
+            _sh_resync(v, gmfn, &v->arch.paging.shadow.oos_fixup[idx],
+                       v->arch.paging.shadow.oos_snapshot[idx]);
+            v->arch.paging.shadow.oos[idx] = INVALID_MFN;
             return;
         }
     }
@@ -576,11 +592,13 @@ void sh_resync_all(struct vcpu *v, int skip, int this, int others)
 
     ASSERT(paging_locked_by_me(v->domain));
 
+    perfc_incr(shadow_resync_all);
+
     if ( !this )
         goto resync_others;
 
     /* First: resync all of this vcpu's oos pages */
-    for ( idx = 0; idx < SHADOW_OOS_PAGES; idx++ )
+    for ( idx = 0; idx < v->arch.paging.shadow.oos_pages; idx++ )
         if ( mfn_valid(oos[idx]) )
         {
             /* Write-protect and sync contents */
@@ -602,7 +620,7 @@ void sh_resync_all(struct vcpu *v, int skip, int this, int others)
         oos_fixup = other->arch.paging.shadow.oos_fixup;
         oos_snapshot = other->arch.paging.shadow.oos_snapshot;
 
-        for ( idx = 0; idx < SHADOW_OOS_PAGES; idx++ )
+        for ( idx = 0; idx < other->arch.paging.shadow.oos_pages; idx++ )
         {
             if ( !mfn_valid(oos[idx]) )
                 continue;
@@ -644,7 +662,8 @@ int sh_unsync(struct vcpu *v, mfn_t gmfn)
          ((SHF_page_type_mask & ~SHF_L1_ANY) | SHF_out_of_sync)
          || sh_page_has_multiple_shadows(pg)
          || is_pv_vcpu(v)
-         || !v->domain->arch.paging.shadow.oos_active )
+         || !v->domain->arch.paging.shadow.oos_active
+         || !v->arch.paging.shadow.oos_pages )
         return 0;
 
     BUILD_BUG_ON(!(typeof(pg->shadow_flags))SHF_out_of_sync);
@@ -1262,6 +1281,8 @@ static unsigned int sh_min_allocation(const struct domain *d)
                d->arch.paging.shadow.p2m_pages);
 }
 
+static void shadow_hash_resize(struct domain *d);
+
 int shadow_set_allocation(struct domain *d, unsigned int pages, bool *preempted)
 {
     struct page_info *sp;
@@ -1327,6 +1348,9 @@ int shadow_set_allocation(struct domain *d, unsigned int pages, bool *preempted)
         }
     }
 
+    if ( pages )
+        shadow_hash_resize(d);
+
     return 0;
 }
 
@@ -1344,18 +1368,35 @@ static unsigned int shadow_get_allocation(struct domain *d)
  * The table itself is an array of pointers to shadows; the shadows are then
  * threaded on a singly-linked list of shadows with the same hash value */
 
-#define SHADOW_HASH_BUCKETS 251
-/* Other possibly useful primes are 509, 1021, 2039, 4093, 8191, 16381 */
+/*
+ * The number of buckets follows the size of the shadow pool, so that large
+ * guests with many shadowed page tables don't end up with long chains.
+ */
+static const unsigned int sh_hash_sizes[] = {
+    251, 509, 1021, 2039, 4093, 8191, 16381, 32749,
+};
+
+/* Aim for no more than 4 shadow pages per bucket. */
+static unsigned int sh_hash_buckets(const struct domain *d)
+{
+    unsigned int i = ARRAY_SIZE(sh_hash_sizes) - 1;
+
+    while ( i && sh_hash_sizes[i] * 4 > d->arch.paging.shadow.total_pages )
+        i--;
+
+    return sh_hash_sizes[i];
+}
 
 /* Hash function that takes a gfn or mfn, plus another byte of type info */
 typedef u32 key_t;
-static inline key_t sh_hash(unsigned long n, unsigned int t)
+static inline key_t sh_hash(const struct domain *d, unsigned long n,
+                            unsigned int t)
 {
     unsigned char *p = (unsigned char *)&n;
     key_t k = t;
     int i;
     for ( i = 0; i < sizeof(n) ; i++ ) k = (u32)p[i] + (k<<6) + (k<<16) - k;
-    return k % SHADOW_HASH_BUCKETS;
+    return k % d->arch.paging.shadow.hash_buckets;
 }
 
 /* Before we get to the mechanism, define a pair of audit functions
@@ -1380,7 +1421,7 @@ static void sh_hash_audit_bucket(struct domain *d, int bucket)
         /* Wrong page of a multi-page shadow? */
         BUG_ON( !sp->u.sh.head );
         /* Wrong bucket? */
-        BUG_ON( sh_hash(__backpointer(sp), sp->u.sh.type) != bucket );
+        BUG_ON( sh_hash(d, __backpointer(sp), sp->u.sh.type) != bucket );
         /* Duplicate entry? */
         for ( x = next_shadow(sp); x; x = next_shadow(x) )
             BUG_ON( x->v.sh.back == sp->v.sh.back &&
@@ -1438,7 +1479,7 @@ static void sh_hash_audit(struct domain *d)
     if ( !(SHADOW_AUDIT & SHADOW_AUDIT_HASH_FULL) || !SHADOW_AUDIT_ENABLE )
         return;
 
-    for ( i = 0; i < SHADOW_HASH_BUCKETS; i++ )
+    for ( i = 0; i < d->arch.paging.shadow.hash_buckets; i++ )
     {
         sh_hash_audit_bucket(d, i);
     }
@@ -1453,12 +1494,48 @@ static int shadow_hash_alloc(struct domain *d)
     ASSERT(paging_locked_by_me(d));
     ASSERT(!d->arch.paging.shadow.hash_table);
 
-    table = xzalloc_array(struct page_info *, SHADOW_HASH_BUCKETS);
+    table = xzalloc_array(struct page_info *, sh_hash_buckets(d));
     if ( !table ) return 1;
     d->arch.paging.shadow.hash_table = table;
+    d->arch.paging.shadow.hash_buckets = sh_hash_buckets(d);
     return 0;
 }
 
+/* Re-size the table to suit the current size of the shadow pool.  Failure
+ * to allocate a new table is harmless: we keep using the old one. */
+static void shadow_hash_resize(struct domain *d)
+{
+    struct page_info **table, **old = d->arch.paging.shadow.hash_table;
+    struct page_info *sp, *next;
+    unsigned int i, nr = sh_hash_buckets(d);
+    unsigned int old_nr = d->arch.paging.shadow.hash_buckets;
+
+    ASSERT(paging_locked_by_me(d));
+    ASSERT(!d->arch.paging.shadow.hash_walking);
+
+    if ( !old || nr == old_nr )
+        return;
+
+    table = xzalloc_array(struct page_info *, nr);
+    if ( !table )
+        return;
+
+    d->arch.paging.shadow.hash_buckets = nr;
+    for ( i = 0; i < old_nr; i++ )
+        for ( sp = old[i]; sp; sp = next )
+        {
+            key_t key = sh_hash(d, __backpointer(sp), sp->u.sh.type);
+
+            next = next_shadow(sp);
+            set_next_shadow(sp, table[key]);
+            table[key] = sp;
+        }
+
+    d->arch.paging.shadow.hash_table = table;
+    xfree(old);
+    perfc_incr(shadow_hash_resizes);
+}
+
 /* Tear down the hash table and return all memory to Xen.
  * This function does not care whether the table is populated. */
 static void shadow_hash_teardown(struct domain *d)
@@ -1468,6 +1545,7 @@ static void shadow_hash_teardown(struct domain *d)
 
     xfree(d->arch.paging.shadow.hash_table);
     d->arch.paging.shadow.hash_table = NULL;
+    d->arch.paging.shadow.hash_buckets = 0;
 }
 
 
@@ -1485,7 +1563,7 @@ mfn_t shadow_hash_lookup(struct domain *d, unsigned long n, unsigned int t)
     sh_hash_audit(d);
 
     perfc_incr(shadow_hash_lookups);
-    key = sh_hash(n, t);
+    key = sh_hash(d, n, t);
     sh_hash_audit_bucket(d, key);
 
     sp = d->arch.paging.shadow.hash_table[key];
@@ -1538,7 +1616,7 @@ void shadow_hash_insert(struct domain *d, unsigned long n, unsigned int t,
     sh_hash_audit(d);
 
     perfc_incr(shadow_hash_inserts);
-    key = sh_hash(n, t);
+    key = sh_hash(d, n, t);
     sh_hash_audit_bucket(d, key);
 
     /* Insert this shadow at the top of the bucket */
@@ -1563,7 +1641,7 @@ void shadow_hash_delete(struct domain *d, unsigned long n, unsigned int t,
     sh_hash_audit(d);
 
     perfc_incr(shadow_hash_deletes);
-    key = sh_hash(n, t);
+    key = sh_hash(d, n, t);
     sh_hash_audit_bucket(d, key);
 
     sp = mfn_to_page(smfn);
@@ -1620,7 +1698,7 @@ static void hash_vcpu_foreach(struct vcpu *v, unsigned int callback_mask,
     ASSERT(d->arch.paging.shadow.hash_walking == 0);
     d->arch.paging.shadow.hash_walking = 1;
 
-    for ( i = 0; i < SHADOW_HASH_BUCKETS; i++ )
+    for ( i = 0; i < d->arch.paging.shadow.hash_buckets; i++ )
     {
         /* WARNING: This is not safe against changes to the hash table.
          * The callback *must* return non-zero if it has inserted or
@@ -1667,7 +1745,7 @@ static void hash_domain_foreach(struct domain *d,
     ASSERT(d->arch.paging.shadow.hash_walking == 0);
     d->arch.paging.shadow.hash_walking = 1;
 
-    for ( i = 0; i < SHADOW_HASH_BUCKETS; i++ )
+    for ( i = 0; i < d->arch.paging.shadow.hash_buckets; i++ )
     {
         /* WARNING: This is not safe against changes to the hash table.
          * The callback *must* return non-zero if it has inserted or
@@ -2370,6 +2448,58 @@ void sh_reset_l3_up_pointers(struct vcpu *v)
 
 /**************************************************************************/
 
+#if (SHADOW_OPTIMIZATIONS & SHOPT_OUT_OF_SYNC)
+/* Set up v's OOS hash and snapshots.  Returns false on failure. */
+static bool sh_oos_alloc(struct vcpu *v)
+{
+    struct domain *d = v->domain;
+    unsigned int i, j, nr = sh_oos_pages(d);
+    mfn_t *oos = xmalloc_array(mfn_t, nr);
+    mfn_t *oos_snapshot = xmalloc_array(mfn_t, nr);
+    struct oos_fixup *oos_fixup = xzalloc_array(struct oos_fixup, nr);
+
+    if ( !oos || !oos_snapshot || !oos_fixup )
+    {
+        xfree(oos);
+        xfree(oos_snapshot);
+        xfree(oos_fixup);
+        return false;
+    }
+
+    for ( i = 0; i < nr; i++ )
+    {
+        oos[i] = INVALID_MFN;
+        for ( j = 0; j < SHADOW_OOS_FIXUPS; j++ )
+            oos_fixup[i].smfn[j] = INVALID_MFN;
+        shadow_prealloc(d, SH_type_oos_snapshot, 1);
+        oos_snapshot[i] = shadow_alloc(d, SH_type_oos_snapshot, 0);
+    }
+
+    v->arch.paging.shadow.oos = oos;
+    v->arch.paging.shadow.oos_snapshot = oos_snapshot;
+    v->arch.paging.shadow.oos_fixup = oos_fixup;
+    v->arch.paging.shadow.oos_pages = nr;
+
+    return true;
+}
+
+static void sh_oos_free(struct vcpu *v)
+{
+    struct domain *d = v->domain;
+    mfn_t *oos_snapshot = v->arch.paging.shadow.oos_snapshot;
+    unsigned int i;
+
+    for ( i = 0; i < v->arch.paging.shadow.oos_pages; i++ )
+        if ( mfn_valid(oos_snapshot[i]) )
+            shadow_free(d, oos_snapshot[i]);
+
+    v->arch.paging.shadow.oos_pages = 0;
+    XFREE(v->arch.paging.shadow.oos);
+    XFREE(v->arch.paging.shadow.oos_snapshot);
+    XFREE(v->arch.paging.shadow.oos_fixup);
+}
+#endif /* OOS */
+
 static void sh_update_paging_modes(struct vcpu *v)
 {
     struct domain *d = v->domain;
@@ -2393,16 +2523,14 @@ static void sh_update_paging_modes(struct vcpu *v)
 #endif /* (SHADOW_OPTIMIZATIONS & SHOPT_VIRTUAL_TLB) */
 
 #if (SHADOW_OPTIMIZATIONS & SHOPT_OUT_OF_SYNC)
-    if ( mfn_eq(v->arch.paging.shadow.oos_snapshot[0], INVALID_MFN) )
-    {
-        int i;
-        for(i = 0; i < SHADOW_OOS_PAGES; i++)
-        {
-            shadow_prealloc(d, SH_type_oos_snapshot, 1);
-            v->arch.paging.shadow.oos_snapshot[i] =
-                shadow_alloc(d, SH_type_oos_snapshot, 0);
-        }
-    }
+    /*
+     * Without OOS space the vcpu's guest pagetables simply stay in sync
+     * (see sh_unsync()); allocation is retried on the next mode update.
+     */
+    if ( unlikely(!v->arch.paging.shadow.oos_pages) &&
+         !sh_oos_alloc(v) )
+        printk(XENLOG_G_WARNING
+               "Could not allocate OOS space for %pv, not unsyncing\n", v);
 #endif /* OOS */
 
     // Valid transitions handled by this function:
@@ -2740,16 +2868,7 @@ void shadow_teardown(struct domain *d, bool *preempted)
 #endif /* (SHADOW_OPTIMIZATIONS & SHOPT_VIRTUAL_TLB) */
 
 #if (SHADOW_OPTIMIZATIONS & SHOPT_OUT_OF_SYNC)
-        {
-            int i;
-            mfn_t *oos_snapshot = v->arch.paging.shadow.oos_snapshot;
-            for ( i = 0; i < SHADOW_OOS_PAGES; i++ )
-                if ( mfn_valid(oos_snapshot[i]) )
-                {
-                    shadow_free(d, oos_snapshot[i]);
-                    oos_snapshot[i] = INVALID_MFN;
-                }
-        }
+        sh_oos_free(v);
 #endif /* OOS */
     }
 #endif /* (SHADOW_OPTIMIZATIONS & (SHOPT_VIRTUAL_TLB|SHOPT_OUT_OF_SYNC)) */
@@ -2924,16 +3043,7 @@ static int shadow_one_bit_disable(struct domain *d, u32 mode)
                 make_cr3(v, pagetable_get_mfn(v->arch.guest_table));
 
 #if (SHADOW_OPTIMIZATIONS & SHOPT_OUT_OF_SYNC)
-            {
-                int i;
-                mfn_t *oos_snapshot = v->arch.paging.shadow.oos_snapshot;
-                for ( i = 0; i < SHADOW_OOS_PAGES; i++ )
-                    if ( mfn_valid(oos_snapshot[i]) )
-                    {
-                        shadow_free(d, oos_snapshot[i]);
-                        oos_snapshot[i] = INVALID_MFN;
-                    }
-            }
+            sh_oos_free(v);
 #endif /* OOS */
         }
 
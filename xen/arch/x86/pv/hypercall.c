@@ -96,6 +96,7 @@ void pv_hypercall(struct cpu_user_regs *regs)
 {
     struct vcpu *curr = current;
     unsigned long eax;
+    s_time_t start;
 
     ASSERT(guest_kernel_mode(curr, regs));
 
@@ -119,6 +120,7 @@ void pv_hypercall(struct cpu_user_regs *regs)
     }
 
     curr->hcall_preempted = false;
+    start = NOW();
 
     if ( !is_pv_32bit_vcpu(curr) )
     {
@@ -216,6 +218,8 @@ void pv_hypercall(struct cpu_user_regs *regs)
 #endif
     }
 
+    hypercall_stats_account(curr, eax, start);
+
     /*
      * PV guests use SYSCALL or INT $0x82 to make a hypercall, both of which
      * have trap semantics.  If the hypercall has been preempted, rewind the
@@ -30,6 +30,7 @@
 #include <xen/nodemask.h>
 #include <xen/cpu.h>
 #include <xsm/xsm.h>
+#include <asm/pmuprof.h>
 #include <asm/psr.h>
 #include <asm/cpuid.h>
 
@@ -458,6 +459,124 @@ long arch_do_sysctl(
         break;
     }
 
+    case XEN_SYSCTL_vmexit_stats:
+    {
+        struct xen_sysctl_vmexit_stats *vs = &sysctl->u.vmexit_stats;
+        xen_sysctl_vmexit_reason_t r;
+        struct domain *d;
+        struct vcpu *v;
+        unsigned int i;
+
+        BUILD_BUG_ON(XEN_SYSCTL_VMEXIT_REASONS != HVM_EXIT_STATS_NR);
+        BUILD_BUG_ON(XEN_SYSCTL_VMEXIT_SVM_NPF != HVM_EXIT_STATS_SVM_NPF);
+        BUILD_BUG_ON(XEN_SYSCTL_VMEXIT_OTHER != HVM_EXIT_STATS_OTHER);
+
+        if ( vs->pad || vs->pad2 )
+        {
+            ret = -EINVAL;
+            break;
+        }
+
+        if ( (d = rcu_lock_domain_by_id(vs->domid)) == NULL )
+        {
+            ret = -ESRCH;
+            break;
+        }
+
+        if ( !is_hvm_domain(d) )
+            ret = -EOPNOTSUPP;
+        else if ( vs->vcpu != XEN_SYSCTL_VMEXIT_STATS_all_vcpus &&
+                  domain_vcpu(d, vs->vcpu) == NULL )
+            ret = -ENOENT;
+
+        /* Read without any locking: counts may be a single exit behind. */
+        for ( i = 0; !ret && i < XEN_SYSCTL_VMEXIT_REASONS; i++ )
+        {
+            r.count = r.cycles = 0;
+            for_each_vcpu ( d, v )
+            {
+                if ( vs->vcpu != XEN_SYSCTL_VMEXIT_STATS_all_vcpus &&
+                     v->vcpu_id != vs->vcpu )
+                    continue;
+                r.count += read_atomic(&v->arch.hvm.exit_stats->count[i]);
+                r.cycles += read_atomic(&v->arch.hvm.exit_stats->cycles[i]);
+            }
+
+            if ( copy_to_guest_offset(vs->reasons, i, &r, 1) )
+                ret = -EFAULT;
+        }
+
+        rcu_unlock_domain(d);
+
+        if ( ret )
+            break;
+
+        vs->vendor = cpu_has_vmx ? XEN_SYSCTL_VMEXIT_STATS_vmx
+                                 : XEN_SYSCTL_VMEXIT_STATS_svm;
+        if ( __copy_field_to_guest(u_sysctl, sysctl, u.vmexit_stats.vendor) )
+            ret = -EFAULT;
+        break;
+    }
+
+    case XEN_SYSCTL_pmuprof_op:
+        ret = pmuprof_op(&sysctl->u.pmuprof_op);
+        if ( !ret && __copy_field_to_guest(u_sysctl, sysctl, u.pmuprof_op) )
+            ret = -EFAULT;
+        break;
+
+    case XEN_SYSCTL_hypercall_stats:
+    {
+        struct xen_sysctl_hypercall_stats *hs = &sysctl->u.hypercall_stats;
+        xen_sysctl_hypercall_op_stats_t o;
+        struct domain *d;
+        struct vcpu *v;
+        unsigned int i, b;
+
+        BUILD_BUG_ON(XEN_SYSCTL_HYPERCALL_BUCKETS != HYPERCALL_STATS_BUCKETS);
+
+        if ( hs->pad )
+        {
+            ret = -EINVAL;
+            break;
+        }
+
+        if ( (d = rcu_lock_domain_by_id(hs->domid)) == NULL )
+        {
+            ret = -ESRCH;
+            break;
+        }
+
+        /* Read without any locking: counts may be a single call behind. */
+        for ( i = 0; !ret && i < min(hs->nr_ops, NR_hypercalls + 0u); i++ )
+        {
+            memset(&o, 0, sizeof(o));
+            for_each_vcpu ( d, v )
+            {
+                typeof(v->arch.hcall_stats->op[0]) *s =
+                    &v->arch.hcall_stats->op[i];
+
+                o.calls += read_atomic(&s->calls);
+                o.preempted += read_atomic(&s->preempted);
+                o.time += read_atomic(&s->time);
+                for ( b = 0; b < XEN_SYSCTL_HYPERCALL_BUCKETS; b++ )
+                    o.latency[b] += read_atomic(&s->latency[b]);
+            }
+
+            if ( copy_to_guest_offset(hs->ops, i, &o, 1) )
+                ret = -EFAULT;
+        }
+
+        rcu_unlock_domain(d);
+
+        if ( ret )
+            break;
+
+        hs->nr_ops = NR_hypercalls;
+        if ( __copy_field_to_guest(u_sysctl, sysctl, u.hypercall_stats.nr_ops) )
+            ret = -EFAULT;
+        break;
+    }
+
     default:
         ret = -ENOSYS;
         break;
@@ -54,6 +54,14 @@ CHECK_evtchn_op;
 #undef xen_evtchn_status
 #undef xen_evtchn_unmask
 
+#define xen_evtchn_send_batch evtchn_send_batch
+CHECK_evtchn_send_batch;
+#undef xen_evtchn_send_batch
+
+#define xen_evtchn_set_moderation evtchn_set_moderation
+CHECK_evtchn_set_moderation;
+#undef xen_evtchn_set_moderation
+
 #define xen_mmu_update mmu_update
 CHECK_mmu_update;
 #undef xen_mmu_update
@@ -388,6 +388,7 @@ struct domain *domain_create(domid_t domid,
     atomic_set(&d->refcnt, 1);
     spin_lock_init_prof(d, domain_lock);
     spin_lock_init_prof(d, page_alloc_lock);
+    spin_lock_set_class(&d->page_alloc_lock, LOCK_CLASS_HEAP);
     spin_lock_init(&d->hypercall_deadlock_mutex);
     INIT_PAGE_LIST_HEAD(&d->page_list);
     INIT_PAGE_LIST_HEAD(&d->xenpage_list);
@@ -581,14 +581,34 @@ long do_domctl(XEN_GUEST_HANDLE_PARAM(xen_domctl_t) u_domctl)
         break;
 
     case XEN_DOMCTL_destroydomain:
+    {
+        struct xen_domctl_destroydomain *dd = &op->u.destroydomain;
+
         domctl_lock_release();
+
+        if ( dd->flags & ~XEN_DOMCTL_DESTROY_report )
+        {
+            ret = -EINVAL;
+            goto domctl_out_unlock_domonly;
+        }
+
         domain_lock(d);
         ret = domain_kill(d);
         domain_unlock(d);
         if ( ret == -ERESTART )
-            ret = hypercall_create_continuation(
-                __HYPERVISOR_domctl, "h", u_domctl);
+        {
+            if ( dd->flags & XEN_DOMCTL_DESTROY_report )
+            {
+                dd->nr_pages = d->tot_pages;
+                ret = __copy_field_to_guest(u_domctl, op, u.destroydomain)
+                      ? -EFAULT : -EAGAIN;
+            }
+            else
+                ret = hypercall_create_continuation(
+                    __HYPERVISOR_domctl, "h", u_domctl);
+        }
         goto domctl_out_unlock_domonly;
+    }
 
     case XEN_DOMCTL_setnodeaffinity:
     {
@@ -0,0 +1,249 @@
+/******************************************************************************
+ * domstats.c
+ *
+ * The domain statistics region: what XEN_DOMCTL_getdomaininfo and
+ * XEN_DOMCTL_getvcpuinfo return for every domain, kept up to date in pages
+ * the toolstack can map read-only, so that monitoring tools don't have to
+ * issue hypercalls per domain and per vCPU on every refresh.
+ *
+ * Nothing is allocated, and no timer runs, until the region is first
+ * acquired.  From then on, it is rewritten every domstats-period
+ * milliseconds, one page per domain, under a seqlock in its header page.
+ * Domain pages are never freed, as they may be mapped, only reused.
+ *
+ * Each refresh walks all domains from softirq context, taking every vCPU's
+ * schedule lock, so the timer stops once nobody maps the header page any
+ * longer, and is restarted by the next acquire.
+ */
+
+#include <xen/domain.h>
+#include <xen/init.h>
+#include <xen/lib.h>
+#include <xen/mm.h>
+#include <xen/rcupdate.h>
+#include <xen/sched.h>
+#include <xen/spinlock.h>
+#include <xen/time.h>
+#include <xen/timer.h>
+#include <public/domstats.h>
+
+/* Refresh period in ms, 0 to disable the region. */
+static unsigned int __read_mostly domstats_period = 100;
+integer_param("domstats-period", domstats_period);
+
+static DEFINE_SPINLOCK(domstats_lock);
+static struct timer domstats_timer;
+static struct xen_domstats_header *header;
+static struct xen_domstats_domain **slots;  /* DOMID_FIRST_RESERVED entries */
+static unsigned int nr_slots;
+/*
+ * Sequence count, only ever written to the header: the toolstack may be
+ * able to write to the page, so it is never read back from there.
+ */
+static uint32_t seq;
+static bool timer_stopped;
+static s_time_t last_acquire;
+
+static struct xen_domstats_domain *alloc_slot(void)
+{
+    struct xen_domstats_domain *slot = alloc_xenheap_page();
+
+    if ( slot )
+    {
+        clear_page(slot);
+        share_xen_page_with_privileged_guests(virt_to_page(slot), SHARE_ro);
+    }
+
+    return slot;
+}
+
+static void fill_slot(struct xen_domstats_domain *slot, struct domain *d)
+{
+    struct vcpu_runstate_info runstate;
+    struct vcpu *v;
+    unsigned int i = 0;
+
+    getdomaininfo(d, &slot->info);
+
+    slot->evtchn_sends = 0;
+    for_each_vcpu ( d, v )
+    {
+        unsigned long sends = read_atomic(&v->evtchn_sends);
+
+        slot->evtchn_sends += sends;
+
+        if ( i == XEN_DOMSTATS_MAX_VCPUS )
+            continue;
+
+        vcpu_runstate_get(v, &runstate);
+        slot->vcpu[i].cpu_time = runstate.time[RUNSTATE_running];
+        slot->vcpu[i].evtchn_sends = sends;
+        slot->vcpu[i].online = !(v->pause_flags & VPF_down);
+        slot->vcpu[i].blocked = !!(v->pause_flags & VPF_blocked);
+        slot->vcpu[i].running = v->is_running;
+        slot->vcpu[i].cpu = v->processor;
+        i++;
+    }
+    slot->nr_vcpus = i;
+}
+
+/* Rewrite the region; called with domstats_lock held. */
+static void domstats_update(void)
+{
+    struct domain *d;
+    unsigned int n = 0;
+    uint32_t flags = 0;
+
+    write_atomic(&header->seq, ++seq);
+    smp_wmb();
+
+    rcu_read_lock(&domlist_read_lock);
+
+    for_each_domain ( d )
+    {
+        if ( n == nr_slots )
+        {
+            if ( nr_slots == DOMID_FIRST_RESERVED ||
+                 (slots[nr_slots] = alloc_slot()) == NULL )
+            {
+                flags |= XEN_DOMSTATS_incomplete;
+                break;
+            }
+            nr_slots++;
+        }
+
+        fill_slot(slots[n++], d);
+    }
+
+    rcu_read_unlock(&domlist_read_lock);
+
+    header->nr_frames = 1 + nr_slots;
+    header->nr_domains = n;
+    header->flags = flags;
+    header->timestamp = NOW();
+
+    smp_wmb();
+    write_atomic(&header->seq, ++seq);
+}
+
+/* Whether anybody besides Xen holds a reference to the header page. */
+static bool domstats_mapped(void)
+{
+    return (virt_to_page(header)->count_info & PGC_count_mask) > 1;
+}
+
+static void domstats_refresh(void *unused)
+{
+    spin_lock(&domstats_lock);
+
+    /*
+     * Leave the tool which acquired the region a period to map it, then
+     * stop refreshing once it is no longer mapped.
+     */
+    if ( !domstats_mapped() &&
+         NOW() - last_acquire > MILLISECS(domstats_period) )
+    {
+        timer_stopped = true;
+        spin_unlock(&domstats_lock);
+        return;
+    }
+
+    domstats_update();
+
+    spin_unlock(&domstats_lock);
+
+    set_timer(&domstats_timer, NOW() + MILLISECS(domstats_period));
+}
+
+/* Allocate the region and start refreshing it, on first use. */
+static int domstats_enable(void)
+{
+    struct xen_domstats_header *hdr;
+    struct xen_domstats_domain **array;
+
+    BUILD_BUG_ON(sizeof(struct xen_domstats_header) > PAGE_SIZE);
+    BUILD_BUG_ON(sizeof(struct xen_domstats_domain) > PAGE_SIZE);
+
+    if ( !domstats_period )
+        return -EOPNOTSUPP;
+
+    hdr = alloc_xenheap_page();
+    array = xzalloc_array(struct xen_domstats_domain *, DOMID_FIRST_RESERVED);
+    if ( !hdr || !array )
+    {
+        free_xenheap_page(hdr);
+        xfree(array);
+        return -ENOMEM;
+    }
+
+    clear_page(hdr);
+    hdr->version = XEN_DOMSTATS_VERSION;
+    hdr->period_ms = domstats_period;
+    hdr->nr_frames = 1;
+
+    spin_lock(&domstats_lock);
+    if ( header )
+    {
+        /* Lost a race with another caller. */
+        spin_unlock(&domstats_lock);
+        free_xenheap_page(hdr);
+        xfree(array);
+        return 0;
+    }
+    share_xen_page_with_privileged_guests(virt_to_page(hdr), SHARE_ro);
+    slots = array;
+    header = hdr;
+    last_acquire = NOW();
+
+    /* Fill the region in before anyone gets to map it. */
+    domstats_update();
+
+    spin_unlock(&domstats_lock);
+
+    init_timer(&domstats_timer, domstats_refresh, NULL, smp_processor_id());
+    set_timer(&domstats_timer, NOW() + MILLISECS(domstats_period));
+
+    return 0;
+}
+
+int domstats_acquire(unsigned long frame, unsigned int nr_frames,
+                     xen_pfn_t mfn_list[])
+{
+    unsigned int i;
+    int rc = 0;
+
+    if ( !read_atomic(&header) && (rc = domstats_enable()) != 0 )
+        return rc;
+
+    spin_lock(&domstats_lock);
+
+    if ( frame > nr_slots || nr_frames > nr_slots + 1 - frame )
+        rc = -EINVAL;
+
+    last_acquire = NOW();
+    if ( timer_stopped )
+    {
+        /* Bring the region up to date before it gets mapped again. */
+        timer_stopped = false;
+        domstats_update();
+        set_timer(&domstats_timer, NOW() + MILLISECS(domstats_period));
+    }
+
+    for ( i = 0; !rc && i < nr_frames; i++ )
+        mfn_list[i] = frame + i ? __virt_to_mfn(slots[frame + i - 1])
+                                : __virt_to_mfn(header);
+
+    spin_unlock(&domstats_lock);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -132,6 +132,7 @@ static struct evtchn *alloc_evtchn_bucket(struct domain *d, unsigned int port)
         }
         chn[i].port = port + i;
         spin_lock_init(&chn[i].lock);
+        spin_lock_set_class(&chn[i].lock, LOCK_CLASS_EVENT);
     }
     return chn;
 }
@@ -204,8 +205,190 @@ static int get_free_port(struct domain *d)
     return -ENOSPC;
 }
 
+/*
+ * Per-port notification moderation.  Notifications in excess of max_events
+ * per interval are folded into a single deferred one, delivered by a timer
+ * on the pCPU the notified vCPU was running on when moderation was set up.
+ *
+ * The structure is allocated on first use, under the domain's event_lock,
+ * and only freed when the port is closed.  Senders access it holding their
+ * own channel's lock only, which closing a bound port also takes, so they
+ * never observe it being freed.  As they don't hold this port's lock, the
+ * pointer is published with a write barrier rather than under that lock.
+ */
+struct evtchn_moderation {
+    spinlock_t lock;
+    struct timer timer;
+    struct domain *d;
+    struct evtchn *chn;
+    s_time_t interval;
+    s_time_t window_start;
+    unsigned int max_events;
+    unsigned int count;
+    bool deferred;
+};
+
+static void evtchn_moderation_flush(void *data)
+{
+    struct evtchn_moderation *mod = data;
+    struct evtchn *chn = mod->chn;
+    bool deliver;
+
+    spin_lock(&mod->lock);
+    deliver = mod->deferred;
+    mod->deferred = false;
+    mod->window_start = NOW();
+    mod->count = deliver;
+    spin_unlock(&mod->lock);
+
+    /* The peer may have gone away since the event was deferred. */
+    if ( deliver && read_atomic(&chn->state) == ECS_INTERDOMAIN )
+        evtchn_port_set_pending(mod->d, chn->notify_vcpu_id, chn);
+}
+
+/*
+ * Account a notification arriving on @chn.  Returns true if it must be
+ * deferred, in which case the flush timer will deliver it later.
+ */
+static bool evtchn_moderate(struct evtchn *chn)
+{
+    struct evtchn_moderation *mod = read_atomic(&chn->moderation);
+    s_time_t now;
+    bool defer = false;
+
+    if ( likely(!mod) || !read_atomic(&mod->max_events) )
+        return false;
+
+    spin_lock(&mod->lock);
+
+    if ( !mod->max_events )
+        goto out;
+
+    now = NOW();
+    if ( now - mod->window_start >= mod->interval )
+    {
+        mod->window_start = now;
+        mod->count = 0;
+    }
+
+    if ( mod->count < mod->max_events && !mod->deferred )
+        mod->count++;
+    else
+    {
+        defer = true;
+        if ( !mod->deferred )
+        {
+            mod->deferred = true;
+            set_timer(&mod->timer, mod->window_start + mod->interval);
+        }
+    }
+
+ out:
+    spin_unlock(&mod->lock);
+
+    return defer;
+}
+
+static void evtchn_moderation_free(struct evtchn *chn)
+{
+    struct evtchn_moderation *mod = chn->moderation;
+
+    if ( !mod )
+        return;
+
+    chn->moderation = NULL;
+    kill_timer(&mod->timer);
+    xfree(mod);
+}
+
+static long evtchn_set_moderation(const struct evtchn_set_moderation *set)
+{
+    struct domain *d = current->domain;
+    struct evtchn *chn;
+    struct evtchn_moderation *mod;
+    bool flush = false;
+    long rc = 0;
+
+    if ( set->max_events &&
+         (!set->interval_us ||
+          set->interval_us > EVTCHN_MODERATION_MAX_INTERVAL_US) )
+        return -EINVAL;
+
+    spin_lock(&d->event_lock);
+
+    if ( !port_is_valid(d, set->port) )
+    {
+        rc = -EINVAL;
+        goto out;
+    }
+
+    chn = evtchn_from_port(d, set->port);
+
+    /* Only notifications from other domains can be moderated. */
+    if ( (chn->state != ECS_UNBOUND && chn->state != ECS_INTERDOMAIN) ||
+         consumer_is_xen(chn) )
+    {
+        rc = -EINVAL;
+        goto out;
+    }
+
+    mod = chn->moderation;
+    if ( !mod )
+    {
+        if ( !set->max_events )
+            goto out;
+
+        mod = xzalloc(struct evtchn_moderation);
+        if ( !mod )
+        {
+            rc = -ENOMEM;
+            goto out;
+        }
+
+        spin_lock_init(&mod->lock);
+        init_timer(&mod->timer, evtchn_moderation_flush, mod,
+                   d->vcpu[chn->notify_vcpu_id]->processor);
+        mod->d = d;
+        mod->chn = chn;
+    }
+
+    spin_lock(&mod->lock);
+    mod->interval = MICROSECS(set->interval_us);
+    mod->max_events = set->max_events;
+    mod->window_start = NOW();
+    mod->count = 0;
+    if ( !mod->max_events && mod->deferred )
+    {
+        mod->deferred = false;
+        flush = true;
+    }
+    spin_unlock(&mod->lock);
+
+    /*
+     * Senders only hold their own channel's lock, not ours: publish a fully
+     * initialised structure to them.
+     */
+    smp_wmb();
+    write_atomic(&chn->moderation, mod);
+
+    if ( flush )
+    {
+        stop_timer(&mod->timer);
+        if ( chn->state == ECS_INTERDOMAIN )
+            evtchn_port_set_pending(d, chn->notify_vcpu_id, chn);
+    }
+
+ out:
+    spin_unlock(&d->event_lock);
+
+    return rc;
+}
+
 void evtchn_free(struct domain *d, struct evtchn *chn)
 {
+    /* Drop moderation and any deferred notification along with the port. */
+    evtchn_moderation_free(chn);
+
     /* Clear pending event to avoid unexpected behavior on re-bind. */
     evtchn_port_clear_pending(d, chn);
 
@@ -705,7 +888,7 @@ int evtchn_send(struct domain *ld, unsigned int lport)
         rchn  = evtchn_from_port(rd, rport);
         if ( consumer_is_xen(rchn) )
             xen_notification_fn(rchn)(rd->vcpu[rchn->notify_vcpu_id], rport);
-        else
+        else if ( !evtchn_moderate(rchn) )
             evtchn_port_set_pending(rd, rchn->notify_vcpu_id, rchn);
         break;
     case ECS_IPI:
@@ -724,6 +907,37 @@ out:
     return ret;
 }
 
+static long evtchn_send_batch(struct domain *ld,
+                              struct evtchn_send_batch *batch)
+{
+    unsigned int i;
+    long rc = 0;
+
+    if ( batch->nr_ports > ARRAY_SIZE(batch->ports) )
+        return -EINVAL;
+
+    /*
+     * Defer the IPIs raised by waking or kicking the target vCPUs until the
+     * whole batch has been marked pending, so that each remote pCPU gets
+     * interrupted at most once.  Marking the upcall pending is itself
+     * idempotent, so several ports bound to one vCPU only raise one upcall.
+     */
+    cpu_raise_softirq_batch_begin();
+
+    for ( i = 0; i < batch->nr_ports; i++ )
+    {
+        rc = evtchn_send(ld, batch->ports[i]);
+        if ( rc )
+            break;
+    }
+
+    cpu_raise_softirq_batch_finish();
+
+    batch->nr_sent = i;
+
+    return rc;
+}
+
 int guest_enabled_event(struct vcpu *v, uint32_t virq)
 {
     return ((v != NULL) && (v->virq_to_evtchn[virq] != 0));
@@ -968,6 +1182,8 @@ long evtchn_bind_vcpu(unsigned int port, unsigned int vcpu_id)
     case ECS_UNBOUND:
     case ECS_INTERDOMAIN:
         chn->notify_vcpu_id = v->vcpu_id;
+        if ( chn->moderation )
+            migrate_timer(&chn->moderation->timer, v->processor);
         break;
     case ECS_PIRQ:
         if ( chn->notify_vcpu_id == v->vcpu_id )
@@ -1120,6 +1336,20 @@ long do_event_channel_op(int cmd, XEN_GUEST_HANDLE_PARAM(void) arg)
         if ( copy_from_guest(&send, arg, 1) != 0 )
             return -EFAULT;
         rc = evtchn_send(current->domain, send.port);
+        if ( !rc )
+            current->evtchn_sends++;
+        break;
+    }
+
+    case EVTCHNOP_send_batch: {
+        struct evtchn_send_batch send_batch;
+        if ( copy_from_guest(&send_batch, arg, 1) != 0 )
+            return -EFAULT;
+        rc = evtchn_send_batch(current->domain, &send_batch);
+        current->evtchn_sends += send_batch.nr_sent;
+        if ( __copy_field_to_guest(guest_handle_cast(arg, evtchn_send_batch_t),
+                                   &send_batch, nr_sent) )
+            rc = -EFAULT;
         break;
     }
 
@@ -1194,6 +1424,14 @@ long do_event_channel_op(int cmd, XEN_GUEST_HANDLE_PARAM(void) arg)
         break;
     }
 
+    case EVTCHNOP_set_moderation: {
+        struct evtchn_set_moderation set_moderation;
+        if ( copy_from_guest(&set_moderation, arg, 1) != 0 )
+            return -EFAULT;
+        rc = evtchn_set_moderation(&set_moderation);
+        break;
+    }
+
     default:
         rc = -ENOSYS;
         break;
@@ -1301,6 +1539,7 @@ int evtchn_init(struct domain *d, unsigned int max_port)
     d->valid_evtchns = EVTCHNS_PER_BUCKET;
 
     spin_lock_init_prof(d, event_lock);
+    spin_lock_set_class(&d->event_lock, LOCK_CLASS_EVENT);
     if ( get_free_port(d) != 0 )
     {
         free_evtchn_bucket(d, d->evtchn);
@@ -1407,6 +1646,9 @@ static void domain_dump_evtchn_info(struct domain *d)
         evtchn_port_print_state(d, chn);
         printk("]: s=%d n=%d x=%d",
                chn->state, chn->notify_vcpu_id, chn->xen_consumer);
+        if ( chn->moderation && chn->moderation->max_events )
+            printk(" m=%u/%"PRI_stime"us", chn->moderation->max_events,
+                   chn->moderation->interval / MICROSECS(1));
 
         switch ( chn->state )
         {
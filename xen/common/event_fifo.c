@@ -402,6 +402,7 @@ static void init_queue(struct vcpu *v, struct evtchn_fifo_queue *q,
                        unsigned int i)
 {
     spin_lock_init(&q->lock);
+    spin_lock_set_class(&q->lock, LOCK_CLASS_EVENT);
     q->priority = i;
 }
 
@@ -1793,7 +1793,10 @@ gnttab_grow_table(struct domain *d, unsigned int req_nr_frames)
             goto active_alloc_failed;
         clear_page(gt->active[i]);
         for ( j = 0; j < ACGNT_PER_PAGE; j++ )
+        {
             spin_lock_init(&gt->active[i][j].lock);
+            spin_lock_set_class(&gt->active[i][j].lock, LOCK_CLASS_GRANT);
+        }
     }
 
     /* Shared */
@@ -1853,7 +1856,9 @@ int grant_table_init(struct domain *d, unsigned int max_grant_frames,
 
     /* Simple stuff. */
     percpu_rwlock_resource_init(&gt->lock, grant_rwlock);
+    percpu_rwlock_set_class(&gt->lock, LOCK_CLASS_GRANT);
     spin_lock_init(&gt->maptrack_lock);
+    spin_lock_set_class(&gt->maptrack_lock, LOCK_CLASS_GRANT);
 
     gt->gt_version = 1;
     gt->max_grant_frames = max_grant_frames;
@@ -3828,6 +3833,7 @@ grant_table_destroy(
 void grant_table_init_vcpu(struct vcpu *v)
 {
     spin_lock_init(&v->maptrack_freelist_lock);
+    spin_lock_set_class(&v->maptrack_freelist_lock, LOCK_CLASS_GRANT);
     v->maptrack_head = MAPTRACK_TAIL;
     v->maptrack_tail = MAPTRACK_TAIL;
 }
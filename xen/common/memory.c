@@ -152,11 +152,33 @@ static void increase_reservation(struct memop_args *a)
     a->nr_done = i;
 }
 
+/*
+ * Number of pages (but at least one extent) entered into a translated
+ * domain's p2m in one go.
+ */
+#define POPULATE_BATCH 32
+
+static void populate_physmap_batch(struct domain *d, const xen_pfn_t *gpfn,
+                                   const mfn_t *mfn, unsigned int nr,
+                                   unsigned int order)
+{
+    unsigned int i;
+
+    p2m_batch_begin(d);
+
+    for ( i = 0; i < nr; i++ )
+        guest_physmap_add_page(d, _gfn(gpfn[i]), mfn[i], order);
+
+    if ( p2m_batch_end(d) )
+        domain_crash(d);
+}
+
 static void populate_physmap(struct memop_args *a)
 {
     struct page_info *page;
-    unsigned int i, j;
-    xen_pfn_t gpfn;
+    unsigned int i, j, nr_batch = 0;
+    xen_pfn_t gpfn, batch_gpfn[POPULATE_BATCH];
+    mfn_t batch_mfn[POPULATE_BATCH];
     struct domain *d = a->domain, *curr_d = current->domain;
     bool need_tlbflush = false;
     uint32_t tlbflush_timestamp = 0;
@@ -266,16 +288,36 @@ static void populate_physmap(struct memop_args *a)
                 mfn = page_to_mfn(page);
             }
 
+            if ( paging_mode_translate(d) )
+            {
+                /*
+                 * Defer the p2m updates, so that the TLB and IOTLB flushes
+                 * they may require are issued once per batch.
+                 */
+                batch_gpfn[nr_batch] = gpfn;
+                batch_mfn[nr_batch] = mfn;
+                if ( (++nr_batch << a->extent_order) >= POPULATE_BATCH )
+                {
+                    populate_physmap_batch(d, batch_gpfn, batch_mfn, nr_batch,
+                                           a->extent_order);
+                    nr_batch = 0;
+                }
+                continue;
+            }
+
             guest_physmap_add_page(d, _gfn(gpfn), mfn, a->extent_order);
 
-            if ( !paging_mode_translate(d) &&
-                 /* Inform the domain of the new page's machine address. */
-                 unlikely(__copy_mfn_to_guest_offset(a->extent_list, i, mfn)) )
+            /* Inform the domain of the new page's machine address. */
+            if ( unlikely(__copy_mfn_to_guest_offset(a->extent_list, i, mfn)) )
                 goto out;
         }
     }
 
 out:
+    if ( nr_batch )
+        populate_physmap_batch(d, batch_gpfn, batch_mfn, nr_batch,
+                               a->extent_order);
+
     if ( need_tlbflush )
         filtered_flush_tlb_mask(tlbflush_timestamp);
 
@@ -691,9 +733,11 @@ static long memory_exchange(XEN_GUEST_HANDLE_PARAM(xen_memory_exchange_t) arg)
         /*
          * These pages have already had owner and reference cleared.
          * Do the final two steps: Remove from the physmap, and free
-         * them.
+         * them.  The removals are batched, so that stale translations
+         * get flushed once, before any of the pages is freed.
          */
-        while ( (page = page_list_remove_head(&in_chunk_list)) )
+        p2m_batch_begin(d);
+        page_list_for_each ( page, &in_chunk_list )
         {
             unsigned long gfn;
 
@@ -703,8 +747,12 @@ static long memory_exchange(XEN_GUEST_HANDLE_PARAM(xen_memory_exchange_t) arg)
             BUG_ON(SHARED_M2P(gfn));
             if ( guest_physmap_remove_page(d, _gfn(gfn), mfn, 0) )
                 domain_crash(d);
-            free_domheap_page(page);
         }
+        if ( p2m_batch_end(d) )
+            domain_crash(d);
+
+        while ( (page = page_list_remove_head(&in_chunk_list)) )
+            free_domheap_page(page);
 
         /* Assign each output page to the domain. */
         for ( j = 0; (page = page_list_remove_head(&out_chunk_list)); ++j )
@@ -1079,16 +1127,32 @@ static int acquire_resource(
     if ( xmar.nr_frames > ARRAY_SIZE(mfn_list) )
         return -E2BIG;
 
-    rc = rcu_lock_remote_domain_by_id(xmar.domid, &d);
-    if ( rc )
-        return rc;
+    /* The domain statistics region and profiler rings belong to Xen. */
+    if ( xmar.domid == DOMID_XEN )
+        d = rcu_lock_domain(dom_xen);
+    else
+    {
+        rc = rcu_lock_remote_domain_by_id(xmar.domid, &d);
+        if ( rc )
+            return rc;
+    }
 
     rc = xsm_domain_resource_map(XSM_DM_PRIV, d);
     if ( rc )
         goto out;
 
+    rc = -EINVAL;
+    if ( (d == dom_xen) != (xmar.type == XENMEM_resource_domstats ||
+                            xmar.type == XENMEM_resource_pmuprof) )
+        goto out;
+
     switch ( xmar.type )
     {
+    case XENMEM_resource_domstats:
+        rc = xmar.id ? -EINVAL
+                     : domstats_acquire(xmar.frame, xmar.nr_frames, mfn_list);
+        break;
+
     case XENMEM_resource_grant_table:
         rc = acquire_grant_table(d, xmar.id, xmar.frame, xmar.nr_frames,
                                  mfn_list);
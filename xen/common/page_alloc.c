@@ -453,7 +453,7 @@ static unsigned long node_need_scrub[MAX_NUMNODES];
 static unsigned long *avail[MAX_NUMNODES];
 static long total_avail_pages;
 
-static DEFINE_SPINLOCK(heap_lock);
+static DEFINE_SPINLOCK_CLASS(heap_lock, LOCK_CLASS_HEAP);
 static long outstanding_claims; /* total outstanding claims by all domains */
 
 unsigned long domain_adjust_tot_pages(struct domain *d, long pages)
@@ -756,6 +756,9 @@ static void page_list_add_scrub(struct page_info *pg, unsigned int node,
 #endif
 #define SCRUB_BYTE_PATTERN   (SCRUB_PATTERN & 0xff)
 
+/* Pages scrubbed on allocation per acquisition of the heap lock. */
+#define ALLOC_SCRUB_BATCH    512U
+
 static void poison_one_page(struct page_info *pg)
 {
 #ifdef CONFIG_SCRUB_DEBUG
@@ -922,7 +925,7 @@ static struct page_info *alloc_heap_pages(
     struct page_info *pg;
     bool need_tlbflush = false;
     uint32_t tlbflush_timestamp = 0;
-    unsigned int dirty_cnt = 0;
+    unsigned int dirty_cnt;
 
     /* Make sure there are enough bits in memflags for nodeID. */
     BUILD_BUG_ON((_MEMF_bits - _MEMF_node) < (8 * sizeof(nodeid_t)));
@@ -1033,26 +1036,37 @@ static struct page_info *alloc_heap_pages(
     if ( first_dirty != INVALID_DIRTY_IDX ||
          (scrub_debug && !(memflags & MEMF_no_scrub)) )
     {
-        for ( i = 0; i < (1U << order); i++ )
+        unsigned int start, end;
+
+        /*
+         * Only take the heap lock once per batch to clear PGC_need_scrub,
+         * so that concurrent large allocations (e.g. populating a big guest
+         * from several threads) don't serialise on it for every page.
+         */
+        for ( start = 0; start < (1U << order); start = end )
         {
-            if ( test_bit(_PGC_need_scrub, &pg[i].count_info) )
-            {
-                if ( !(memflags & MEMF_no_scrub) )
-                    scrub_one_page(&pg[i]);
+            end = min(start + ALLOC_SCRUB_BATCH, 1U << order);
+            dirty_cnt = 0;
 
-                dirty_cnt++;
+            for ( i = start; i < end; i++ )
+            {
+                if ( test_bit(_PGC_need_scrub, &pg[i].count_info) )
+                {
+                    if ( !(memflags & MEMF_no_scrub) )
+                        scrub_one_page(&pg[i]);
 
-                spin_lock(&heap_lock);
-                pg[i].count_info &= ~PGC_need_scrub;
-                spin_unlock(&heap_lock);
+                    dirty_cnt++;
+                }
+                else if ( !(memflags & MEMF_no_scrub) )
+                    check_one_page(&pg[i]);
             }
-            else if ( !(memflags & MEMF_no_scrub) )
-                check_one_page(&pg[i]);
-        }
 
-        if ( dirty_cnt )
-        {
+            if ( !dirty_cnt )
+                continue;
+
             spin_lock(&heap_lock);
+            for ( i = start; i < end; i++ )
+                pg[i].count_info &= ~PGC_need_scrub;
             node_need_scrub[node] -= dirty_cnt;
             spin_unlock(&heap_lock);
         }
@@ -2258,6 +2272,18 @@ int assign_pages(
     int rc = 0;
     unsigned long i;
 
+    /*
+     * Touch the page_info structures before taking the lock, so that
+     * concurrent populate requests for a large domain aren't serialised on
+     * the cache misses.  Nobody can take a reference while the count is 0.
+     */
+    for ( i = 0; i < (1 << order); i++ )
+    {
+        ASSERT(page_get_owner(&pg[i]) == NULL);
+        ASSERT(!pg[i].count_info);
+        page_set_owner(&pg[i], d);
+    }
+
     spin_lock(&d->page_alloc_lock);
 
     if ( unlikely(d->is_dying) )
@@ -2283,18 +2309,20 @@ int assign_pages(
             get_knownalive_domain(d);
     }
 
+    smp_wmb(); /* Domain pointer must be visible before updating refcnt. */
     for ( i = 0; i < (1 << order); i++ )
     {
-        ASSERT(page_get_owner(&pg[i]) == NULL);
-        ASSERT(!pg[i].count_info);
-        page_set_owner(&pg[i], d);
-        smp_wmb(); /* Domain pointer must be visible before updating refcnt. */
         pg[i].count_info = PGC_allocated | 1;
         page_list_add_tail(&pg[i], &d->page_list);
     }
 
  out:
     spin_unlock(&d->page_alloc_lock);
+
+    if ( rc )
+        for ( i = 0; i < (1 << order); i++ )
+            page_set_owner(&pg[i], NULL);
+
     return rc;
 }
 
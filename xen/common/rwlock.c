@@ -25,6 +25,7 @@ static inline void rspin_until_writer_unlock(rwlock_t *lock, u32 cnts)
  */
 void queue_read_lock_slowpath(rwlock_t *lock)
 {
+    s_time_t start = unlikely(lockstat_enabled) ? NOW() : 0;
     u32 cnts;
 
     /*
@@ -54,6 +55,10 @@ void queue_read_lock_slowpath(rwlock_t *lock)
      * Signal the next one in queue to become queue head.
      */
     spin_unlock(&lock->lock);
+
+    if ( unlikely(start) )
+        lockstat_rwlock_contended(lock->lock.lock_class, start,
+                                  __builtin_return_address(0));
 }
 
 /*
@@ -62,6 +67,7 @@ void queue_read_lock_slowpath(rwlock_t *lock)
  */
 void queue_write_lock_slowpath(rwlock_t *lock)
 {
+    s_time_t start = unlikely(lockstat_enabled) ? NOW() : 0;
     u32 cnts;
 
     /* Put the writer into the wait queue. */
@@ -100,6 +106,10 @@ void queue_write_lock_slowpath(rwlock_t *lock)
     }
  unlock:
     spin_unlock(&lock->lock);
+
+    if ( unlikely(start) )
+        lockstat_rwlock_contended(lock->lock.lock_class, start,
+                                  __builtin_return_address(0));
 }
 
 
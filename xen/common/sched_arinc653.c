@@ -355,6 +355,7 @@ a653sched_init(struct scheduler *ops)
 
     prv->next_major_frame = 0;
     spin_lock_init(&prv->lock);
+    spin_lock_set_class(&prv->lock, LOCK_CLASS_SCHED);
     INIT_LIST_HEAD(&prv->unit_list);
 
     return 0;
@@ -2213,6 +2213,7 @@ csched_init(struct scheduler *ops)
 
     ops->sched_data = prv;
     spin_lock_init(&prv->lock);
+    spin_lock_set_class(&prv->lock, LOCK_CLASS_SCHED);
     INIT_LIST_HEAD(&prv->active_sdom);
     prv->master = UINT_MAX;
 
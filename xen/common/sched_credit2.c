@@ -411,6 +411,11 @@ integer_param("credit2_cap_period_ms", opt_cap_period);
  *             core of the host. This will happen if the opt_runqueue
  *             parameter is set to 'core';
  *
+ * - per-llc: meaning that there will be one runqueue per each group of
+ *            cores sharing a last level cache (e.g., a CCX on AMD EPYC,
+ *            where one socket has several L3 caches). This will happen
+ *            if the opt_runqueue parameter is set to 'llc';
+ *
  * - per-socket: meaning that there will be one runqueue per each physical
  *               socket (AKA package, which often, but not always, also
  *               matches a NUMA node) of the host; This will happen if
@@ -425,17 +430,20 @@ integer_param("credit2_cap_period_ms", opt_cap_period);
  *           the opt_runqueue parameter is set to 'all'.
  *
  * Depending on the value of opt_runqueue, therefore, cpus that are part of
- * either the same physical core, the same physical socket, the same NUMA
- * node, or just all of them, will be put together to form runqueues.
+ * either the same physical core, the same last level cache, the same
+ * physical socket, the same NUMA node, or just all of them, will be put
+ * together to form runqueues.
  */
 #define OPT_RUNQUEUE_CPU    0
 #define OPT_RUNQUEUE_CORE   1
 #define OPT_RUNQUEUE_SOCKET 2
 #define OPT_RUNQUEUE_NODE   3
 #define OPT_RUNQUEUE_ALL    4
+#define OPT_RUNQUEUE_LLC    5
 static const char *const opt_runqueue_str[] = {
     [OPT_RUNQUEUE_CPU] = "cpu",
     [OPT_RUNQUEUE_CORE] = "core",
+    [OPT_RUNQUEUE_LLC] = "llc",
     [OPT_RUNQUEUE_SOCKET] = "socket",
     [OPT_RUNQUEUE_NODE] = "node",
     [OPT_RUNQUEUE_ALL] = "all"
@@ -469,6 +477,7 @@ struct csched2_runqueue_data {
     unsigned int nr_cpus;      /* How many CPUs are sharing this runqueue    */
     int id;                    /* ID of this runqueue (-1 if invalid)        */
 
+    unsigned int load_seq;     /* Odd while the load fields are updated      */
     int load;                  /* Instantaneous load (num of non-idle units) */
     s_time_t load_last_update; /* Last time average was updated              */
     s_time_t avgload;          /* Decaying queue load                        */
@@ -814,6 +823,7 @@ static void activate_runqueue(struct csched2_private *prv, int rqi)
     INIT_LIST_HEAD(&rqd->svc);
     INIT_LIST_HEAD(&rqd->runq);
     spin_lock_init(&rqd->lock);
+    spin_lock_set_class(&rqd->lock, LOCK_CLASS_SCHED);
 
     __cpumask_set_cpu(rqi, &prv->active_queues);
 }
@@ -847,6 +857,12 @@ static inline bool same_core(unsigned int cpua, unsigned int cpub)
            cpu_to_core(cpua) == cpu_to_core(cpub);
 }
 
+static inline bool same_llc(unsigned int cpua, unsigned int cpub)
+{
+    return same_socket(cpua, cpub) &&
+           cpu_to_llc(cpua) == cpu_to_llc(cpub);
+}
+
 static unsigned int
 cpu_to_runqueue(struct csched2_private *prv, unsigned int cpu)
 {
@@ -883,6 +899,7 @@ cpu_to_runqueue(struct csched2_private *prv, unsigned int cpu)
             continue;
         if ( opt_runqueue == OPT_RUNQUEUE_ALL ||
              (opt_runqueue == OPT_RUNQUEUE_CORE && same_core(peer_cpu, cpu)) ||
+             (opt_runqueue == OPT_RUNQUEUE_LLC && same_llc(peer_cpu, cpu)) ||
              (opt_runqueue == OPT_RUNQUEUE_SOCKET && same_socket(peer_cpu, cpu)) ||
              (opt_runqueue == OPT_RUNQUEUE_NODE && same_node(peer_cpu, cpu)) )
             break;
@@ -939,6 +956,62 @@ static void update_max_weight(struct csched2_runqueue_data *rqd, int new_weight,
     }
 }
 
+/*
+ * The load fields of a runqueue are only ever updated with the runqueue
+ * lock held, but they are read locklessly when picking a runqueue or
+ * looking for one to balance with, so that the lock of a busy runqueue is
+ * not bounced around by every other pCPU just to sample its load.
+ *
+ * Updates are enclosed in runq_load_write_{begin,end}(), which make
+ * load_seq odd for their duration; readers use runq_load_read() to get
+ * a consistent snapshot.
+ */
+static inline void runq_load_write_begin(struct csched2_runqueue_data *rqd)
+{
+    write_atomic(&rqd->load_seq, rqd->load_seq + 1);
+    smp_wmb();
+}
+
+static inline void runq_load_write_end(struct csched2_runqueue_data *rqd)
+{
+    smp_wmb();
+    write_atomic(&rqd->load_seq, rqd->load_seq + 1);
+}
+
+/*
+ * Return the balancing load of rqd, decayed up to now, without holding
+ * its lock.
+ */
+static s_time_t
+runq_load_read(const struct csched2_private *prv,
+               const struct csched2_runqueue_data *rqd, s_time_t now)
+{
+    unsigned int seq, P = prv->load_precision_shift;
+    unsigned int W = prv->load_window_shift;
+    s_time_t delta, b_avgload, last_update;
+    int load;
+
+    do {
+        seq = read_atomic(&rqd->load_seq);
+        smp_rmb();
+        load = read_atomic(&rqd->load);
+        b_avgload = read_atomic(&rqd->b_avgload);
+        last_update = read_atomic(&rqd->load_last_update);
+        smp_rmb();
+    } while ( unlikely(seq & 1) || seq != read_atomic(&rqd->load_seq) );
+
+    now >>= LOADAVG_GRANULARITY_SHIFT;
+
+    if ( last_update + (1ULL << W) < now )
+        return (s_time_t)load << P;
+
+    /* The owner may have updated the load with a later timestamp. */
+    delta = max_t(s_time_t, now - last_update, 0);
+
+    return b_avgload + ((delta * ((s_time_t)load << P)) >> W) -
+           ((delta * b_avgload) >> W);
+}
+
 /* Add and remove from runqueue assignment (not active run queue) */
 static void
 _runq_assign(struct csched2_unit *svc, struct csched2_runqueue_data *rqd)
@@ -950,7 +1023,9 @@ _runq_assign(struct csched2_unit *svc, struct csched2_runqueue_data *rqd)
     update_max_weight(svc->rqd, svc->weight, 0);
 
     /* Expected new load based on adding this unit */
+    runq_load_write_begin(rqd);
     rqd->b_avgload += svc->avgload;
+    runq_load_write_end(rqd);
 
     if ( unlikely(tb_init_done) )
     {
@@ -990,7 +1065,9 @@ _runq_deassign(struct csched2_unit *svc)
     update_max_weight(rqd, 0, svc->weight);
 
     /* Expected new load based on removing this unit */
+    runq_load_write_begin(rqd);
     rqd->b_avgload = max_t(s_time_t, rqd->b_avgload - svc->avgload, 0);
+    runq_load_write_end(rqd);
 
     svc->rqd = NULL;
 }
@@ -1142,6 +1219,8 @@ update_runq_load(const struct scheduler *ops,
      *  avgload_0' = P*load
      */
 
+    runq_load_write_begin(rqd);
+
     if ( rqd->load_last_update + (1ULL << W)  < now )
     {
         rqd->avgload = load << P;
@@ -1178,6 +1257,8 @@ update_runq_load(const struct scheduler *ops,
     rqd->load += change;
     rqd->load_last_update = now;
 
+    runq_load_write_end(rqd);
+
     /* Overflow, capable of making the load look negative, must not occur. */
     ASSERT(rqd->avgload >= 0 && rqd->b_avgload >= 0);
 
@@ -2208,6 +2289,7 @@ csched2_res_pick(const struct scheduler *ops, const struct sched_unit *unit)
     unsigned int new_cpu, cpu = sched_unit_master(unit);
     struct csched2_unit *svc = csched2_unit(unit);
     s_time_t min_avgload = MAX_LOAD, min_s_avgload = MAX_LOAD;
+    s_time_t now = NOW();
     bool has_soft;
 
     ASSERT(!cpumask_empty(&prv->active_queues));
@@ -2218,8 +2300,8 @@ csched2_res_pick(const struct scheduler *ops, const struct sched_unit *unit)
      * - Runqueue lock of vc->processor is already locked
      * - Need to grab prv lock to make sure active runqueues don't
      *   change
-     * - Need to grab locks for other runqueues while checking
-     *   avgload
+     * - Other runqueues' avgload is sampled without their locks
+     *   (see runq_load_read())
      * Locking constraint is:
      * - Lock prv before runqueue locks
      * - Trylock between runqueue locks (no ordering)
@@ -2307,22 +2389,17 @@ csched2_res_pick(const struct scheduler *ops, const struct sched_unit *unit)
             continue;
 
         /*
-         * If checking a different runqueue, grab the lock, read the avg,
-         * and then release the lock.
+         * If checking a different runqueue, sample its load locklessly.
          *
-         * If on our own runqueue, don't grab or release the lock;
-         * but subtract our own load from the runqueue load to simulate
-         * impartiality.
+         * If on our own runqueue, subtract our own load from the runqueue
+         * load to simulate impartiality.
          */
         if ( rqd == svc->rqd )
         {
             rqd_avgload = max_t(s_time_t, rqd->b_avgload - svc->avgload, 0);
         }
-        else if ( spin_trylock(&rqd->lock) )
-        {
-            rqd_avgload = rqd->b_avgload;
-            spin_unlock(&rqd->lock);
-        }
+        else
+            rqd_avgload = runq_load_read(prv, rqd, now);
 
         /*
          * if svc has a soft-affinity, and some cpus of rqd are part of it,
@@ -2559,6 +2636,7 @@ static void balance_load(const struct scheduler *ops, int cpu, s_time_t now)
     int i, max_delta_rqi;
     struct list_head *push_iter, *pull_iter;
     bool inner_load_updated = 0;
+    s_time_t orqd_load = 0;
 
     balance_state_t st = { .best_push_svc = NULL, .best_pull_svc = NULL };
 
@@ -2583,17 +2661,15 @@ retry:
 
     for_each_cpu(i, &prv->active_queues)
     {
-        s_time_t delta;
+        s_time_t delta, load;
 
-        st.orqd = prv->rqd + i;
-
-        if ( st.orqd == st.lrqd
-             || !spin_trylock(&st.orqd->lock) )
+        if ( prv->rqd + i == st.lrqd )
             continue;
 
-        update_runq_load(ops, st.orqd, 0, now);
+        /* Sample the load without taking the other runqueue's lock. */
+        load = runq_load_read(prv, prv->rqd + i, now);
 
-        delta = st.lrqd->b_avgload - st.orqd->b_avgload;
+        delta = st.lrqd->b_avgload - load;
         if ( delta < 0 )
             delta = -delta;
 
@@ -2601,9 +2677,8 @@ retry:
         {
             st.load_delta = delta;
             max_delta_rqi = i;
+            orqd_load = load;
         }
-
-        spin_unlock(&st.orqd->lock);
     }
 
     /* Minimize holding the private scheduler lock. */
@@ -2616,9 +2691,11 @@ retry:
         int cpus_max;
 
 
+        st.orqd = prv->rqd + max_delta_rqi;
+
         load_max = st.lrqd->b_avgload;
-        if ( st.orqd->b_avgload > load_max )
-            load_max = st.orqd->b_avgload;
+        if ( orqd_load > load_max )
+            load_max = orqd_load;
 
         cpus_max = st.lrqd->nr_cpus;
         i = st.orqd->nr_cpus;
@@ -2667,6 +2744,8 @@ retry:
     if ( unlikely(st.orqd->id < 0) )
         goto out_up;
 
+    update_runq_load(ops, st.orqd, 0, now);
+
     if ( unlikely(tb_init_done) )
     {
         struct {
@@ -4047,6 +4126,7 @@ csched2_init(struct scheduler *ops)
     ops->sched_data = prv;
 
     rwlock_init(&prv->lock);
+    rwlock_set_class(&prv->lock, LOCK_CLASS_SCHED);
     INIT_LIST_HEAD(&prv->sdom);
 
     /* Allocate all runqueues and mark them as un-initialized */
@@ -143,7 +143,9 @@ static int null_init(struct scheduler *ops)
         return -ENOMEM;
 
     spin_lock_init(&prv->lock);
+    spin_lock_set_class(&prv->lock, LOCK_CLASS_SCHED);
     spin_lock_init(&prv->waitq_lock);
+    spin_lock_set_class(&prv->waitq_lock, LOCK_CLASS_SCHED);
     INIT_LIST_HEAD(&prv->ndom);
     INIT_LIST_HEAD(&prv->waitq);
 
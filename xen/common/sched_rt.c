@@ -670,6 +670,7 @@ rt_init(struct scheduler *ops)
         goto err;
 
     spin_lock_init(&prv->lock);
+    spin_lock_set_class(&prv->lock, LOCK_CLASS_SCHED);
     INIT_LIST_HEAD(&prv->sdom);
     INIT_LIST_HEAD(&prv->runq);
     INIT_LIST_HEAD(&prv->depletedq);
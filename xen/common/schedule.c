@@ -85,6 +85,19 @@ DEFINE_PER_CPU(cpumask_t, cpumask_scratch);
 /* How many urgent vcpus. */
 DEFINE_PER_CPU(atomic_t, sched_urgent_count);
 
+/*
+ * Scheduling latency statistics, see XEN_SYSCTL_sched_latency.  They are
+ * kept per vcpu and per pCPU, and are updated on runstate changes with the
+ * scheduling lock of the vcpu's resource held.
+ */
+struct sched_latency {
+    struct xen_sysctl_sched_latency_stats stats;
+    unsigned int last_cpu;  /* pCPU the vcpu ran on last (or nr_cpu_ids). */
+    bool woken;             /* Runnable due to a wakeup, not a preemption. */
+};
+
+static DEFINE_PER_CPU(struct xen_sysctl_sched_latency_stats, sched_latency);
+
 extern const struct scheduler *__start_schedulers_array[], *__end_schedulers_array[];
 #define NUM_SCHEDULERS (__end_schedulers_array - __start_schedulers_array)
 #define schedulers __start_schedulers_array
@@ -257,6 +270,55 @@ static inline void vcpu_urgent_count_update(struct vcpu *v)
     }
 }
 
+static inline unsigned int sched_latency_bucket(s_time_t delta)
+{
+    unsigned int b = delta > 0 ? fls64(delta) : 0;
+
+    return b <= 10 ? 0 : min(b - 10, XEN_SYSCTL_SCHED_LATENCY_BUCKETS - 1u);
+}
+
+static void sched_latency_update(struct vcpu *v, int new_state,
+                                 s_time_t delta)
+{
+    struct sched_latency *lat = v->sched_latency;
+    struct xen_sysctl_sched_latency_stats *pcpu =
+        &per_cpu(sched_latency, v->processor);
+    unsigned int b = sched_latency_bucket(delta);
+
+    switch ( v->runstate.state )
+    {
+    case RUNSTATE_running:
+        lat->stats.run_slice[b]++;
+        pcpu->run_slice[b]++;
+        break;
+
+    case RUNSTATE_runnable:
+        if ( new_state == RUNSTATE_running && lat->woken )
+        {
+            lat->stats.wake_to_run[b]++;
+            pcpu->wake_to_run[b]++;
+        }
+        break;
+    }
+
+    switch ( new_state )
+    {
+    case RUNSTATE_runnable:
+        lat->woken = v->runstate.state != RUNSTATE_running;
+        break;
+
+    case RUNSTATE_running:
+        if ( lat->last_cpu != v->processor && lat->last_cpu < nr_cpu_ids )
+        {
+            lat->stats.migrations++;
+            pcpu->migrations++;
+        }
+        lat->last_cpu = v->processor;
+        lat->woken = false;
+        break;
+    }
+}
+
 static inline void vcpu_runstate_change(
     struct vcpu *v, int new_state, s_time_t new_entry_time)
 {
@@ -284,6 +346,9 @@ static inline void vcpu_runstate_change(
         v->runstate.state_entry_time = new_entry_time;
     }
 
+    if ( v->sched_latency )
+        sched_latency_update(v, new_state, delta);
+
     v->runstate.state = new_state;
 }
 
@@ -525,8 +590,18 @@ int sched_init_vcpu(struct vcpu *v)
     struct sched_unit *unit;
     unsigned int processor;
 
+    if ( !is_idle_domain(d) )
+    {
+        if ( (v->sched_latency = xzalloc(struct sched_latency)) == NULL )
+            return 1;
+        v->sched_latency->last_cpu = nr_cpu_ids;
+    }
+
     if ( (unit = sched_alloc_unit(v)) == NULL )
+    {
+        XFREE(v->sched_latency);
         return 1;
+    }
 
     if ( is_idle_domain(d) )
         processor = v->vcpu_id;
@@ -556,6 +631,7 @@ int sched_init_vcpu(struct vcpu *v)
     {
         sched_free_unit(unit, v);
         rcu_read_unlock(&sched_res_rculock);
+        XFREE(v->sched_latency);
         return 1;
     }
 
@@ -743,6 +819,8 @@ void sched_destroy_vcpu(struct vcpu *v)
 
         rcu_read_unlock(&sched_res_rculock);
     }
+
+    XFREE(v->sched_latency);
 }
 
 int sched_init_domain(struct domain *d, int poolid)
@@ -1854,6 +1932,86 @@ long sched_adjust_global(struct xen_sysctl_scheduler_op *op)
     return rc;
 }
 
+static void sched_latency_add(struct xen_sysctl_sched_latency_stats *sum,
+                              const struct xen_sysctl_sched_latency_stats *s)
+{
+    unsigned int i;
+
+    for ( i = 0; i < XEN_SYSCTL_SCHED_LATENCY_BUCKETS; i++ )
+    {
+        sum->wake_to_run[i] += s->wake_to_run[i];
+        sum->run_slice[i] += s->run_slice[i];
+    }
+    sum->migrations += s->migrations;
+}
+
+/*
+ * Statistics are read and reset without the scheduling locks: they are
+ * plain counters, and a concurrently updated bucket being off by one is of
+ * no concern.
+ */
+int sched_latency_op(struct xen_sysctl_sched_latency *op)
+{
+    struct xen_sysctl_sched_latency_stats stats = {};
+    struct domain *d;
+    struct vcpu *v;
+    unsigned int cpu;
+    bool online;
+
+    if ( op->pad )
+        return -EINVAL;
+
+    switch ( op->cmd )
+    {
+    case XEN_SYSCTL_SCHED_LATENCY_get:
+        switch ( op->type )
+        {
+        case XEN_SYSCTL_SCHED_LATENCY_cpu:
+            if ( !get_cpu_maps() )
+                return -EBUSY;
+            online = op->id < nr_cpu_ids && cpu_online(op->id);
+            if ( online )
+                stats = per_cpu(sched_latency, op->id);
+            put_cpu_maps();
+            if ( !online )
+                return -EINVAL;
+            break;
+
+        case XEN_SYSCTL_SCHED_LATENCY_domain:
+            if ( (d = rcu_lock_domain_by_id(op->id)) == NULL )
+                return -ESRCH;
+            for_each_vcpu ( d, v )
+                if ( v->sched_latency )
+                    sched_latency_add(&stats, &v->sched_latency->stats);
+            rcu_unlock_domain(d);
+            break;
+
+        default:
+            return -EINVAL;
+        }
+
+        return copy_to_guest(op->stats, &stats, 1) ? -EFAULT : 0;
+
+    case XEN_SYSCTL_SCHED_LATENCY_reset:
+        if ( !get_cpu_maps() )
+            return -EBUSY;
+        for_each_online_cpu ( cpu )
+            memset(&per_cpu(sched_latency, cpu), 0, sizeof(stats));
+        put_cpu_maps();
+
+        rcu_read_lock(&domlist_read_lock);
+        for_each_domain ( d )
+            for_each_vcpu ( d, v )
+                if ( v->sched_latency )
+                    memset(&v->sched_latency->stats, 0, sizeof(stats));
+        rcu_read_unlock(&domlist_read_lock);
+
+        return 0;
+    }
+
+    return -EINVAL;
+}
+
 static void vcpu_periodic_timer_work_locked(struct vcpu *v)
 {
     s_time_t now;
@@ -2325,6 +2483,29 @@ static void sched_slave(void)
         do_softirq = true;
     }
 
+    /*
+     * Another cpu of the resource has switched it from the idle unit to
+     * a new one without a rendezvous (see schedule()): join it.
+     */
+    if ( unlikely(prev != get_sched_res(cpu)->curr) )
+    {
+        next = get_sched_res(cpu)->curr;
+
+        ASSERT(is_idle_unit(prev) && !prev->rendezvous_in_cnt);
+
+        pcpu_schedule_unlock_irq(lock, cpu);
+
+        /* A wakeup might have been signalled to us in between. */
+        v = unit2vcpu_cpu(next, cpu);
+        if ( v && v->force_context_switch )
+            raise_softirq(SCHED_SLAVE_SOFTIRQ);
+
+        sched_context_switch(vprev, sched_unit2vcpu_cpu(next, cpu), false,
+                             now);
+
+        return;
+    }
+
     if ( !prev->rendezvous_in_cnt )
     {
         pcpu_schedule_unlock_irq(lock, cpu);
@@ -2376,11 +2557,13 @@ static void schedule(void)
 
     lock = pcpu_schedule_lock_irq(cpu);
 
-    if ( prev->rendezvous_in_cnt )
+    if ( prev->rendezvous_in_cnt || unlikely(gran > 1 && prev != sr->curr) )
     {
         /*
          * We have a race: sched_slave() should be called, so raise a softirq
          * in order to re-enter schedule() later and call sched_slave() now.
+         * This includes the case of another cpu of the resource having
+         * switched away from the idle unit without us.
          */
         pcpu_schedule_unlock_irq(lock, cpu);
 
@@ -2394,7 +2577,31 @@ static void schedule(void)
 
     now = NOW();
 
-    if ( gran > 1 )
+    if ( gran > 1 && is_idle_unit(prev) && likely(scheduler_active) )
+    {
+        /*
+         * All cpus of the resource are idle, so none of them can be in guest
+         * context: take the scheduling decision without waiting for them.
+         * If a new unit has been selected, the other cpus are kicked and will
+         * join the context switch from sched_slave().  If idle keeps running
+         * they aren't disturbed at all, so there is nobody to rendezvous
+         * with on exit either.
+         */
+        SCHED_STAT_CRANK(sched_rdv_idle);
+        prev->rendezvous_in_cnt = 0;
+        next = do_schedule(prev, now, cpu);
+        if ( next == prev )
+            atomic_set(&next->rendezvous_out_cnt, 0);
+        else
+        {
+            cpumask_t mask;
+
+            atomic_set(&next->rendezvous_out_cnt, gran + 1);
+            cpumask_andnot(&mask, sr->cpus, cpumask_of(cpu));
+            cpumask_raise_softirq(&mask, SCHED_SLAVE_SOFTIRQ);
+        }
+    }
+    else if ( gran > 1 )
     {
         cpumask_t mask;
 
@@ -2478,6 +2685,7 @@ static int cpu_schedule_up(unsigned int cpu)
 
     sr->scheduler = &sched_idle_ops;
     spin_lock_init(&sr->_lock);
+    spin_lock_set_class(&sr->_lock, LOCK_CLASS_SCHED);
     sr->schedule_lock = &sched_free_cpu_lock;
     init_timer(&sr->s_timer, s_timer_fn, NULL, cpu);
     atomic_set(&per_cpu(sched_urgent_count, cpu), 0);
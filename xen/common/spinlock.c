@@ -1,10 +1,13 @@
 #include <xen/lib.h>
+#include <xen/init.h>
 #include <xen/irq.h>
 #include <xen/smp.h>
 #include <xen/time.h>
 #include <xen/spinlock.h>
 #include <xen/guest_access.h>
+#include <xen/percpu.h>
 #include <xen/preempt.h>
+#include <xen/symbols.h>
 #include <public/sysctl.h>
 #include <asm/processor.h>
 #include <asm/atomic.h>
@@ -153,9 +156,19 @@ static always_inline u16 observe_head(spinlock_tickets_t *t)
     return read_atomic(&t->head);
 }
 
-void inline _spin_lock_cb(spinlock_t *lock, void (*cb)(void *), void *data)
+static void lockstat_contended(spinlock_t *lock, s_time_t start,
+                               const void *caller);
+static void lockstat_release(spinlock_t *lock);
+
+/*
+ * Inlined into each of the _spin_lock*() entry points, so that the return
+ * address is where the lock was taken from.
+ */
+static always_inline void spin_lock_common(spinlock_t *lock,
+                                           void (*cb)(void *), void *data)
 {
     spinlock_tickets_t tickets = SPINLOCK_TICKET_INC;
+    s_time_t wait = 0;
     LOCK_PROFILE_VAR;
 
     check_lock(&lock->debug);
@@ -164,6 +177,8 @@ void inline _spin_lock_cb(spinlock_t *lock, void (*cb)(void *), void *data)
     while ( tickets.tail != observe_head(&lock->tickets) )
     {
         LOCK_PROFILE_BLOCK;
+        if ( unlikely(lockstat_enabled) && !wait )
+            wait = NOW();
         if ( unlikely(cb) )
             cb(data);
         arch_lock_relax();
@@ -172,18 +187,25 @@ void inline _spin_lock_cb(spinlock_t *lock, void (*cb)(void *), void *data)
     LOCK_PROFILE_GOT;
     preempt_disable();
     arch_lock_acquire_barrier();
+    if ( unlikely(wait) )
+        lockstat_contended(lock, wait, __builtin_return_address(0));
+}
+
+void _spin_lock_cb(spinlock_t *lock, void (*cb)(void *), void *data)
+{
+    spin_lock_common(lock, cb, data);
 }
 
 void _spin_lock(spinlock_t *lock)
 {
-     _spin_lock_cb(lock, NULL, NULL);
+    spin_lock_common(lock, NULL, NULL);
 }
 
 void _spin_lock_irq(spinlock_t *lock)
 {
     ASSERT(local_irq_is_enabled());
     local_irq_disable();
-    _spin_lock(lock);
+    spin_lock_common(lock, NULL, NULL);
 }
 
 unsigned long _spin_lock_irqsave(spinlock_t *lock)
@@ -191,7 +213,7 @@ unsigned long _spin_lock_irqsave(spinlock_t *lock)
     unsigned long flags;
 
     local_irq_save(flags);
-    _spin_lock(lock);
+    spin_lock_common(lock, NULL, NULL);
     return flags;
 }
 
@@ -200,6 +222,8 @@ void _spin_unlock(spinlock_t *lock)
     arch_lock_release_barrier();
     preempt_enable();
     LOCK_PROFILE_REL;
+    if ( unlikely(lock->lockstat_held) )
+        lockstat_release(lock);
     rel_lock(&lock->debug);
     add_sized(&lock->tickets.head, 1);
     arch_lock_signal();
@@ -312,7 +336,7 @@ void _spin_lock_recursive(spinlock_t *lock)
 
     if ( likely(lock->recurse_cpu != cpu) )
     {
-        _spin_lock(lock);
+        spin_lock_common(lock, NULL, NULL);
         lock->recurse_cpu = cpu;
     }
 
@@ -516,3 +540,309 @@ static int __init lock_prof_init(void)
 __initcall(lock_prof_init);
 
 #endif /* CONFIG_DEBUG_LOCK_PROFILE */
+
+/*
+ * Lock contention statistics, per class of locks.
+ *
+ * Uncontended acquisitions never get here: spin_lock_common() only reads
+ * lockstat_enabled while waiting, and _spin_unlock() tests a flag in the
+ * lock itself.  Statistics are kept per pCPU and summed when queried.
+ */
+
+#define LOCKSTAT_HELD_NR 4
+
+struct lockstat_class {
+    uint64_t contended;
+    uint64_t wait_time;
+    uint64_t wait_max;
+    uint64_t hold_cnt;
+    uint64_t hold_time;
+    uint64_t hold_max;
+    uint64_t wait_hist[XEN_LOCKSTAT_BUCKETS];
+    struct {
+        unsigned long addr;
+        uint64_t count;
+    } callsite[XEN_LOCKSTAT_CALLSITES];
+};
+
+struct lockstat_cpu {
+    struct lockstat_class class[LOCK_CLASS_NR];
+    unsigned int skip;          /* Contended acquisitions not to record. */
+    /* Spinlocks held by this pCPU whose hold time is being measured. */
+    unsigned int nr_held;
+    struct {
+        const spinlock_t *lock;
+        s_time_t since;
+    } held[LOCKSTAT_HELD_NR];
+};
+
+static DEFINE_PER_CPU(struct lockstat_cpu, lockstat);
+
+bool __read_mostly lockstat_enabled;
+static unsigned int __read_mostly lockstat_sample = 1;
+static s_time_t lockstat_start;
+
+static bool __initdata opt_lockstat;
+boolean_param("lockstat", opt_lockstat);
+
+static unsigned int lockstat_bucket(s_time_t t)
+{
+    unsigned int b = t < 256 ? 0 : flsl(t) - 8;
+
+    return min(b, XEN_LOCKSTAT_BUCKETS - 1u);
+}
+
+/*
+ * Count a contended acquisition from addr.  When the table is full, the
+ * least counted call site is replaced and its count inherited (Space-Saving),
+ * so that counts are over-estimated rather than the heavy hitters lost.
+ */
+static void lockstat_callsite(struct lockstat_class *c, unsigned long addr)
+{
+    unsigned int i, min = 0;
+
+    for ( i = 0; i < ARRAY_SIZE(c->callsite); i++ )
+    {
+        if ( c->callsite[i].addr == addr )
+        {
+            c->callsite[i].count++;
+            return;
+        }
+        if ( c->callsite[i].count < c->callsite[min].count )
+            min = i;
+    }
+
+    c->callsite[min].addr = addr;
+    c->callsite[min].count++;
+}
+
+/* Record a wait; called with interrupts disabled. */
+static bool lockstat_wait(struct lockstat_cpu *ls, unsigned int class,
+                          s_time_t wait, const void *caller)
+{
+    struct lockstat_class *c = &ls->class[class];
+
+    if ( ls->skip )
+    {
+        ls->skip--;
+        return false;
+    }
+    ls->skip = lockstat_sample - 1;
+
+    c->contended++;
+    c->wait_time += wait;
+    c->wait_max = max_t(uint64_t, c->wait_max, wait);
+    c->wait_hist[lockstat_bucket(wait)]++;
+    lockstat_callsite(c, (unsigned long)caller);
+
+    return true;
+}
+
+static void lockstat_contended(spinlock_t *lock, s_time_t start,
+                               const void *caller)
+{
+    struct lockstat_cpu *ls;
+    unsigned long flags;
+    s_time_t now;
+
+    /* Waiting for a rwlock is accounted for by the rwlock. */
+    if ( lock->lock_class & LOCK_CLASS_QUEUE )
+        return;
+
+    local_irq_save(flags);
+
+    ls = &this_cpu(lockstat);
+    now = NOW();
+    if ( lockstat_wait(ls, lock->lock_class, now - start, caller) &&
+         ls->nr_held < ARRAY_SIZE(ls->held) )
+    {
+        ls->held[ls->nr_held].lock = lock;
+        ls->held[ls->nr_held].since = now;
+        ls->nr_held++;
+        lock->lockstat_held = true;
+    }
+
+    local_irq_restore(flags);
+}
+
+static void lockstat_release(spinlock_t *lock)
+{
+    struct lockstat_cpu *ls;
+    struct lockstat_class *c;
+    unsigned long flags;
+    unsigned int i;
+    s_time_t hold;
+
+    lock->lockstat_held = false;
+
+    local_irq_save(flags);
+
+    ls = &this_cpu(lockstat);
+    for ( i = ls->nr_held; i--; )
+    {
+        if ( ls->held[i].lock != lock )
+            continue;
+
+        hold = NOW() - ls->held[i].since;
+        c = &ls->class[lock->lock_class];
+        c->hold_cnt++;
+        c->hold_time += hold;
+        c->hold_max = max_t(uint64_t, c->hold_max, hold);
+
+        ls->held[i] = ls->held[--ls->nr_held];
+        break;
+    }
+
+    local_irq_restore(flags);
+}
+
+void lockstat_rwlock_contended(unsigned int class, s_time_t start,
+                               const void *caller)
+{
+    unsigned long flags;
+
+    local_irq_save(flags);
+    lockstat_wait(&this_cpu(lockstat), class & ~LOCK_CLASS_QUEUE,
+                  NOW() - start, caller);
+    local_irq_restore(flags);
+}
+
+static void lockstat_reset(void)
+{
+    unsigned int cpu;
+
+    for_each_online_cpu ( cpu )
+        memset(per_cpu(lockstat, cpu).class, 0,
+               sizeof(per_cpu(lockstat, cpu).class));
+    lockstat_start = NOW();
+}
+
+/* Add src's call sites to dst's, keeping the most contended ones. */
+static void lockstat_merge_callsites(struct xen_sysctl_lockstat_class *dst,
+                                     const struct lockstat_class *src)
+{
+    unsigned int i, j, min;
+
+    for ( i = 0; i < ARRAY_SIZE(src->callsite); i++ )
+    {
+        if ( !src->callsite[i].count )
+            continue;
+
+        for ( j = 0, min = 0; j < ARRAY_SIZE(dst->callsite); j++ )
+        {
+            if ( dst->callsite[j].addr == src->callsite[i].addr )
+                break;
+            if ( dst->callsite[j].count < dst->callsite[min].count )
+                min = j;
+        }
+
+        if ( j < ARRAY_SIZE(dst->callsite) )
+            dst->callsite[j].count += src->callsite[i].count;
+        else if ( dst->callsite[min].count < src->callsite[i].count )
+        {
+            dst->callsite[min].addr = src->callsite[i].addr;
+            dst->callsite[min].count = src->callsite[i].count;
+        }
+    }
+}
+
+static void lockstat_sum(struct xen_sysctl_lockstat_class *out,
+                         unsigned int class)
+{
+    const struct lockstat_class *c;
+    unsigned int cpu, i, j;
+
+    memset(out, 0, sizeof(*out));
+
+    for_each_online_cpu ( cpu )
+    {
+        c = &per_cpu(lockstat, cpu).class[class];
+
+        out->contended += c->contended;
+        out->wait_time += c->wait_time;
+        out->wait_max = max(out->wait_max, c->wait_max);
+        out->hold_cnt += c->hold_cnt;
+        out->hold_time += c->hold_time;
+        out->hold_max = max(out->hold_max, c->hold_max);
+        for ( i = 0; i < ARRAY_SIZE(c->wait_hist); i++ )
+            out->wait_hist[i] += c->wait_hist[i];
+        lockstat_merge_callsites(out, c);
+    }
+
+    /* Most contended first, and named. */
+    for ( i = 1; i < ARRAY_SIZE(out->callsite); i++ )
+        for ( j = i; j && out->callsite[j].count > out->callsite[j - 1].count;
+              j-- )
+        {
+            struct xen_sysctl_lockstat_callsite tmp = out->callsite[j];
+
+            out->callsite[j] = out->callsite[j - 1];
+            out->callsite[j - 1] = tmp;
+        }
+
+    for ( i = 0; i < ARRAY_SIZE(out->callsite) && out->callsite[i].count; i++ )
+    {
+        char namebuf[KSYM_NAME_LEN + 1];
+        unsigned long size, offset;
+        const char *name = symbols_lookup(out->callsite[i].addr, &size,
+                                          &offset, namebuf);
+
+        if ( name )
+            snprintf(out->callsite[i].name, sizeof(out->callsite[i].name),
+                     "%s+%#lx", name, offset);
+    }
+}
+
+int spinlock_lockstat_op(struct xen_sysctl_lockstat_op *op)
+{
+    struct xen_sysctl_lockstat_class stats;
+    unsigned int i;
+
+    switch ( op->cmd )
+    {
+    case XEN_SYSCTL_LOCKSTAT_enable:
+        lockstat_sample = op->sample ?: 1;
+        lockstat_enabled = true;
+        return 0;
+
+    case XEN_SYSCTL_LOCKSTAT_disable:
+        lockstat_enabled = false;
+        return 0;
+
+    case XEN_SYSCTL_LOCKSTAT_reset:
+        lockstat_reset();
+        return 0;
+
+    case XEN_SYSCTL_LOCKSTAT_query:
+        for ( i = 0; i < min(op->nr_classes, LOCK_CLASS_NR + 0u); i++ )
+        {
+            lockstat_sum(&stats, i);
+            if ( copy_to_guest_offset(op->classes, i, &stats, 1) )
+                return -EFAULT;
+        }
+        op->sample = lockstat_sample;
+        op->enabled = lockstat_enabled;
+        op->nr_classes = LOCK_CLASS_NR;
+        op->time = NOW() - lockstat_start;
+        return 0;
+    }
+
+    return -EOPNOTSUPP;
+}
+
+static int __init lockstat_init(void)
+{
+    BUILD_BUG_ON(LOCK_CLASS_NR != XEN_LOCKSTAT_CLASS_NR);
+    BUILD_BUG_ON(LOCK_CLASS_GRANT != XEN_LOCKSTAT_CLASS_grant);
+    BUILD_BUG_ON(LOCK_CLASS_P2M != XEN_LOCKSTAT_CLASS_p2m);
+    BUILD_BUG_ON(LOCK_CLASS_HEAP != XEN_LOCKSTAT_CLASS_heap);
+    BUILD_BUG_ON(LOCK_CLASS_EVENT != XEN_LOCKSTAT_CLASS_event);
+    BUILD_BUG_ON(LOCK_CLASS_SCHED != XEN_LOCKSTAT_CLASS_sched);
+
+    /* Not before now, as NOW() has to work. */
+    lockstat_start = NOW();
+    lockstat_enabled = opt_lockstat;
+
+    return 0;
+}
+__initcall(lockstat_init);
@@ -124,6 +124,11 @@ long do_sysctl(XEN_GUEST_HANDLE_PARAM(xen_sysctl_t) u_sysctl)
         ret = spinlock_profile_control(&op->u.lockprof_op);
         break;
 #endif
+
+    case XEN_SYSCTL_lockstat_op:
+        ret = spinlock_lockstat_op(&op->u.lockstat_op);
+        break;
+
     case XEN_SYSCTL_debug_keys:
     {
         char c;
@@ -247,6 +252,10 @@ long do_sysctl(XEN_GUEST_HANDLE_PARAM(xen_sysctl_t) u_sysctl)
         ret = sched_adjust_global(&op->u.scheduler_op);
         break;
 
+    case XEN_SYSCTL_sched_latency:
+        ret = sched_latency_op(&op->u.sched_latency);
+        break;
+
     case XEN_SYSCTL_physinfo:
     {
         struct xen_sysctl_physinfo *pi = &op->u.physinfo;
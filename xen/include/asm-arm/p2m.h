@@ -217,6 +217,17 @@ static inline int p2m_is_write_locked(struct p2m_domain *p2m)
 
 void p2m_tlb_flush_sync(struct p2m_domain *p2m);
 
+/*
+ * Batching p2m updates buys nothing here: guest_physmap_add_entry() and
+ * friends already defer the TLB flush to p2m_write_unlock().
+ */
+static inline void p2m_batch_begin(struct domain *d) {}
+
+static inline int p2m_batch_end(struct domain *d)
+{
+    return 0;
+}
+
 /* Look up the MFN corresponding to a domain's GFN. */
 mfn_t p2m_lookup(struct domain *d, gfn_t gfn, p2m_type_t *t);
 
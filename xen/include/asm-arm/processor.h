@@ -523,6 +523,7 @@ void show_registers(const struct cpu_user_regs *regs);
 /* All a bit UP for the moment */
 #define cpu_to_core(_cpu)   (0)
 #define cpu_to_socket(_cpu) (0)
+#define cpu_to_llc(_cpu)    (0)
 
 struct vcpu;
 void vcpu_regs_hyp_to_user(const struct vcpu *vcpu,
@@ -108,6 +108,7 @@ struct shadow_domain {
 
     /* Shadow hashtable */
     struct page_info **hash_table;
+    unsigned int hash_buckets;  /* Size of hash_table, a prime */
     bool_t hash_walking;  /* Some function is walking the hash table */
 
     /* Fast MMIO path heuristic */
@@ -141,14 +142,18 @@ struct shadow_vcpu {
     /* Last MFN that we emulated a write successfully */
     unsigned long last_emulated_mfn;
 
-    /* Shadow out-of-sync: pages that this vcpu has let go out of sync */
-    mfn_t oos[SHADOW_OOS_PAGES];
-    mfn_t oos_snapshot[SHADOW_OOS_PAGES];
+    /*
+     * Shadow out-of-sync: pages that this vcpu has let go out of sync.
+     * Arrays of oos_pages entries, allocated with the snapshots.
+     */
+    unsigned int oos_pages;
+    mfn_t *oos;
+    mfn_t *oos_snapshot;
     struct oos_fixup {
         int next;
         mfn_t smfn[SHADOW_OOS_FIXUPS];
         unsigned long off[SHADOW_OOS_FIXUPS];
-    } oos_fixup[SHADOW_OOS_PAGES];
+    } *oos_fixup;
 
     bool_t pagetable_dying;
 #endif
@@ -309,6 +314,10 @@ struct arch_domain
     /* Continuable domain_relinquish_resources(). */
     unsigned int rel_priv;
     struct page_list_head relmem_list;
+    /* Tasklets helping to relinquish memory, see relinquish_parallel(). */
+    struct relmem_worker *relmem_workers;
+    unsigned int nr_relmem_workers;
+    atomic_t relmem_active;
 
     const struct arch_csw {
         void (*from)(struct vcpu *);
@@ -615,6 +624,8 @@ struct arch_vcpu
 
     struct vcpu_msrs *msrs;
 
+    struct hypercall_stats *hcall_stats;
+
     struct {
         bool next_interrupt_enabled;
     } monitor;
@@ -243,6 +243,8 @@ void hvm_domain_destroy(struct domain *d);
 
 int hvm_vcpu_initialise(struct vcpu *v);
 void hvm_vcpu_destroy(struct vcpu *v);
+void hvm_exit_stats_start(struct vcpu *v, unsigned int reason);
+void hvm_exit_stats_stop(struct vcpu *v);
 void hvm_vcpu_down(struct vcpu *v);
 int hvm_vcpu_cacheattr_init(struct vcpu *v);
 void hvm_vcpu_cacheattr_destroy(struct vcpu *v);
@@ -273,6 +275,9 @@ hvm_interrupt_blocked(struct vcpu *v, struct hvm_intack intack);
 
 void hvm_init_hypercall_page(struct domain *d, void *ptr);
 
+int hvm_set_param(struct domain *d, uint32_t index, uint64_t value);
+int hvm_copy_context_and_params(struct domain *dst, struct domain *src);
+
 void hvm_get_segment_register(struct vcpu *v, enum x86_segment seg,
                               struct segment_register *reg);
 void hvm_set_segment_register(struct vcpu *v, enum x86_segment seg,
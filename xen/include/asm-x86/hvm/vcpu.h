@@ -148,6 +148,22 @@ struct altp2mvcpu {
 
 #define vcpu_altp2m(v) ((v)->arch.hvm.avcpu)
 
+/*
+ * Counts of a vCPU's VM exits, and of the TSC cycles spent in Xen from each
+ * of them until the next VM entry or until the vCPU got descheduled, by
+ * exit reason, as reported by XEN_SYSCTL_vmexit_stats.
+ */
+#define HVM_EXIT_STATS_NR       144
+#define HVM_EXIT_STATS_SVM_NPF  142     /* Where VMEXIT_NPF is counted */
+#define HVM_EXIT_STATS_OTHER    143     /* Anything else out of range */
+
+struct hvm_exit_stats {
+    uint64_t count[HVM_EXIT_STATS_NR];
+    uint64_t cycles[HVM_EXIT_STATS_NR];
+    uint64_t start;                     /* TSC at the exit, 0 if none. */
+    unsigned int reason;                /* Its index in the arrays above. */
+};
+
 struct hvm_vcpu {
     /* Guest control-register and EFER values, just as the guest sees them. */
     unsigned long       guest_cr[5];
@@ -205,6 +221,8 @@ struct hvm_vcpu {
     struct x86_event     inject_event;
 
     struct viridian_vcpu *viridian;
+
+    struct hvm_exit_stats *exit_stats;
 };
 
 #endif /* __ASM_X86_HVM_VCPU_H__ */
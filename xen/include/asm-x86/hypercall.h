@@ -25,6 +25,23 @@ typedef struct {
 
 extern const hypercall_args_t hypercall_args_table[NR_hypercalls];
 
+/*
+ * Counts, time and latency histogram of a vCPU's hypercalls, by hypercall
+ * number, as reported by XEN_SYSCTL_hypercall_stats.
+ */
+#define HYPERCALL_STATS_BUCKETS 16
+
+struct hypercall_stats {
+    struct {
+        uint64_t calls;
+        uint64_t preempted;
+        uint64_t time;
+        uint64_t latency[HYPERCALL_STATS_BUCKETS];
+    } op[NR_hypercalls];
+};
+
+void hypercall_stats_account(struct vcpu *v, unsigned int op, s_time_t start);
+
 #ifdef CONFIG_PV
 extern const hypercall_table_t pv_hypercall_table[];
 void pv_hypercall(struct cpu_user_regs *regs);
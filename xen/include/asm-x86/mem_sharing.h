@@ -35,13 +35,6 @@
 
 typedef uint64_t shr_handle_t; 
 
-typedef struct rmap_hashtab {
-    struct list_head *bucket;
-    /* Overlaps with prev pointer of list_head in union below.
-     * Unlike the prev pointer, this can be NULL. */
-    void *flag;
-} rmap_hashtab_t;
-
 struct page_sharing_info
 {
     struct page_info *pg;   /* Back pointer to the page. */
@@ -53,8 +46,10 @@ struct page_sharing_info
     /* Reverse map of <domain,gfn> tuples for this shared frame. */
     union {
         struct list_head    gfns;
-        rmap_hashtab_t      hash_table;
+        struct hlist_head  *buckets;
     };
+    /* log2 of the number of hash buckets, 0 while the rmap is a list. */
+    unsigned int rmap_order;
 };
 
 #define sharing_supported(_d) \
@@ -101,6 +96,16 @@ int mem_sharing_domctl(struct domain *d,
  */
 int relinquish_shared_pages(struct domain *d);
 
+static inline bool mem_sharing_is_fork(const struct domain *d)
+{
+    return d->parent;
+}
+
+/* Populate gfn of fork d from its parent, either by sharing the parent's
+ * page or, if unsharing or sharing isn't possible, with a copy of it.
+ * Called with d's p2m locked. */
+int mem_sharing_fork_page(struct domain *d, gfn_t gfn, bool unsharing);
+
 #else
 
 static inline unsigned int mem_sharing_get_nr_saved_mfns(void)
@@ -125,6 +130,17 @@ static inline int mem_sharing_notify_enomem(struct domain *d, unsigned long gfn,
     return -EOPNOTSUPP;
 }
 
+static inline bool mem_sharing_is_fork(const struct domain *d)
+{
+    return false;
+}
+
+static inline int mem_sharing_fork_page(struct domain *d, gfn_t gfn,
+                                        bool unsharing)
+{
+    return -EOPNOTSUPP;
+}
+
 #endif
 
 #endif /* __MEM_SHARING_H__ */
@@ -303,8 +303,12 @@ struct page_info
 
 #define PRtype_info "016lx"/* should only be used for printk's */
 
-/* The number of out-of-sync shadows we allow per vcpu (prime, please) */
+/*
+ * The number of out-of-sync shadows we allow per vcpu (prime, please): at
+ * least SHADOW_OOS_PAGES, and more for large shadow pools.
+ */
 #define SHADOW_OOS_PAGES 3
+#define SHADOW_OOS_PAGES_MAX 31
 
 /* OOS fixup entries */
 #define SHADOW_OOS_FIXUPS 2
@@ -28,6 +28,7 @@
 
 #include <xen/paging.h>
 #include <xen/mem_access.h>
+#include <xen/tasklet.h>
 #include <asm/mem_sharing.h>
 #include <asm/page.h>    /* for pagetable_t */
 
@@ -256,6 +257,16 @@ struct p2m_domain {
     void               (*enable_hardware_log_dirty)(struct p2m_domain *p2m);
     void               (*disable_hardware_log_dirty)(struct p2m_domain *p2m);
     void               (*flush_hardware_cached_dirty)(struct p2m_domain *p2m);
+    /*
+     * Accessed bit sampling, host p2m only.  harvest_accessed() sets bit i of
+     * bits for each of the nr gfns from gfn whose accessed bit was set, and
+     * clears it; it returns the number of bits set.
+     */
+    void               (*set_access_tracking)(struct p2m_domain *p2m,
+                                              bool enable);
+    unsigned int       (*harvest_accessed)(struct p2m_domain *p2m,
+                                           unsigned long gfn, unsigned int nr,
+                                           unsigned long *bits);
     void               (*change_entry_type_global)(struct p2m_domain *p2m,
                                                    p2m_type_t ot,
                                                    p2m_type_t nt);
@@ -295,6 +306,9 @@ struct p2m_domain {
      * pause domain.  Otherwise, remove access restrictions. */
     bool_t       access_required;
 
+    /* Accessed bits are being sampled (XEN_DOMCTL_p2m_access_bits) */
+    bool         access_tracking;
+
     /* Highest guest frame that's ever been mapped in the p2m */
     unsigned long max_mapped_pfn;
 
@@ -305,10 +319,27 @@ struct p2m_domain {
     unsigned long min_remapped_gfn;
     unsigned long max_remapped_gfn;
 
+    /*
+     * Alternate p2m's only: gfn's whose host p2m entry was relaxed without
+     * the change having been propagated yet, and the range they lie in.
+     * See p2m_altp2m_propagate_change().
+     */
+    struct rangeset *stale_ranges;
+    unsigned long min_stale_gfn;
+    unsigned long max_stale_gfn;
+
     /* When releasing shared gfn's in a preemptible manner, recall where
      * to resume the search */
     unsigned long next_shared_gfn_to_relinquish;
 
+    /* Superpage re-coalescing state and statistics, see p2m-coalesce.c. */
+    struct {
+        unsigned long next_gfn;     /* Where the background scan resumes */
+        unsigned long shattered;    /* Superpage entries split */
+        unsigned long coalesced_2m; /* 2M entries re-installed */
+        unsigned long coalesced_1g; /* 1G entries re-installed */
+    } coalesce;
+
 #ifdef CONFIG_HVM
     /* Populate-on-demand variables
      * All variables are protected with the pod lock. We cannot rely on
@@ -340,6 +371,17 @@ struct p2m_domain {
         } mrp;
         mm_lock_t        lock;         /* Locking of private pod structs,   *
                                         * not relying on the p2m lock.      */
+
+        /* Background sweeping, keeping the cache topped up. */
+        struct tasklet   sweep_tasklet;
+        bool             sweep_pending;
+
+        /* Time guest faults spent reclaiming memory, and sweep results. */
+        struct {
+            unsigned long stalls;
+            s_time_t      stall_total, stall_max;
+            unsigned long bg_sweeps, bg_reclaimed;
+        } stats;
     } pod;
 #endif
 
@@ -417,6 +459,15 @@ static inline bool_t p2m_is_altp2m(const struct p2m_domain *p2m)
 void p2m_tlb_flush_sync(struct p2m_domain *p2m);
 void p2m_unlock_and_tlb_flush(struct p2m_domain *p2m);
 
+/*
+ * Batch a series of updates to a domain's host p2m, such that the TLB and
+ * IOTLB flushes they require are issued only once, by p2m_batch_end().
+ * The p2m is locked in between, so the caller must neither access guest
+ * memory nor block or check for preemption.
+ */
+void p2m_batch_begin(struct domain *d);
+int p2m_batch_end(struct domain *d);
+
 /**** p2m query accessors. They lock p2m_lock, and thus serialize
  * lookups wrt modifications. They _do not_ release the lock on exit.
  * After calling any of the variants below, caller needs to use
@@ -727,6 +778,23 @@ static inline void p2m_pod_init(struct p2m_domain *p2m) {}
 
 #endif
 
+/*
+ * Superpage re-coalescing
+ */
+
+struct xen_domctl_p2m_superpages;
+
+/* Count the RAM mappings of a domain's host p2m by size (preemptible) */
+int p2m_get_superpages(struct domain *d, struct xen_domctl_p2m_superpages *sp);
+
+/*
+ * Accessed bit sampling
+ */
+
+struct xen_domctl_p2m_access_bits;
+
+/* Enable, disable or harvest the accessed bits of a domain (preemptible) */
+int p2m_access_bits(struct domain *d, struct xen_domctl_p2m_access_bits *ab);
 
 /*
  * Paging to disk and page-sharing
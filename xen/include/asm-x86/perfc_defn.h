@@ -76,6 +76,7 @@ PERFCOUNTER(shadow_hash_lookup_miss, "shadow hash misses")
 PERFCOUNTER(shadow_get_shadow_status, "calls to get_shadow_status")
 PERFCOUNTER(shadow_hash_inserts,   "calls to shadow_hash_insert")
 PERFCOUNTER(shadow_hash_deletes,   "calls to shadow_hash_delete")
+PERFCOUNTER(shadow_hash_resizes,   "shadow hash table resizes")
 PERFCOUNTER(shadow_writeable,      "shadow removes write access")
 PERFCOUNTER(shadow_writeable_h_1,  "shadow writeable: 32b w2k3")
 PERFCOUNTER(shadow_writeable_h_2,  "shadow writeable: 32pae w2k3")
@@ -111,10 +112,27 @@ PERFCOUNTER(shadow_oos_fixup_evict,"shadow OOS fixup evictions")
 PERFCOUNTER(shadow_unsync,         "shadow OOS unsyncs")
 PERFCOUNTER(shadow_unsync_evict,   "shadow OOS evictions")
 PERFCOUNTER(shadow_resync,         "shadow OOS resyncs")
+PERFCOUNTER(shadow_oos_hit,        "shadow OOS lookups hitting first slot")
+PERFCOUNTER(shadow_oos_hit2,       "shadow OOS lookups hitting second slot")
+PERFCOUNTER(shadow_oos_probe_miss, "shadow OOS per-vcpu probes missing")
+PERFCOUNTER(shadow_resync_all,     "calls to sh_resync_all")
 
 PERFCOUNTER(realmode_emulations, "realmode instructions emulated")
 PERFCOUNTER(realmode_exits,      "vmexits from realmode")
 
 PERFCOUNTER(pauseloop_exits, "vmexits from Pause-Loop Detection")
 
+PERFCOUNTER(p2m_coalesce_scans,  "p2m coalesce: 2M ranges scanned")
+PERFCOUNTER(p2m_coalesce_2m,     "p2m coalesce: 2M entries installed")
+PERFCOUNTER(p2m_coalesce_1g,     "p2m coalesce: 1G entries installed")
+
+PERFCOUNTER(altp2m_propagate_sync,    "altp2m: changes propagated")
+PERFCOUNTER(altp2m_propagate_skipped, "altp2m: propagations not needed")
+PERFCOUNTER(altp2m_propagate_lazy,    "altp2m: propagations deferred")
+PERFCOUNTER(altp2m_stale_fixup,       "altp2m: stale entries fixed up")
+
+PERFCOUNTER(pod_sweep_emergency,  "PoD: emergency sweeps")
+PERFCOUNTER(pod_sweep_background, "PoD: background sweeps")
+PERFCOUNTER(pod_zero_reclaim,     "PoD: zero pages reclaimed")
+
 /*#endif*/ /* __XEN_PERFC_DEFN_H__ */
@@ -0,0 +1,30 @@
+/******************************************************************************
+ * include/asm-x86/pmuprof.h
+ *
+ * Sampling profiler of the hypervisor and its guests.
+ */
+
+#ifndef __ASM_X86_PMUPROF_H__
+#define __ASM_X86_PMUPROF_H__
+
+#include <public/xen.h>
+
+struct xen_sysctl_pmuprof_op;
+
+int pmuprof_op(struct xen_sysctl_pmuprof_op *op);
+
+/* Frames of the sample ring of a pCPU, see public/pmuprof.h. */
+int pmuprof_acquire(unsigned int cpu, unsigned long frame,
+                    unsigned int nr_frames, xen_pfn_t mfn_list[]);
+
+#endif /* __ASM_X86_PMUPROF_H__ */
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -113,6 +113,8 @@ void vpmu_destroy(struct vcpu *v);
 void vpmu_save(struct vcpu *v);
 int vpmu_load(struct vcpu *v, bool_t from_guest);
 void vpmu_dump(struct vcpu *v);
+int vpmu_reserve(void);
+void vpmu_release(void);
 
 static inline int vpmu_do_wrmsr(unsigned int msr, uint64_t msr_content,
                                 uint64_t supported)
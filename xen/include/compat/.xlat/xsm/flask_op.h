@@ -0,0 +1,81 @@
+
+#define CHECK_flask_access \
+    CHECK_SIZE_(struct, flask_access); \
+    CHECK_FIELD_(struct, flask_access, ssid); \
+    CHECK_FIELD_(struct, flask_access, tsid); \
+    CHECK_FIELD_(struct, flask_access, tclass); \
+    CHECK_FIELD_(struct, flask_access, req); \
+    CHECK_FIELD_(struct, flask_access, allowed); \
+    CHECK_FIELD_(struct, flask_access, audit_allow); \
+    CHECK_FIELD_(struct, flask_access, audit_deny); \
+    CHECK_FIELD_(struct, flask_access, seqno)
+
+#define XLAT_flask_boolean(_d_, _s_) do { \
+    (_d_)->bool_id = (_s_)->bool_id; \
+    (_d_)->enforcing = (_s_)->enforcing; \
+    (_d_)->pending = (_s_)->pending; \
+    (_d_)->new_value = (_s_)->new_value; \
+    (_d_)->commit = (_s_)->commit; \
+    (_d_)->size = (_s_)->size; \
+    XLAT_flask_boolean_HNDL_name(_d_, _s_); \
+} while (0)
+
+#define CHECK_flask_cache_stats \
+    CHECK_SIZE_(struct, flask_cache_stats); \
+    CHECK_FIELD_(struct, flask_cache_stats, cpu); \
+    CHECK_FIELD_(struct, flask_cache_stats, lookups); \
+    CHECK_FIELD_(struct, flask_cache_stats, hits); \
+    CHECK_FIELD_(struct, flask_cache_stats, misses); \
+    CHECK_FIELD_(struct, flask_cache_stats, allocations); \
+    CHECK_FIELD_(struct, flask_cache_stats, reclaims); \
+    CHECK_FIELD_(struct, flask_cache_stats, frees)
+
+#define CHECK_flask_hash_stats \
+    CHECK_SIZE_(struct, flask_hash_stats); \
+    CHECK_FIELD_(struct, flask_hash_stats, entries); \
+    CHECK_FIELD_(struct, flask_hash_stats, buckets_used); \
+    CHECK_FIELD_(struct, flask_hash_stats, buckets_total); \
+    CHECK_FIELD_(struct, flask_hash_stats, max_chain_len)
+
+#define XLAT_flask_load(_d_, _s_) do { \
+    XLAT_flask_load_HNDL_buffer(_d_, _s_); \
+    (_d_)->size = (_s_)->size; \
+} while (0)
+
+#define CHECK_flask_ocontext \
+    CHECK_SIZE_(struct, flask_ocontext); \
+    CHECK_FIELD_(struct, flask_ocontext, ocon); \
+    CHECK_FIELD_(struct, flask_ocontext, sid); \
+    CHECK_FIELD_(struct, flask_ocontext, low); \
+    CHECK_FIELD_(struct, flask_ocontext, high)
+
+#define CHECK_flask_peersid \
+    CHECK_SIZE_(struct, flask_peersid); \
+    CHECK_FIELD_(struct, flask_peersid, evtchn); \
+    CHECK_FIELD_(struct, flask_peersid, sid)
+
+#define CHECK_flask_relabel \
+    CHECK_SIZE_(struct, flask_relabel); \
+    CHECK_FIELD_(struct, flask_relabel, domid); \
+    CHECK_FIELD_(struct, flask_relabel, sid)
+
+#define CHECK_flask_setavc_threshold \
+    CHECK_SIZE_(struct, flask_setavc_threshold); \
+    CHECK_FIELD_(struct, flask_setavc_threshold, threshold)
+
+#define CHECK_flask_setenforce \
+    CHECK_SIZE_(struct, flask_setenforce); \
+    CHECK_FIELD_(struct, flask_setenforce, enforcing)
+
+#define XLAT_flask_sid_context(_d_, _s_) do { \
+    (_d_)->sid = (_s_)->sid; \
+    (_d_)->size = (_s_)->size; \
+    XLAT_flask_sid_context_HNDL_context(_d_, _s_); \
+} while (0)
+
+#define CHECK_flask_transition \
+    CHECK_SIZE_(struct, flask_transition); \
+    CHECK_FIELD_(struct, flask_transition, ssid); \
+    CHECK_FIELD_(struct, flask_transition, tsid); \
+    CHECK_FIELD_(struct, flask_transition, tclass); \
+    CHECK_FIELD_(struct, flask_transition, newsid)
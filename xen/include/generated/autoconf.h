@@ -0,0 +1,70 @@
+/*
+ *
+ * Automatically generated file; DO NOT EDIT.
+ * Xen/x86 4.13.0-rc Configuration
+ *
+ */
+#define CONFIG_ARCH_SUPPORTS_INT128 1
+#define CONFIG_HAS_ALTERNATIVE 1
+#define CONFIG_COMPAT 1
+#define CONFIG_HVM_FEP 1
+#define CONFIG_SCRUB_DEBUG 1
+#define CONFIG_FAST_SYMBOL_LOOKUP 1
+#define CONFIG_HAS_VPCI 1
+#define CONFIG_SCHED_RTDS 1
+#define CONFIG_X86 1
+#define CONFIG_HAS_PDX 1
+#define CONFIG_ACPI 1
+#define CONFIG_XENOPROF 1
+#define CONFIG_PV 1
+#define CONFIG_CORE_PARKING 1
+#define CONFIG_HAS_MEM_PAGING 1
+#define CONFIG_ARCH_DEFCONFIG "arch/x86/configs/x86_64_defconfig"
+#define CONFIG_HAS_GDBSX 1
+#define CONFIG_DEFCONFIG_LIST "arch/x86/configs/x86_64_defconfig"
+#define CONFIG_XEN_ALIGN_DEFAULT 1
+#define CONFIG_TBOOT 1
+#define CONFIG_SCHED_NULL 1
+#define CONFIG_HAS_PCI 1
+#define CONFIG_VIDEO 1
+#define CONFIG_HAS_SCHED_GRANULARITY 1
+#define CONFIG_HAS_EHCI 1
+#define CONFIG_HAS_IOPORTS 1
+#define CONFIG_XMEM_POOL_POISON 1
+#define CONFIG_SCHED_CREDIT2 1
+#define CONFIG_SCHED_CREDIT 1
+#define CONFIG_KEXEC 1
+#define CONFIG_FRAME_POINTER 1
+#define CONFIG_NUMA 1
+#define CONFIG_SCHED_DEFAULT "credit2"
+#define CONFIG_MEM_ACCESS_ALWAYS_ON 1
+#define CONFIG_HVM 1
+#define CONFIG_SPECULATIVE_HARDEN_ARRAY 1
+#define CONFIG_MEM_ACCESS 1
+#define CONFIG_SCHED_ARINC653 1
+#define CONFIG_VERBOSE_DEBUG 1
+#define CONFIG_CRYPTO 1
+#define CONFIG_CMDLINE ""
+#define CONFIG_HAS_FAST_MULTIPLY 1
+#define CONFIG_LIVEPATCH 1
+#define CONFIG_X86_64 1
+#define CONFIG_SHADOW_PAGING 1
+#define CONFIG_HAS_CPUFREQ 1
+#define CONFIG_SUPPRESS_DUPLICATE_SYMBOL_WARNINGS 1
+#define CONFIG_SPECULATIVE_HARDEN_BRANCH 1
+#define CONFIG_DOM0_MEM ""
+#define CONFIG_NR_CPUS 256
+#define CONFIG_HAS_KEXEC 1
+#define CONFIG_GRANT_TABLE 1
+#define CONFIG_HAS_PASSTHROUGH 1
+#define CONFIG_HAS_EX_TABLE 1
+#define CONFIG_VGA 1
+#define CONFIG_HAS_UBSAN 1
+#define CONFIG_HAS_NS16550 1
+#define CONFIG_TRACEBUFFER 1
+#define CONFIG_DEBUG_LOCKS 1
+#define CONFIG_DEBUG 1
+#define CONFIG_PV_LINEAR_PT 1
+#define CONFIG_ACPI_LEGACY_TABLES_LOOKUP 1
+#define CONFIG_NEEDS_LIBELF 1
+#define CONFIG_DEBUG_INFO 1
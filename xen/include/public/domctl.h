@@ -38,7 +38,7 @@
 #include "hvm/save.h"
 #include "memory.h"
 
-#define XEN_DOMCTL_INTERFACE_VERSION 0x00000012
+#define XEN_DOMCTL_INTERFACE_VERSION 0x00000013
 
 /*
  * NB. xen_domctl.domain is an IN/OUT parameter for this operation.
@@ -93,6 +93,22 @@ struct xen_domctl_createdomain {
     struct xen_arch_domainconfig arch;
 };
 
+/*
+ * XEN_DOMCTL_destroydomain
+ *
+ * Without flags, the hypercall only returns once the domain is dead.  With
+ * XEN_DOMCTL_DESTROY_report, it returns -EAGAIN whenever it would otherwise
+ * have been preempted, with nr_pages set to the number of pages the domain
+ * still owns, and the caller is expected to re-issue it.
+ */
+struct xen_domctl_destroydomain {
+#define _XEN_DOMCTL_DESTROY_report    0
+#define XEN_DOMCTL_DESTROY_report     (1U << _XEN_DOMCTL_DESTROY_report)
+    uint32_t flags;                /* IN */
+    uint32_t pad;
+    uint64_aligned_t nr_pages;     /* OUT */
+};
+
 /* XEN_DOMCTL_getdomaininfo */
 struct xen_domctl_getdomaininfo {
     /* OUT variables. */
@@ -1126,6 +1142,54 @@ struct xen_domctl_vuart_op {
                                  */
 };
 
+/*
+ * XEN_DOMCTL_p2m_superpages
+ *
+ * Report the superpage coverage of a translated domain's host p2m: the
+ * number of RAM mappings of each size, from start_gfn upwards, together with
+ * the number of superpage entries split and re-installed over the domain's
+ * lifetime.  Callers have to pass in start_gfn and the nr_* fields as zero.
+ */
+struct xen_domctl_p2m_superpages {
+    uint64_aligned_t start_gfn;    /* IN/OUT: where to resume the walk */
+    uint64_aligned_t nr_4k;        /* IN/OUT: # of 4k RAM mappings */
+    uint64_aligned_t nr_2m;        /* IN/OUT: # of 2M RAM mappings */
+    uint64_aligned_t nr_1g;        /* IN/OUT: # of 1G RAM mappings */
+    uint64_aligned_t shattered;    /* OUT: # of superpage entries split */
+    uint64_aligned_t coalesced_2m; /* OUT: # of 2M entries re-coalesced */
+    uint64_aligned_t coalesced_1g; /* OUT: # of 1G entries re-coalesced */
+};
+
+/*
+ * XEN_DOMCTL_p2m_access_bits
+ *
+ * Sample the accessed bits of a translated domain's host p2m, for pagers
+ * and similar tools wanting to tell hot from cold memory.
+ *
+ * ENABLE and DISABLE switch hardware tracking of the accessed bits on and
+ * off; the domain is paused briefly while doing so.  HARVEST reports and
+ * clears the accessed bits of the nr gfns starting at start_gfn, as a bitmap
+ * with bit i set if gfn start_gfn + i has been accessed since the previous
+ * harvest (or since tracking was enabled).  Unmapped gfns read as not
+ * accessed.  Callers have to pass in done and accessed as zero; on return
+ * accessed holds the number of bits set.
+ *
+ * Returns -EOPNOTSUPP if the hardware or paging mode can't provide accessed
+ * bits, and for domains with alternate p2m views active.
+ */
+#define XEN_DOMCTL_P2M_ACCESS_BITS_ENABLE    0
+#define XEN_DOMCTL_P2M_ACCESS_BITS_DISABLE   1
+#define XEN_DOMCTL_P2M_ACCESS_BITS_HARVEST   2
+struct xen_domctl_p2m_access_bits {
+    uint32_t op;                   /* IN: XEN_DOMCTL_P2M_ACCESS_BITS_* */
+    uint32_t _pad;
+    uint64_aligned_t start_gfn;    /* HARVEST IN: first gfn */
+    uint64_aligned_t nr;           /* HARVEST IN: # of gfns */
+    uint64_aligned_t done;         /* HARVEST IN/OUT: # of gfns processed */
+    uint64_aligned_t accessed;     /* HARVEST IN/OUT: # of bits set */
+    XEN_GUEST_HANDLE_64(uint8) bitmap; /* HARVEST OUT: nr bits */
+};
+
 struct xen_domctl {
     uint32_t cmd;
 #define XEN_DOMCTL_createdomain                   1
@@ -1207,6 +1271,8 @@ struct xen_domctl {
 #define XEN_DOMCTL_vuart_op                      81
 #define XEN_DOMCTL_get_cpu_policy                82
 #define XEN_DOMCTL_set_cpu_policy                83
+#define XEN_DOMCTL_p2m_superpages                84
+#define XEN_DOMCTL_p2m_access_bits               85
 #define XEN_DOMCTL_gdbsx_guestmemio            1000
 #define XEN_DOMCTL_gdbsx_pausevcpu             1001
 #define XEN_DOMCTL_gdbsx_unpausevcpu           1002
@@ -1215,6 +1281,7 @@ struct xen_domctl {
     domid_t  domain;
     union {
         struct xen_domctl_createdomain      createdomain;
+        struct xen_domctl_destroydomain     destroydomain;
         struct xen_domctl_getdomaininfo     getdomaininfo;
         struct xen_domctl_getpageframeinfo3 getpageframeinfo3;
         struct xen_domctl_nodeaffinity      nodeaffinity;
@@ -1267,6 +1334,8 @@ struct xen_domctl {
         struct xen_domctl_monitor_op        monitor_op;
         struct xen_domctl_psr_alloc         psr_alloc;
         struct xen_domctl_vuart_op          vuart_op;
+        struct xen_domctl_p2m_superpages    p2m_superpages;
+        struct xen_domctl_p2m_access_bits   p2m_access_bits;
         uint8_t                             pad[128];
     } u;
 };
@@ -0,0 +1,102 @@
+/******************************************************************************
+ * domstats.h
+ *
+ * Layout of the domain statistics region, which Xen keeps up to date for the
+ * toolstack to read without issuing hypercalls.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __XEN_PUBLIC_DOMSTATS_H__
+#define __XEN_PUBLIC_DOMSTATS_H__
+
+#if defined(__XEN__) || defined(__XEN_TOOLS__)
+
+#include "xen.h"
+#include "domctl.h"
+
+/*
+ * The region is acquired read-only with XENMEM_acquire_resource, type
+ * XENMEM_resource_domstats, domid DOMID_XEN and id 0.  Frame 0 holds a
+ * struct xen_domstats_header, and frame 1 + n the struct xen_domstats_domain
+ * of the n-th domain, in increasing domid order.
+ *
+ * Xen rewrites the whole region every period_ms.  The header's seq is odd
+ * while it does so: readers must copy what they need, check that seq was
+ * even and hasn't changed meanwhile, and retry otherwise.
+ *
+ * The region grows, never shrinks, as domains get created: frames from
+ * nr_frames on can be mapped once nr_frames has caught up.
+ */
+
+#define XEN_DOMSTATS_VERSION 1
+
+struct xen_domstats_header {
+    uint32_t version;           /* XEN_DOMSTATS_VERSION */
+    uint32_t seq;
+    uint32_t nr_frames;         /* Frames which can be mapped */
+    uint32_t nr_domains;        /* Frames 1 to nr_domains are valid */
+    uint32_t period_ms;
+    /* Not every domain has a frame: the region is incomplete. */
+#define XEN_DOMSTATS_incomplete (1U << 0)
+    uint32_t flags;
+    uint64_aligned_t timestamp; /* Xen system time of the update, in ns */
+};
+typedef struct xen_domstats_header xen_domstats_header_t;
+
+/* As returned by XEN_DOMCTL_getvcpuinfo. */
+struct xen_domstats_vcpu {
+    uint64_aligned_t cpu_time;  /* ns spent running */
+    uint64_aligned_t evtchn_sends; /* Event channel notifications sent */
+    uint8_t online, blocked, running;
+    uint8_t pad;
+    uint32_t cpu;
+};
+typedef struct xen_domstats_vcpu xen_domstats_vcpu_t;
+
+/* The number of vCPUs which fit in a domain's frame, along its info. */
+#define XEN_DOMSTATS_MAX_VCPUS 160
+
+struct xen_domstats_domain {
+    /* As returned by XEN_DOMCTL_getdomaininfo. */
+    struct xen_domctl_getdomaininfo info;
+    /*
+     * vcpu[] has nr_vcpus entries: the remaining vCPUs of domains with more
+     * than XEN_DOMSTATS_MAX_VCPUS have to be queried with hypercalls.
+     */
+    uint32_t nr_vcpus;
+    uint32_t pad;
+    uint64_aligned_t evtchn_sends; /* Sum of the vCPUs' */
+    struct xen_domstats_vcpu vcpu[XEN_DOMSTATS_MAX_VCPUS];
+};
+typedef struct xen_domstats_domain xen_domstats_domain_t;
+
+#endif /* defined(__XEN__) || defined(__XEN_TOOLS__) */
+
+#endif /* __XEN_PUBLIC_DOMSTATS_H__ */
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -74,6 +74,8 @@
 #define EVTCHNOP_init_control    11
 #define EVTCHNOP_expand_array    12
 #define EVTCHNOP_set_priority    13
+#define EVTCHNOP_send_batch      14
+#define EVTCHNOP_set_moderation  15
 /* ` } */
 
 typedef uint32_t evtchn_port_t;
@@ -312,6 +314,52 @@ struct evtchn_set_priority {
 };
 typedef struct evtchn_set_priority evtchn_set_priority_t;
 
+/*
+ * EVTCHNOP_send_batch: Send an event to the remote end of each of the
+ * channels listed in <ports>, as if EVTCHNOP_send had been issued for each
+ * of them in turn.  Upcalls and IPIs resulting from the notifications are
+ * coalesced, so each target vCPU is kicked at most once per batch.
+ * NOTES:
+ *  1. <nr_ports> must not exceed EVTCHN_SEND_BATCH_MAX.
+ *  2. Ports are processed in order, and processing stops at the first port
+ *     which fails.  <nr_sent> reports the number of ports which were
+ *     successfully notified.
+ */
+#define EVTCHN_SEND_BATCH_MAX 64
+struct evtchn_send_batch {
+    /* IN parameters. */
+    uint32_t nr_ports;
+    /* OUT parameters. */
+    uint32_t nr_sent;
+    /* IN parameters. */
+    evtchn_port_t ports[EVTCHN_SEND_BATCH_MAX];
+};
+typedef struct evtchn_send_batch evtchn_send_batch_t;
+DEFINE_XEN_GUEST_HANDLE(evtchn_send_batch_t);
+
+/*
+ * EVTCHNOP_set_moderation: Limit the rate at which notifications sent by the
+ * remote end of the interdomain channel <port> are delivered to the calling
+ * domain.  At most <max_events> notifications are delivered in any window of
+ * <interval_us> microseconds; further notifications within the window are
+ * coalesced into a single one, delivered when the window expires.
+ * NOTES:
+ *  1. <port> must be a local port of the calling domain, either unbound or
+ *     bound to another domain (interdomain).  -EINVAL is returned otherwise.
+ *  2. <max_events> == 0 disables moderation, in which case <interval_us> is
+ *     ignored.  Otherwise <interval_us> must be non-zero and no larger than
+ *     EVTCHN_MODERATION_MAX_INTERVAL_US.
+ *  3. Moderation stays in effect until disabled or the port is closed.
+ */
+#define EVTCHN_MODERATION_MAX_INTERVAL_US 1000000
+struct evtchn_set_moderation {
+    /* IN parameters. */
+    evtchn_port_t port;
+    uint32_t max_events;
+    uint32_t interval_us;
+};
+typedef struct evtchn_set_moderation evtchn_set_moderation_t;
+
 /*
  * ` enum neg_errnoval
  * ` HYPERVISOR_event_channel_op_compat(struct evtchn_op *op)
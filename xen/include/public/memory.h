@@ -391,19 +391,38 @@ typedef struct xen_pod_target xen_pod_target_t;
 #define XENMEM_paging_op_nominate           0
 #define XENMEM_paging_op_evict              1
 #define XENMEM_paging_op_prep               2
+#define XENMEM_paging_op_nominate_batch     3
+#define XENMEM_paging_op_evict_batch        4
 
+/*
+ * The _batch ops nominate or evict a number of gfns in one go.  buffer then
+ * holds the address of an array of xen_mem_paging_batch_entry and gfn the
+ * number of entries in it.  Entries are processed in order, each receiving
+ * the result the corresponding single gfn op would have returned.  Both
+ * fields may be updated when the operation gets preempted.
+ */
 struct xen_mem_paging_op {
     uint8_t     op;         /* XENMEM_paging_op_* */
     domid_t     domain;
 
     /* PAGING_PREP IN: buffer to immediately fill page in */
+    /* _BATCH IN: address of the entry array */
     uint64_aligned_t    buffer;
     /* Other OPs */
     uint64_aligned_t    gfn;           /* IN:  gfn of page being operated on */
+                                       /* _BATCH IN: # of entries */
 };
 typedef struct xen_mem_paging_op xen_mem_paging_op_t;
 DEFINE_XEN_GUEST_HANDLE(xen_mem_paging_op_t);
 
+struct xen_mem_paging_batch_entry {
+    uint64_aligned_t gfn;   /* IN: gfn to nominate or evict */
+    int32_t rc;             /* OUT: 0 or -errno (-EBUSY: not pageable) */
+    uint32_t _pad;
+};
+typedef struct xen_mem_paging_batch_entry xen_mem_paging_batch_entry_t;
+DEFINE_XEN_GUEST_HANDLE(xen_mem_paging_batch_entry_t);
+
 #define XENMEM_access_op                    21
 #define XENMEM_access_op_set_access         0
 #define XENMEM_access_op_get_access         1
@@ -482,6 +501,9 @@ DEFINE_XEN_GUEST_HANDLE(xen_mem_access_op_t);
 #define XENMEM_sharing_op_add_physmap       6
 #define XENMEM_sharing_op_audit             7
 #define XENMEM_sharing_op_range_share       8
+#define XENMEM_sharing_op_share_batch       9
+#define XENMEM_sharing_op_fork              10
+#define XENMEM_sharing_op_fork_reset        11
 
 #define XENMEM_SHARING_OP_S_HANDLE_INVALID  (-10)
 #define XENMEM_SHARING_OP_C_HANDLE_INVALID  (-9)
@@ -499,6 +521,18 @@ DEFINE_XEN_GUEST_HANDLE(xen_mem_access_op_t);
 #define XENMEM_SHARING_OP_FIELD_GET_GREF(field)        \
     ((field) & (~XENMEM_SHARING_OP_FIELD_IS_GREF_FLAG))
 
+/* A pair of nominated pages to share, for XENMEM_sharing_op_share_batch. */
+struct xen_mem_sharing_batch_entry {
+    uint64_aligned_t source_gfn;    /* IN: the gfn of the source page */
+    uint64_aligned_t source_handle; /* IN: handle to the source page */
+    uint64_aligned_t client_gfn;    /* IN: the client gfn */
+    uint64_aligned_t client_handle; /* IN: handle to the client page */
+    int32_t rc;                     /* OUT: as for XENMEM_sharing_op_share */
+    uint32_t _pad;                  /* Must be set to 0 */
+};
+typedef struct xen_mem_sharing_batch_entry xen_mem_sharing_batch_entry_t;
+DEFINE_XEN_GUEST_HANDLE(xen_mem_sharing_batch_entry_t);
+
 struct xen_mem_sharing_op {
     uint8_t     op;     /* XENMEM_sharing_op_* */
     domid_t     domain;
@@ -525,6 +559,22 @@ struct xen_mem_sharing_op {
             domid_t client_domain;           /* IN: the client domain id */
             uint16_t _pad[3];                /* Must be set to 0 */
         } range;
+        /*
+         * Share nr_entries pairs of pages of the source domain (domain) and
+         * client_domain, with one result per entry.  The op as a whole only
+         * fails for errors unrelated to individual entries.
+         */
+        struct mem_sharing_op_share_batch {   /* OP_SHARE_BATCH */
+            XEN_GUEST_HANDLE_64(xen_mem_sharing_batch_entry_t) entries;
+            uint32_t nr_entries;             /* IN: number of entries */
+            uint32_t done;                   /* Must be set to 0 */
+            domid_t client_domain;           /* IN: the client domain id */
+            uint16_t _pad[3];                /* Must be set to 0 */
+        } batch;
+        struct mem_sharing_op_fork {      /* OP_FORK{,_RESET} */
+            domid_t parent_domain;        /* IN: parent's domain id */
+            uint16_t _pad[3];             /* Must be set to 0 */
+        } fork;
         struct mem_sharing_op_debug {     /* OP_DEBUG_xxx */
             union {
                 uint64_aligned_t gfn;      /* IN: gfn to debug          */
@@ -605,13 +655,18 @@ DEFINE_XEN_GUEST_HANDLE(xen_reserved_device_memory_map_t);
  */
 #define XENMEM_acquire_resource 28
 struct xen_mem_acquire_resource {
-    /* IN - The domain whose resource is to be mapped */
+    /*
+     * IN - The domain whose resource is to be mapped, DOMID_XEN for
+     *      XENMEM_resource_domstats and XENMEM_resource_pmuprof
+     */
     domid_t domid;
     /* IN - the type of resource */
     uint16_t type;
 
 #define XENMEM_resource_ioreq_server 0
 #define XENMEM_resource_grant_table 1
+#define XENMEM_resource_domstats 2     /* See domstats.h */
+#define XENMEM_resource_pmuprof 3      /* See pmuprof.h */
 
     /*
      * IN - a type-specific resource identifier, which must be zero
@@ -619,6 +674,7 @@ struct xen_mem_acquire_resource {
      *
      * type == XENMEM_resource_ioreq_server -> id == ioreq server id
      * type == XENMEM_resource_grant_table -> id defined below
+     * type == XENMEM_resource_pmuprof -> id == pCPU
      */
     uint32_t id;
 
@@ -0,0 +1,106 @@
+/******************************************************************************
+ * pmuprof.h
+ *
+ * Layout of the sample rings of the hypervisor sampling profiler, see
+ * XEN_SYSCTL_pmuprof_op.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __XEN_PUBLIC_PMUPROF_H__
+#define __XEN_PUBLIC_PMUPROF_H__
+
+#if defined(__XEN__) || defined(__XEN_TOOLS__)
+
+#include "xen.h"
+
+/*
+ * Every pCPU which was online when the profiler was first started has a
+ * ring, acquired read-only with XENMEM_acquire_resource, type
+ * XENMEM_resource_pmuprof, domid DOMID_XEN and id the pCPU.  Frame 0 holds
+ * a struct xen_pmuprof_header, and frames 1 to nr_frames the ring's
+ * nr_records struct xen_pmuprof_record, XEN_PMUPROF_RECORDS_PER_FRAME to a
+ * frame.
+ *
+ * Record n is at index n % nr_records, and head is the number of records
+ * ever written.  Xen doesn't wait for readers: it overwrites the oldest
+ * records once the ring is full.  Readers must copy the records they want,
+ * then read head again and drop those copied from n < head + 1 - nr_records,
+ * which may have been overwritten meanwhile.
+ */
+
+#define XEN_PMUPROF_VERSION 1
+
+/* What the performance counter counts. */
+#define XEN_PMUPROF_EVENT_cycles       0   /* Unhalted core cycles */
+#define XEN_PMUPROF_EVENT_instructions 1   /* Instructions retired */
+
+struct xen_pmuprof_header {
+    uint32_t version;           /* XEN_PMUPROF_VERSION */
+    uint32_t cpu;
+    uint32_t nr_frames;         /* Record frames, following this one */
+    uint32_t nr_records;        /* A power of two */
+    uint64_aligned_t head;      /* Records written */
+    /* Of the last time the profiler was started */
+    uint64_aligned_t period;    /* Events between samples */
+    uint32_t event;             /* XEN_PMUPROF_EVENT_* */
+    uint32_t pad;
+};
+typedef struct xen_pmuprof_header xen_pmuprof_header_t;
+
+/* Where the pCPU was when the sample was taken. */
+#define XEN_PMUPROF_MODE_xen          0
+#define XEN_PMUPROF_MODE_guest_kernel 1
+#define XEN_PMUPROF_MODE_guest_user   2
+
+#define XEN_PMUPROF_MAX_CALLERS 13
+
+struct xen_pmuprof_record {
+    uint64_aligned_t time;      /* Xen system time, in ns */
+    uint64_aligned_t ip;
+    domid_t domid;              /* Of current, DOMID_IDLE when idle */
+    uint16_t vcpu;
+    uint8_t mode;               /* XEN_PMUPROF_MODE_* */
+    /*
+     * Return addresses of the Xen call chain which led to ip, innermost
+     * first.  Only recorded in Xen mode, and only by Xen built with frame
+     * pointers.
+     */
+    uint8_t nr_callers;
+    uint16_t pad;
+    uint64_aligned_t callers[XEN_PMUPROF_MAX_CALLERS];
+};
+typedef struct xen_pmuprof_record xen_pmuprof_record_t;
+
+/* Of 4k frames */
+#define XEN_PMUPROF_RECORDS_PER_FRAME 32
+
+#endif /* defined(__XEN__) || defined(__XEN_TOOLS__) */
+
+#endif /* __XEN_PUBLIC_PMUPROF_H__ */
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -999,6 +999,142 @@ struct xen_sysctl_set_parameter {
     uint16_t pad[3];                        /* IN: MUST be zero. */
 };
 
+/*
+ * XEN_SYSCTL_sched_latency
+ *
+ * Scheduling latency histograms, maintained for all schedulers.
+ *  - wake_to_run: time a vCPU spent runnable after being woken up, before
+ *                 it got to run.
+ *  - run_slice:   time a vCPU ran before being descheduled.
+ *  - migrations:  number of times a vCPU started running on a different
+ *                 pCPU than the one it last ran on.
+ *
+ * Histograms have log2 buckets of nanoseconds: bucket 0 counts intervals
+ * shorter than 2^10ns (~1us), bucket i counts intervals in
+ * [2^(i+9), 2^(i+10)) ns, and the last bucket counts everything longer.
+ *
+ * Per-pCPU statistics account for the vCPUs run on that pCPU, per-domain
+ * statistics are the sum over the domain's vCPUs.
+ */
+#define XEN_SYSCTL_SCHED_LATENCY_BUCKETS 24
+struct xen_sysctl_sched_latency_stats {
+    uint64_aligned_t wake_to_run[XEN_SYSCTL_SCHED_LATENCY_BUCKETS];
+    uint64_aligned_t run_slice[XEN_SYSCTL_SCHED_LATENCY_BUCKETS];
+    uint64_aligned_t migrations;
+};
+typedef struct xen_sysctl_sched_latency_stats xen_sysctl_sched_latency_stats_t;
+DEFINE_XEN_GUEST_HANDLE(xen_sysctl_sched_latency_stats_t);
+
+struct xen_sysctl_sched_latency {
+/* Sub-operations: */
+#define XEN_SYSCTL_SCHED_LATENCY_get   0 /* Get statistics of one object. */
+#define XEN_SYSCTL_SCHED_LATENCY_reset 1 /* Reset all statistics to zero. */
+    uint32_t cmd;           /* IN: XEN_SYSCTL_SCHED_LATENCY_??? */
+/* Object types (get only): */
+#define XEN_SYSCTL_SCHED_LATENCY_cpu    0 /* id is a pCPU */
+#define XEN_SYSCTL_SCHED_LATENCY_domain 1 /* id is a domid */
+    uint32_t type;          /* IN: XEN_SYSCTL_SCHED_LATENCY_{cpu,domain} */
+    uint32_t id;            /* IN */
+    uint32_t pad;           /* Must be zero. */
+    XEN_GUEST_HANDLE_64(xen_sysctl_sched_latency_stats_t) stats; /* OUT */
+};
+
+/*
+ * XEN_SYSCTL_lockstat_op
+ *
+ * Lock contention statistics, per class of locks, available in all builds
+ * (unlike XEN_SYSCTL_lockprof_op).  Nothing is recorded until enabled, and
+ * only acquisitions which had to wait are ever recorded, one in 'sample'
+ * of them on each pCPU.
+ *  - wait:     time spent waiting for the lock.
+ *  - hold:     time spinlocks taken after waiting were then held.
+ *  - callsite: the places most contended acquisitions were made from,
+ *              approximately counted, most contended first.
+ *
+ * The wait histogram has log2 buckets of nanoseconds: bucket 0 counts waits
+ * shorter than 2^8ns, bucket i waits in [2^(i+7), 2^(i+8)) ns, and the last
+ * bucket everything longer.
+ */
+#define XEN_LOCKSTAT_CLASS_other    0
+#define XEN_LOCKSTAT_CLASS_grant    1   /* Grant tables */
+#define XEN_LOCKSTAT_CLASS_p2m      2   /* P2M and PoD */
+#define XEN_LOCKSTAT_CLASS_heap     3   /* Heap and domain page lists */
+#define XEN_LOCKSTAT_CLASS_event    4   /* Event channels */
+#define XEN_LOCKSTAT_CLASS_sched    5   /* Schedulers */
+#define XEN_LOCKSTAT_CLASS_NR       6
+#define XEN_LOCKSTAT_BUCKETS       16
+#define XEN_LOCKSTAT_CALLSITES      8
+struct xen_sysctl_lockstat_callsite {
+    uint64_aligned_t addr;
+    uint64_aligned_t count;
+    char name[48];          /* symbol+offset, if known */
+};
+struct xen_sysctl_lockstat_class {
+    uint64_aligned_t contended;     /* # of acquisitions recorded */
+    uint64_aligned_t wait_time;     /* nsecs waited */
+    uint64_aligned_t wait_max;
+    uint64_aligned_t hold_cnt;      /* # of hold times recorded */
+    uint64_aligned_t hold_time;     /* nsecs held */
+    uint64_aligned_t hold_max;
+    uint64_aligned_t wait_hist[XEN_LOCKSTAT_BUCKETS];
+    struct xen_sysctl_lockstat_callsite callsite[XEN_LOCKSTAT_CALLSITES];
+};
+typedef struct xen_sysctl_lockstat_class xen_sysctl_lockstat_class_t;
+DEFINE_XEN_GUEST_HANDLE(xen_sysctl_lockstat_class_t);
+
+struct xen_sysctl_lockstat_op {
+/* Sub-operations: */
+#define XEN_SYSCTL_LOCKSTAT_enable  0   /* Start recording. */
+#define XEN_SYSCTL_LOCKSTAT_disable 1   /* Stop recording. */
+#define XEN_SYSCTL_LOCKSTAT_reset   2   /* Reset all statistics to zero. */
+#define XEN_SYSCTL_LOCKSTAT_query   3   /* Get the statistics. */
+    uint32_t cmd;           /* IN: XEN_SYSCTL_LOCKSTAT_??? */
+    uint32_t sample;        /* IN (enable), OUT (query): 0 means 1. */
+    uint32_t enabled;       /* OUT (query): whether recording. */
+    uint32_t nr_classes;    /* IN (query): size of 'classes'. */
+                            /* OUT (query): XEN_LOCKSTAT_CLASS_NR. */
+    uint64_aligned_t time;  /* OUT (query): nsecs since the last reset. */
+    XEN_GUEST_HANDLE_64(xen_sysctl_lockstat_class_t) classes; /* OUT */
+};
+
+/*
+ * XEN_SYSCTL_hypercall_stats
+ *
+ * Per hypercall number statistics of the hypercalls made by a domain,
+ * summed over its vCPUs.  They are always maintained and never reset.
+ *  - calls:     invocations, including each resumption of a preempted
+ *               hypercall.
+ *  - preempted: invocations which were preempted, and left a continuation
+ *               to be resumed.
+ *  - time:      nsecs spent in the invocations.
+ *  - latency:   histogram of the time spent in each invocation.
+ *
+ * Only hypercalls made directly by the guest are accounted: the calls of a
+ * multicall are accounted to __HYPERVISOR_multicall.
+ *
+ * The latency histogram has log2 buckets of nanoseconds: bucket 0 counts
+ * invocations shorter than 2^9ns, bucket i those in [2^(i+8), 2^(i+9)) ns,
+ * and the last bucket everything longer.
+ */
+#define XEN_SYSCTL_HYPERCALL_BUCKETS 16
+struct xen_sysctl_hypercall_op_stats {
+    uint64_aligned_t calls;
+    uint64_aligned_t preempted;
+    uint64_aligned_t time;
+    uint64_aligned_t latency[XEN_SYSCTL_HYPERCALL_BUCKETS];
+};
+typedef struct xen_sysctl_hypercall_op_stats xen_sysctl_hypercall_op_stats_t;
+DEFINE_XEN_GUEST_HANDLE(xen_sysctl_hypercall_op_stats_t);
+
+struct xen_sysctl_hypercall_stats {
+    domid_t domid;          /* IN */
+    uint16_t pad;           /* Must be zero. */
+    uint32_t nr_ops;        /* IN: size of 'ops'. */
+                            /* OUT: number of hypercalls accounted. */
+    /* OUT: indexed by hypercall number. */
+    XEN_GUEST_HANDLE_64(xen_sysctl_hypercall_op_stats_t) ops;
+};
+
 #if defined(__i386__) || defined(__x86_64__)
 /*
  * XEN_SYSCTL_get_cpu_policy (x86 specific)
@@ -1031,6 +1167,70 @@ struct xen_sysctl_cpu_policy {
 };
 typedef struct xen_sysctl_cpu_policy xen_sysctl_cpu_policy_t;
 DEFINE_XEN_GUEST_HANDLE(xen_sysctl_cpu_policy_t);
+
+/*
+ * XEN_SYSCTL_vmexit_stats (x86 specific)
+ *
+ * Per exit reason counts of the VM exits of an HVM domain, or of one of its
+ * vCPUs, along with the TSC cycles spent in Xen from each exit until the
+ * next VM entry, or until the vCPU got descheduled.  The counters are
+ * always maintained, and are never reset.
+ *
+ * reasons[] is indexed by VMX basic exit reason, or by SVM exit code, with
+ * SVM's VMEXIT_NPF (0x400) at XEN_SYSCTL_VMEXIT_SVM_NPF and any other exit
+ * code out of range at XEN_SYSCTL_VMEXIT_OTHER.
+ */
+#define XEN_SYSCTL_VMEXIT_REASONS    144
+#define XEN_SYSCTL_VMEXIT_SVM_NPF    142
+#define XEN_SYSCTL_VMEXIT_OTHER      143
+struct xen_sysctl_vmexit_reason {
+    uint64_aligned_t count;
+    uint64_aligned_t cycles;
+};
+typedef struct xen_sysctl_vmexit_reason xen_sysctl_vmexit_reason_t;
+DEFINE_XEN_GUEST_HANDLE(xen_sysctl_vmexit_reason_t);
+
+struct xen_sysctl_vmexit_stats {
+    domid_t domid;          /* IN */
+    uint16_t pad;           /* Must be zero. */
+#define XEN_SYSCTL_VMEXIT_STATS_all_vcpus (~0U)
+    uint32_t vcpu;          /* IN: vCPU, or the sum over all of them. */
+#define XEN_SYSCTL_VMEXIT_STATS_vmx 0
+#define XEN_SYSCTL_VMEXIT_STATS_svm 1
+    uint32_t vendor;        /* OUT: Which kind of exit reasons. */
+    uint32_t pad2;          /* Must be zero. */
+    /* OUT: XEN_SYSCTL_VMEXIT_REASONS entries. */
+    XEN_GUEST_HANDLE_64(xen_sysctl_vmexit_reason_t) reasons;
+};
+typedef struct xen_sysctl_vmexit_stats xen_sysctl_vmexit_stats_t;
+
+/*
+ * XEN_SYSCTL_pmuprof_op (x86 specific)
+ *
+ * Sampling profiler of the hypervisor and its guests.  While it runs, a
+ * performance counter of every pCPU raises an NMI every period events, and
+ * where the pCPU was is recorded in its ring, see public/pmuprof.h.  The
+ * rings are allocated the first time the profiler is started.
+ *
+ * The profiler owns the PMU while it runs: it can't be started while
+ * xenoprof or a vPMU mode other than off is in use, the vPMU mode can't be
+ * changed until it is stopped, and the NMI watchdog is paused meanwhile.
+ */
+struct xen_sysctl_pmuprof_op {
+#define XEN_SYSCTL_PMUPROF_start  0
+#define XEN_SYSCTL_PMUPROF_stop   1
+#define XEN_SYSCTL_PMUPROF_status 2
+    uint32_t cmd;               /* IN */
+    uint32_t event;             /* IN: start, OUT: status (pmuprof.h) */
+    /*
+     * IN: start, 0 for about a thousand samples per second of cycles.
+     * OUT: status.
+     */
+    uint64_aligned_t period;
+    uint32_t running;           /* OUT: status */
+    uint32_t nr_frames;         /* OUT: status. Of a ring, 0 if not allocated */
+};
+typedef struct xen_sysctl_pmuprof_op xen_sysctl_pmuprof_op_t;
 #endif
 
 struct xen_sysctl {
@@ -1063,6 +1263,11 @@ struct xen_sysctl {
 #define XEN_SYSCTL_livepatch_op                  27
 #define XEN_SYSCTL_set_parameter                 28
 #define XEN_SYSCTL_get_cpu_policy                29
+#define XEN_SYSCTL_sched_latency                 30
+#define XEN_SYSCTL_vmexit_stats                  31
+#define XEN_SYSCTL_lockstat_op                   32
+#define XEN_SYSCTL_pmuprof_op                    33
+#define XEN_SYSCTL_hypercall_stats               34
     uint32_t interface_version; /* XEN_SYSCTL_INTERFACE_VERSION */
     union {
         struct xen_sysctl_readconsole       readconsole;
@@ -1091,8 +1296,13 @@ struct xen_sysctl {
         struct xen_sysctl_cpu_featureset    cpu_featureset;
         struct xen_sysctl_livepatch_op      livepatch;
         struct xen_sysctl_set_parameter     set_parameter;
+        struct xen_sysctl_sched_latency     sched_latency;
+        struct xen_sysctl_lockstat_op       lockstat_op;
+        struct xen_sysctl_hypercall_stats   hypercall_stats;
 #if defined(__i386__) || defined(__x86_64__)
         struct xen_sysctl_cpu_policy        cpu_policy;
+        struct xen_sysctl_vmexit_stats      vmexit_stats;
+        struct xen_sysctl_pmuprof_op        pmuprof_op;
 #endif
         uint8_t                             pad[128];
     } u;
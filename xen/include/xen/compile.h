@@ -0,0 +1,14 @@
+#define XEN_COMPILE_DATE	"Mon Oct 19 07:12:23 UTC 2026"
+#define XEN_COMPILE_TIME	"07:12:23"
+#define XEN_COMPILE_BY		""
+#define XEN_COMPILE_DOMAIN	""
+#define XEN_COMPILE_HOST	"vm"
+#define XEN_COMPILER		"gcc (Debian 12.2.0-14+deb12u1) 12.2.0"
+
+#define XEN_VERSION		4
+#define XEN_SUBVERSION		13
+#define XEN_EXTRAVERSION	".0-rc"
+
+#define XEN_CHANGESET		"Mon Oct 19 07:07:57 2026 +0000 git:15a4250-dirty"
+#define XEN_BANNER		\
+"\040\130\145\156\040\064\056\061\063\056\060\055\162\143\012"
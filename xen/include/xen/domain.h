@@ -28,6 +28,10 @@ void getdomaininfo(struct domain *d, struct xen_domctl_getdomaininfo *info);
 void arch_get_domain_info(const struct domain *d,
                           struct xen_domctl_getdomaininfo *info);
 
+/* Frames of the domain statistics region, see public/domstats.h. */
+int domstats_acquire(unsigned long frame, unsigned int nr_frames,
+                     xen_pfn_t mfn_list[]);
+
 /*
  * Arch-specifics.
  */
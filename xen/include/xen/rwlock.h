@@ -12,13 +12,17 @@ typedef struct {
     spinlock_t lock;
 } rwlock_t;
 
-#define    RW_LOCK_UNLOCKED {           \
-    .cnts = ATOMIC_INIT(0),             \
-    .lock = SPIN_LOCK_UNLOCKED          \
+#define    RW_LOCK_UNLOCKED_CLASS(c) {                          \
+    .cnts = ATOMIC_INIT(0),                                     \
+    .lock = SPIN_LOCK_UNLOCKED_CLASS((c) | LOCK_CLASS_QUEUE)    \
 }
+#define    RW_LOCK_UNLOCKED RW_LOCK_UNLOCKED_CLASS(LOCK_CLASS_OTHER)
 
 #define DEFINE_RWLOCK(l) rwlock_t l = RW_LOCK_UNLOCKED
 #define rwlock_init(l) (*(l) = (rwlock_t)RW_LOCK_UNLOCKED)
+/* The class is kept by the wait queue's spinlock. */
+#define rwlock_set_class(l, c) \
+    spin_lock_set_class(&(l)->lock, (c) | LOCK_CLASS_QUEUE)
 
 /*
  * Writer states & reader shift and bias.
@@ -242,6 +246,7 @@ static inline void _percpu_rwlock_owner_check(percpu_rwlock_t **per_cpudata,
     percpu_rwlock_t l = PERCPU_RW_LOCK_UNLOCKED(&get_per_cpu_var(owner))
 #define percpu_rwlock_resource_init(l, owner) \
     (*(l) = (percpu_rwlock_t)PERCPU_RW_LOCK_UNLOCKED(&get_per_cpu_var(owner)))
+#define percpu_rwlock_set_class(l, c) rwlock_set_class(&(l)->rwlock, c)
 
 static inline void _percpu_read_lock(percpu_rwlock_t **per_cpudata,
                                          percpu_rwlock_t *percpu_rwlock)
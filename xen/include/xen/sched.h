@@ -114,6 +114,8 @@ struct evtchn
     u8 priority;
     u8 last_priority;
     u16 last_vcpu_id;
+    /* Notification moderation state (NULL if never configured). */
+    struct evtchn_moderation *moderation;
 #ifdef CONFIG_XSM
     union {
 #ifdef XSM_NEED_GENERIC_EVTCHN_SSID
@@ -139,6 +141,8 @@ int  evtchn_init(struct domain *d, unsigned int max_port);
 void evtchn_destroy(struct domain *d); /* from domain_kill */
 void evtchn_destroy_final(struct domain *d); /* from complete_domain_destroy */
 
+struct evtchn_moderation;
+struct sched_latency;
 struct waitqueue_vcpu;
 
 struct vcpu
@@ -162,6 +166,7 @@ struct vcpu
     struct timer     poll_timer;    /* timeout for SCHEDOP_poll */
 
     struct sched_unit *sched_unit;
+    struct sched_latency *sched_latency; /* latency histograms */
 
     struct vcpu_runstate_info runstate;
 #ifndef CONFIG_COMPAT
@@ -226,6 +231,9 @@ struct vcpu
      */
     int              poll_evtchn;
 
+    /* Event channel notifications sent by the vCPU, for domstats. */
+    unsigned long    evtchn_sends;
+
     /* (over-)protected by ->domain->event_lock */
     int              pirq_evtchn_head;
 
@@ -501,6 +509,7 @@ struct domain
     /* Memory sharing support */
 #ifdef CONFIG_MEM_SHARING
     struct vm_event_domain *vm_event_share;
+    struct domain *parent; /* VM fork parent */
 #endif
     /* Memory paging support */
 #ifdef CONFIG_HAS_MEM_PAGING
@@ -685,6 +694,7 @@ void sched_destroy_domain(struct domain *d);
 int sched_move_domain(struct domain *d, struct cpupool *c);
 long sched_adjust(struct domain *, struct xen_domctl_scheduler_op *);
 long sched_adjust_global(struct xen_sysctl_scheduler_op *);
+int sched_latency_op(struct xen_sysctl_sched_latency *);
 int  sched_id(void);
 void sched_tick_suspend(void);
 void sched_tick_resume(void);
@@ -30,6 +30,21 @@ union lock_debug { };
 #define spin_debug_disable() ((void)0)
 #endif
 
+/*
+ * Lock classes, for contention statistics (XEN_SYSCTL_lockstat_op).  Locks
+ * are of class LOCK_CLASS_OTHER, unless defined with DEFINE_SPINLOCK_CLASS()
+ * or given a class with spin_lock_set_class() after being initialised.
+ */
+#define LOCK_CLASS_OTHER  0
+#define LOCK_CLASS_GRANT  1
+#define LOCK_CLASS_P2M    2
+#define LOCK_CLASS_HEAP   3
+#define LOCK_CLASS_EVENT  4
+#define LOCK_CLASS_SCHED  5
+#define LOCK_CLASS_NR     6
+/* The wait queue of a rwlock, whose contention is accounted to the rwlock. */
+#define LOCK_CLASS_QUEUE  0x80
+
 #ifdef CONFIG_DEBUG_LOCK_PROFILE
 
 #include <public/sysctl.h>
@@ -92,10 +107,11 @@ struct lock_profile_qhead {
     static struct lock_profile * const __lock_profile_##name                  \
     __used_section(".lockprofile.data") =                                     \
     &__lock_profile_data_##name
-#define _SPIN_LOCK_UNLOCKED(x) { { 0 }, SPINLOCK_NO_CPU, 0, _LOCK_DEBUG, x }
-#define SPIN_LOCK_UNLOCKED _SPIN_LOCK_UNLOCKED(NULL)
-#define DEFINE_SPINLOCK(l)                                                    \
-    spinlock_t l = _SPIN_LOCK_UNLOCKED(NULL);                                 \
+#define _SPIN_LOCK_UNLOCKED(c, x)                                             \
+    { { 0 }, SPINLOCK_NO_CPU, 0, c, 0, _LOCK_DEBUG, x }
+#define SPIN_LOCK_UNLOCKED_CLASS(c) _SPIN_LOCK_UNLOCKED(c, NULL)
+#define DEFINE_SPINLOCK_CLASS(l, c)                                           \
+    spinlock_t l = _SPIN_LOCK_UNLOCKED(c, NULL);                              \
     static struct lock_profile __lock_profile_data_##l = _LOCK_PROFILE(l);    \
     _LOCK_PROFILE_PTR(l)
 
@@ -106,7 +122,7 @@ struct lock_profile_qhead {
         if (!prof) break;                                                     \
         prof->name = #l;                                                      \
         prof->lock = &(s)->l;                                                 \
-        (s)->l = (spinlock_t)_SPIN_LOCK_UNLOCKED(prof);                       \
+        (s)->l = (spinlock_t)_SPIN_LOCK_UNLOCKED(LOCK_CLASS_OTHER, prof);     \
         prof->next = (s)->profile_head.elem_q;                                \
         (s)->profile_head.elem_q = prof;                                      \
     } while(0)
@@ -128,8 +144,9 @@ extern void spinlock_profile_reset(unsigned char key);
 
 struct lock_profile_qhead { };
 
-#define SPIN_LOCK_UNLOCKED { { 0 }, SPINLOCK_NO_CPU, 0, _LOCK_DEBUG }
-#define DEFINE_SPINLOCK(l) spinlock_t l = SPIN_LOCK_UNLOCKED
+#define SPIN_LOCK_UNLOCKED_CLASS(c)                                           \
+    { { 0 }, SPINLOCK_NO_CPU, 0, c, 0, _LOCK_DEBUG }
+#define DEFINE_SPINLOCK_CLASS(l, c) spinlock_t l = SPIN_LOCK_UNLOCKED_CLASS(c)
 
 #define spin_lock_init_prof(s, l) spin_lock_init(&((s)->l))
 #define lock_profile_register_struct(type, ptr, idx, print)
@@ -138,6 +155,9 @@ struct lock_profile_qhead { };
 
 #endif
 
+#define SPIN_LOCK_UNLOCKED SPIN_LOCK_UNLOCKED_CLASS(LOCK_CLASS_OTHER)
+#define DEFINE_SPINLOCK(l) DEFINE_SPINLOCK_CLASS(l, LOCK_CLASS_OTHER)
+
 typedef union {
     u32 head_tail;
     struct {
@@ -155,6 +175,8 @@ typedef struct spinlock {
 #define SPINLOCK_RECURSE_BITS  (16 - SPINLOCK_CPU_BITS)
     u16 recurse_cnt:SPINLOCK_RECURSE_BITS;
 #define SPINLOCK_MAX_RECURSE   ((1u << SPINLOCK_RECURSE_BITS) - 1)
+    u8 lock_class;                   /* LOCK_CLASS_* */
+    bool lockstat_held;              /* Hold time being measured. */
     union lock_debug debug;
 #ifdef CONFIG_DEBUG_LOCK_PROFILE
     struct lock_profile *profile;
@@ -163,6 +185,14 @@ typedef struct spinlock {
 
 
 #define spin_lock_init(l) (*(l) = (spinlock_t)SPIN_LOCK_UNLOCKED)
+#define spin_lock_set_class(l, c) ((l)->lock_class = (c))
+
+struct xen_sysctl_lockstat_op;
+
+extern bool lockstat_enabled;
+void lockstat_rwlock_contended(unsigned int class, s_time_t start,
+                               const void *caller);
+int spinlock_lockstat_op(struct xen_sysctl_lockstat_op *op);
 
 void _spin_lock(spinlock_t *lock);
 void _spin_lock_cb(spinlock_t *lock, void (*cond)(void *), void *data);
@@ -727,6 +727,12 @@ static int flask_domctl(struct domain *d, int cmd)
     case XEN_DOMCTL_audit_p2m:
         return current_has_perm(d, SECCLASS_HVM, HVM__AUDIT_P2M);
 
+    case XEN_DOMCTL_p2m_superpages:
+        return current_has_perm(d, SECCLASS_HVM, HVM__P2M_SUPERPAGES);
+
+    case XEN_DOMCTL_p2m_access_bits:
+        return current_has_perm(d, SECCLASS_DOMAIN2, DOMAIN2__MEM_PAGING);
+
     case XEN_DOMCTL_cacheflush:
         return current_has_perm(d, SECCLASS_DOMAIN2, DOMAIN2__CACHEFLUSH);
 
@@ -788,6 +794,7 @@ static int flask_sysctl(int cmd)
         return domain_has_xen(current->domain, XEN__PM_OP);
 
     case XEN_SYSCTL_lockprof_op:
+    case XEN_SYSCTL_lockstat_op:
         return domain_has_xen(current->domain, XEN__LOCKPROF);
 
     case XEN_SYSCTL_cpupool_op:
@@ -824,6 +831,18 @@ static int flask_sysctl(int cmd)
     case XEN_SYSCTL_set_parameter:
         return avc_current_has_perm(SECINITSID_XEN, SECCLASS_XEN2,
                                     XEN2__SET_PARAMETER, NULL);
+    case XEN_SYSCTL_sched_latency:
+        return avc_current_has_perm(SECINITSID_XEN, SECCLASS_XEN2,
+                                    XEN2__SCHED_LATENCY, NULL);
+    case XEN_SYSCTL_vmexit_stats:
+        return avc_current_has_perm(SECINITSID_XEN, SECCLASS_XEN2,
+                                    XEN2__VMEXIT_STATS, NULL);
+    case XEN_SYSCTL_pmuprof_op:
+        return avc_current_has_perm(SECINITSID_XEN, SECCLASS_XEN2,
+                                    XEN2__PMU_CTRL, NULL);
+    case XEN_SYSCTL_hypercall_stats:
+        return avc_current_has_perm(SECINITSID_XEN, SECCLASS_XEN2,
+                                    XEN2__HYPERCALL_STATS, NULL);
 
     default:
         return avc_unknown_permission("sysctl", cmd);